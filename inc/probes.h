@@ -0,0 +1,90 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_Probes
+
+    @brief      USDT static probe points of the Frost compiler.
+
+    @file       probes.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The probes are SystemTap-compatible user statically defined
+                tracepoints under the `frost` provider, built on <sys/sdt.h>
+                (package systemtap-sdt-dev or systemtap-sdt-devel). Each probe
+                compiles to a single NOP plus an ELF note describing where its
+                arguments live; the NOP does nothing until a tracer attaches
+                and turns it into a breakpoint. They can be listed and traced
+                in a normal release build:
+
+                    perf list 'sdt_frost:*'
+                    bpftrace -e 'usdt:./frost:frost:lex__done { @[arg1] = count(); }'
+
+                Probes and their arguments:
+
+                | Probe          | Arguments                                 |
+                |----------------|-------------------------------------------|
+                | lexer__init    | source, size                              |
+                | token          | type, offset, length                      |
+                | lex__done      | source, size                              |
+                | phase__begin   | trace_phase_t, detail (string or NULL)    |
+                | phase__end     | trace_phase_t, wall ns (0 if not timed)   |
+                | arena__grow    | arena base, committed bytes after growing |
+
+    @note       - Without <sys/sdt.h>, or with FROST_NO_PROBES defined, every
+                  probe expands to nothing.
+                - Probe arguments are still computed when no tracer is
+                  attached, so they must be cheap expressions without side
+                  effects, ideally values already in registers.
+============================================================================ **/
+
+#ifndef PROBES_H_
+#define PROBES_H_
+
+/* ========================================================================== *\
+ *                              MACRO DEFINITIONS                             *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       FROST_PROBES
+    @brief     Defined to 1 when probes are compiled in, 0 otherwise.
+============================================================================ **/
+#if !defined(FROST_NO_PROBES) && defined(__has_include)
+    #if __has_include(<sys/sdt.h>)
+        #include <stdint.h>
+        #include <sys/sdt.h>
+        #define FROST_PROBES 1
+    #endif
+#endif
+
+#ifndef FROST_PROBES
+    #define FROST_PROBES 0
+#endif
+
+/** ============================================================================
+    @def       FROST_PROBE0 .. FROST_PROBE3
+    @brief     Declares a `frost` provider probe with zero to three arguments.
+
+    @details   Arguments are cast to integers of pointer width, which is what
+               the probe notes record and what tracers read back.
+============================================================================ **/
+#if FROST_PROBES
+    #define FROST_PROBE0(name)                                      \
+        DTRACE_PROBE(frost, name)
+    #define FROST_PROBE1(name, a)                                   \
+        DTRACE_PROBE1(frost, name, (uintptr_t)(a))
+    #define FROST_PROBE2(name, a, b)                                \
+        DTRACE_PROBE2(frost, name, (uintptr_t)(a), (uintptr_t)(b))
+    #define FROST_PROBE3(name, a, b, c)                             \
+        DTRACE_PROBE3(frost, name, (uintptr_t)(a), (uintptr_t)(b),  \
+                      (uintptr_t)(c))
+#else
+    #define FROST_PROBE0(name)                  do { } while (0)
+    #define FROST_PROBE1(name, a)               do { } while (0)
+    #define FROST_PROBE2(name, a, b)            do { } while (0)
+    #define FROST_PROBE3(name, a, b, c)         do { } while (0)
+#endif
+
+#endif /* PROBES_H_ */
+
+/*< end of header file >*/
@@ -79,6 +79,28 @@
     #define ARCH_ALIGNMENT ALIGNMENT                /**< Default alignment for other architectures */
 #endif
 
+/** ============================================================================
+    @def       ARCH_CACHE_LINE_SIZE
+    @brief     Defines the size of a data cache line on the target architecture.
+
+    @details   This macro is used to pad and align data that is written by
+               different threads, so that two independent hot fields never
+               share a cache line (false sharing).
+
+    @note      - x86_64 and most ARM64 cores use 64-byte cache lines.
+               - Apple ARM64 cores use 128-byte cache lines.
+               - For other architectures, 64 bytes is assumed.
+============================================================================ **/
+#if defined(__APPLE__) && (defined(__aarch64__) || defined(_M_ARM64))
+    #define ARCH_CACHE_LINE_SIZE 128U               /**< Apple ARM64 uses 128-byte cache lines */
+#elif defined(__x86_64__) || defined(_M_X64)
+    #define ARCH_CACHE_LINE_SIZE 64U                /**< x86_64 uses 64-byte cache lines */
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define ARCH_CACHE_LINE_SIZE 64U                /**< ARM64 typically uses 64-byte cache lines */
+#else
+    #define ARCH_CACHE_LINE_SIZE 64U                /**< Default cache line size for other architectures */
+#endif
+
 /** ============================================================================
     @def       FUNCTION_SUCCESS
     @brief     Indicates successful execution of a function.
@@ -0,0 +1,357 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_Allocator
+
+    @package    Frost_Allocator
+    @brief      This module provides the pluggable memory allocator through
+                which every allocation of the Frost Compiler is made.
+
+    @file       allocator.c
+    @headerfile allocator.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The current allocator is a thread-local pointer, so threads
+                never contend on it and different compilations running on
+                different threads can use different allocators. The default
+                allocator forwards to malloc, aligned_alloc, realloc and free.
+
+    @note       - Threads created by Frost modules call Frost_allocatorSet
+                  with the allocator captured from their creator.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+/*< Implements >*/
+#include "allocator.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_libcAlloc
+  @package  Frost_Allocator
+
+  @brief    Default alloc: malloc, or aligned_alloc for over-aligned blocks.
+ =========================================================================== **/
+static void *Frost_libcAlloc(void *ctx, size_t size, size_t alignment, frost_mem_tag_t tag)
+{
+    UNUSED(ctx);
+    UNUSED(tag);
+
+    return (alignment > ARCH_ALIGNMENT) ?
+           aligned_alloc(alignment, ALIGN_UP(size, alignment)) : malloc(size);
+}
+
+/** ============================================================================
+  @fn       Frost_libcRealloc
+  @package  Frost_Allocator
+
+  @brief    Default realloc: forwards to realloc(3).
+ =========================================================================== **/
+static void *Frost_libcRealloc(void *ctx, void *ptr, size_t old_size, size_t new_size,
+                               frost_mem_tag_t tag)
+{
+    UNUSED(ctx);
+    UNUSED(old_size);
+    UNUSED(tag);
+
+    return realloc(ptr, new_size);
+}
+
+/** ============================================================================
+  @fn       Frost_libcFree
+  @package  Frost_Allocator
+
+  @brief    Default free: forwards to free(3).
+ =========================================================================== **/
+static void Frost_libcFree(void *ctx, void *ptr, size_t size, frost_mem_tag_t tag)
+{
+    UNUSED(ctx);
+    UNUSED(size);
+    UNUSED(tag);
+
+    free(ptr);
+}
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Allocator backed by the C library >*/
+static const frost_allocator_t libc_allocator =
+{
+    .alloc      = Frost_libcAlloc,
+    .realloc    = Frost_libcRealloc,
+    .free       = Frost_libcFree,
+    .ctx        = NULL,
+};
+
+/*< Printable name of each memory tag >*/
+static const char *const mem_tag_names[FROST_MEM_TAG_COUNT] =
+{
+    [FROST_MEM_GENERAL]     = "general",
+    [FROST_MEM_SOURCE]      = "source",
+    [FROST_MEM_LEXER]       = "lexer",
+    [FROST_MEM_TOKEN]       = "token",
+    [FROST_MEM_BRACKET]     = "bracket",
+    [FROST_MEM_SCHEDULER]   = "scheduler",
+    [FROST_MEM_QUEUE]       = "queue",
+    [FROST_MEM_GRAPH]       = "graph",
+    [FROST_MEM_SERVER]      = "server",
+    [FROST_MEM_TRACE]       = "trace",
+    [FROST_MEM_CACHE]       = "cache",
+    [FROST_MEM_IMAGE]       = "image",
+    [FROST_MEM_VSOURCE]     = "vsource",
+    [FROST_MEM_SPLICE]      = "splice",
+};
+
+/*< Allocator of the calling thread, NULL for the default one >*/
+static _Thread_local const frost_allocator_t *current_allocator = NULL;
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_allocatorDefault
+  @package  Frost_Allocator
+
+  @brief    Returns the allocator backed by the C library.
+
+  @return   Pointer to the default allocator, never NULL.
+ =========================================================================== **/
+const frost_allocator_t *Frost_allocatorDefault(void)
+{
+    return &libc_allocator;
+}
+
+/** ============================================================================
+  @fn       Frost_allocatorGet
+  @package  Frost_Allocator
+
+  @brief    Returns the current allocator of the calling thread.
+
+  @return   Pointer to the current allocator, never NULL.
+ =========================================================================== **/
+const frost_allocator_t *Frost_allocatorGet(void)
+{
+    return (current_allocator != NULL) ? current_allocator : &libc_allocator;
+}
+
+/** ============================================================================
+  @fn       Frost_allocatorSet
+  @package  Frost_Allocator
+
+  @brief    Sets the current allocator of the calling thread.
+
+  @param    allocator [in]:   New allocator, or NULL for the default one.
+
+  @return   The previous allocator of the thread, to be restored later.
+ =========================================================================== **/
+const frost_allocator_t *Frost_allocatorSet(const frost_allocator_t *allocator)
+{
+    /*< Variable Declarations >*/
+    const frost_allocator_t *previous = Frost_allocatorGet();
+
+    /*< Start Function Algorithm >*/
+    current_allocator = allocator;
+
+    /*< Function Output >*/
+    return previous;
+}
+
+/** ============================================================================
+  @fn       Frost_memAlloc
+  @package  Frost_Allocator
+
+  @brief    Allocates uninitialized memory from the current allocator.
+
+  @param    size      [in]:   Number of bytes.
+  @param    tag       [in]:   Subsystem requesting the memory.
+
+  @return   Pointer to the memory on success.
+            NULL if the allocation fails.
+ =========================================================================== **/
+void *Frost_memAlloc(size_t size, frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    const frost_allocator_t *allocator = Frost_allocatorGet();
+
+    /*< Function Output >*/
+    return allocator->alloc(allocator->ctx, size, ARCH_ALIGNMENT, tag);
+}
+
+/** ============================================================================
+  @fn       Frost_memCalloc
+  @package  Frost_Allocator
+
+  @brief    Allocates zeroed memory for an array from the current allocator.
+
+  @param    count     [in]:   Number of elements.
+  @param    size      [in]:   Size of each element.
+  @param    tag       [in]:   Subsystem requesting the memory.
+
+  @return   Pointer to the memory on success.
+            NULL if count * size overflows or the allocation fails.
+ =========================================================================== **/
+void *Frost_memCalloc(size_t count, size_t size, frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    void *memory_out = NULL;
+
+    /*< Security Checks >*/
+    if ( (size != 0u) && (count > (SIZE_MAX / size)) )
+    {
+        LOG_ERROR("Array size overflows.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    memory_out = Frost_memAlloc(count * size, tag);
+    if (memory_out != NULL)
+    {
+        memset(memory_out, 0, count * size);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return memory_out;
+}
+
+/** ============================================================================
+  @fn       Frost_memAlignedAlloc
+  @package  Frost_Allocator
+
+  @brief    Allocates uninitialized, over-aligned memory from the current
+            allocator.
+
+  @param    alignment [in]:   Power of two alignment, e.g. ARCH_CACHE_LINE_SIZE.
+  @param    size      [in]:   Number of bytes, a multiple of alignment.
+  @param    tag       [in]:   Subsystem requesting the memory.
+
+  @return   Pointer to the memory on success.
+            NULL if the allocation fails.
+ =========================================================================== **/
+void *Frost_memAlignedAlloc(size_t alignment, size_t size, frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    const frost_allocator_t *allocator = Frost_allocatorGet();
+
+    /*< Function Output >*/
+    return allocator->alloc(allocator->ctx, size, MAX(alignment, (size_t)ARCH_ALIGNMENT), tag);
+}
+
+/** ============================================================================
+  @fn       Frost_memRealloc
+  @package  Frost_Allocator
+
+  @brief    Resizes a block from the current allocator.
+
+  @param    ptr       [in]:   Block to resize, or NULL.
+  @param    old_size  [in]:   Current size of the block, or zero if unknown.
+                              Only allocators that track block sizes accept
+                              zero: the arena allocator fails instead.
+  @param    new_size  [in]:   Requested size.
+  @param    tag       [in]:   Subsystem owning the block.
+
+  @return   Pointer to the resized block on success.
+            NULL if the allocation fails; the original block is kept.
+ =========================================================================== **/
+void *Frost_memRealloc(void *ptr, size_t old_size, size_t new_size, frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    const frost_allocator_t *allocator = Frost_allocatorGet();
+
+    /*< Function Output >*/
+    return allocator->realloc(allocator->ctx, ptr, old_size, new_size, tag);
+}
+
+/** ============================================================================
+  @fn       Frost_memFree
+  @package  Frost_Allocator
+
+  @brief    Returns a block to the current allocator.
+
+  @param    ptr       [in]:   Block to free, or NULL.
+  @param    size      [in]:   Size of the block, or zero if unknown.
+  @param    tag       [in]:   Subsystem owning the block.
+ =========================================================================== **/
+void Frost_memFree(void *ptr, size_t size, frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    const frost_allocator_t *allocator = Frost_allocatorGet();
+
+    /*< Start Function Algorithm >*/
+    if (ptr != NULL)
+    {
+        allocator->free(allocator->ctx, ptr, size, tag);
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_memStrdup
+  @package  Frost_Allocator
+
+  @brief    Duplicates a string into memory from the current allocator.
+
+  @param    string    [in]:   NUL-terminated string to copy.
+  @param    tag       [in]:   Subsystem requesting the memory.
+
+  @return   Pointer to the copy on success, freed with a size of
+            strlen(copy) + 1.
+            NULL if string is NULL or the allocation fails.
+ =========================================================================== **/
+char *Frost_memStrdup(const char *string, frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    char *string_out    = NULL;
+    size_t size         = 0u;
+
+    /*< Security Checks >*/
+    if (string == NULL)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    size        = strlen(string) + 1u;
+    string_out  = (char *)Frost_memAlloc(size, tag);
+    if (string_out != NULL)
+    {
+        memcpy(string_out, string, size);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return string_out;
+}
+
+/** ============================================================================
+  @fn       Frost_memTagName
+  @package  Frost_Allocator
+
+  @brief    Returns the printable name of a memory tag.
+
+  @param    tag       [in]:   Memory tag.
+
+  @return   Lower-case tag name, or "general" for an unknown tag.
+ =========================================================================== **/
+const char *Frost_memTagName(frost_mem_tag_t tag)
+{
+    return mem_tag_names[(tag < FROST_MEM_TAG_COUNT) ? tag : FROST_MEM_GENERAL];
+}
+
+/*< end of file >*/
+/** @}*/
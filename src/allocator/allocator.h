@@ -0,0 +1,243 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_Allocator
+
+    @brief      This module provides the pluggable memory allocator through
+                which every allocation of the Frost Compiler is made.
+
+    @file       allocator.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    An allocator is a small vtable (frost_allocator_t) of alloc,
+                realloc and free functions plus a user context. Each thread
+                has a current allocator, the libc one by default, which the
+                Frost_mem* helpers forward to. Embedders can install
+                jemalloc, mimalloc, size-class pools or arenas, and every
+                request carries a frost_mem_tag_t naming the subsystem that
+                asked, so memory can be accounted per compilation and per
+                phase. Threads started by the Frost Scheduler, the Token Queue
+                and the Server inherit the allocator of the thread that
+                created them.
+
+    @note       - A block must be freed through the allocator that was current
+                  when it was allocated. Set the allocator once per thread,
+                  before creating any Frost object.
+                - The allocator must outlive every block it handed out and
+                  every thread using it.
+                - `size` given to free and realloc is the size requested at
+                  allocation when the caller knows it, or zero otherwise;
+                  allocators needing exact sizes must record them.
+ =========================================================================== **/
+
+#ifndef ALLOCATOR_H_
+#define ALLOCATOR_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+/* ========================================================================== *\
+ *                                PUBLIC ENUMS                                *
+\* ========================================================================== */
+
+/** ============================================================================
+    @enum       frostMemTag
+    @package    Frost_Allocator
+
+    @typedef    frost_mem_tag_t
+
+    @brief      Subsystem on whose behalf memory is requested.
+============================================================================ **/
+typedef enum frostMemTag
+{
+    FROST_MEM_GENERAL       = 0u,   /*< Anything without a dedicated tag >*/
+    FROST_MEM_SOURCE        = 1u,   /*< Source buffers owned by a lexer >*/
+    FROST_MEM_LEXER         = 2u,   /*< Lexer objects >*/
+    FROST_MEM_TOKEN         = 3u,   /*< Tokens and their lexemes >*/
+    FROST_MEM_BRACKET       = 4u,   /*< Bracket-match indexes >*/
+    FROST_MEM_SCHEDULER     = 5u,   /*< Scheduler pools and workers >*/
+    FROST_MEM_QUEUE         = 6u,   /*< Token queue rings >*/
+    FROST_MEM_GRAPH         = 7u,   /*< Task graph nodes and edges >*/
+    FROST_MEM_SERVER        = 8u,   /*< Server requests and file cache >*/
+    FROST_MEM_TRACE         = 9u,   /*< Time trace buffers >*/
+    FROST_MEM_CACHE         = 10u,  /*< Compile cache handles and objects >*/
+    FROST_MEM_IMAGE         = 11u,  /*< Header images and their builders >*/
+    FROST_MEM_VSOURCE       = 12u,  /*< Virtual source file and piece tables >*/
+    FROST_MEM_SPLICE        = 13u,  /*< Splice maps and stitching windows >*/
+    FROST_MEM_TAG_COUNT     = 14u,  /*< Number of tags >*/
+} frost_mem_tag_t;
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostAllocator
+  @package  Frost_Allocator
+
+  @typedef  frost_allocator_t
+
+  @brief    Memory allocator vtable.
+
+  @details  `alloc` returns uninitialized memory aligned to at least
+            `alignment`, a power of two no smaller than ARCH_ALIGNMENT, or
+            NULL. `realloc` is only used on blocks allocated with the default
+            alignment and follows the semantics of realloc(3); an allocator
+            that keeps no per-block size may return NULL when `old_size` is
+            zero and `ptr` is not NULL. `free` accepts NULL.
+============================================================================ **/
+typedef struct frostAllocator
+{
+    void    *(*alloc)(void *ctx, size_t size, size_t alignment, frost_mem_tag_t tag);
+    void    *(*realloc)(void *ctx, void *ptr, size_t old_size, size_t new_size,
+                        frost_mem_tag_t tag);
+    void    (*free)(void *ctx, void *ptr, size_t size, frost_mem_tag_t tag);
+    void    *ctx;                   /*< User context passed to every call >*/
+} frost_allocator_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_allocatorDefault
+  @package  Frost_Allocator
+
+  @brief    Returns the allocator backed by the C library.
+
+  @return   Pointer to the default allocator, never NULL.
+ =========================================================================== **/
+const frost_allocator_t *Frost_allocatorDefault(void);
+
+/** ============================================================================
+  @fn       Frost_allocatorGet
+  @package  Frost_Allocator
+
+  @brief    Returns the current allocator of the calling thread.
+
+  @return   Pointer to the current allocator, never NULL.
+ =========================================================================== **/
+const frost_allocator_t *Frost_allocatorGet(void);
+
+/** ============================================================================
+  @fn       Frost_allocatorSet
+  @package  Frost_Allocator
+
+  @brief    Sets the current allocator of the calling thread.
+
+  @param    allocator [in]:   New allocator, or NULL for the default one.
+
+  @return   The previous allocator of the thread, to be restored later.
+ =========================================================================== **/
+const frost_allocator_t *Frost_allocatorSet(const frost_allocator_t *allocator);
+
+/** ============================================================================
+  @fn       Frost_memAlloc
+  @package  Frost_Allocator
+
+  @brief    Allocates uninitialized memory from the current allocator.
+
+  @param    size      [in]:   Number of bytes.
+  @param    tag       [in]:   Subsystem requesting the memory.
+
+  @return   Pointer to the memory on success.
+            NULL if the allocation fails.
+ =========================================================================== **/
+void *Frost_memAlloc(size_t size, frost_mem_tag_t tag);
+
+/** ============================================================================
+  @fn       Frost_memCalloc
+  @package  Frost_Allocator
+
+  @brief    Allocates zeroed memory for an array from the current allocator.
+
+  @param    count     [in]:   Number of elements.
+  @param    size      [in]:   Size of each element.
+  @param    tag       [in]:   Subsystem requesting the memory.
+
+  @return   Pointer to the memory on success.
+            NULL if count * size overflows or the allocation fails.
+ =========================================================================== **/
+void *Frost_memCalloc(size_t count, size_t size, frost_mem_tag_t tag);
+
+/** ============================================================================
+  @fn       Frost_memAlignedAlloc
+  @package  Frost_Allocator
+
+  @brief    Allocates uninitialized, over-aligned memory from the current
+            allocator.
+
+  @param    alignment [in]:   Power of two alignment, e.g. ARCH_CACHE_LINE_SIZE.
+  @param    size      [in]:   Number of bytes, a multiple of alignment.
+  @param    tag       [in]:   Subsystem requesting the memory.
+
+  @return   Pointer to the memory on success.
+            NULL if the allocation fails.
+ =========================================================================== **/
+void *Frost_memAlignedAlloc(size_t alignment, size_t size, frost_mem_tag_t tag);
+
+/** ============================================================================
+  @fn       Frost_memRealloc
+  @package  Frost_Allocator
+
+  @brief    Resizes a block from the current allocator.
+
+  @param    ptr       [in]:   Block to resize, or NULL.
+  @param    old_size  [in]:   Current size of the block, or zero if unknown.
+                              Only allocators that track block sizes accept
+                              zero: the arena allocator fails instead.
+  @param    new_size  [in]:   Requested size.
+  @param    tag       [in]:   Subsystem owning the block.
+
+  @return   Pointer to the resized block on success.
+            NULL if the allocation fails; the original block is kept.
+ =========================================================================== **/
+void *Frost_memRealloc(void *ptr, size_t old_size, size_t new_size, frost_mem_tag_t tag);
+
+/** ============================================================================
+  @fn       Frost_memFree
+  @package  Frost_Allocator
+
+  @brief    Returns a block to the current allocator.
+
+  @param    ptr       [in]:   Block to free, or NULL.
+  @param    size      [in]:   Size of the block, or zero if unknown.
+  @param    tag       [in]:   Subsystem owning the block.
+ =========================================================================== **/
+void Frost_memFree(void *ptr, size_t size, frost_mem_tag_t tag);
+
+/** ============================================================================
+  @fn       Frost_memStrdup
+  @package  Frost_Allocator
+
+  @brief    Duplicates a string into memory from the current allocator.
+
+  @param    string    [in]:   NUL-terminated string to copy.
+  @param    tag       [in]:   Subsystem requesting the memory.
+
+  @return   Pointer to the copy on success, freed with a size of
+            strlen(copy) + 1.
+            NULL if string is NULL or the allocation fails.
+ =========================================================================== **/
+char *Frost_memStrdup(const char *string, frost_mem_tag_t tag);
+
+/** ============================================================================
+  @fn       Frost_memTagName
+  @package  Frost_Allocator
+
+  @brief    Returns the printable name of a memory tag.
+
+  @param    tag       [in]:   Memory tag.
+
+  @return   Lower-case tag name, or "general" for an unknown tag.
+ =========================================================================== **/
+const char *Frost_memTagName(frost_mem_tag_t tag);
+
+#endif /* ALLOCATOR_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,548 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_Arena
+
+    @package    Frost_Arena
+    @brief      This module provides bump-pointer arenas over large reserved
+                virtual ranges, optionally backed by transparent huge pages.
+
+    @file       arena.c
+    @headerfile arena.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The range is mapped PROT_NONE with MAP_NORESERVE, one huge
+                page larger than requested, and trimmed so that its base is
+                huge-page aligned; otherwise the kernel could not use huge
+                pages for the first and last partial 2 MiB. Allocation is a
+                compare-and-swap on the offset. When a block ends past the
+                committed mark, the allocating thread takes the commit lock
+                and mprotects whole granules to read/write; pages are still
+                only faulted in when first touched.
+
+    @note       - Huge page advice and reporting are Linux-only; other
+                  platforms get a plain lazily committed arena.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Feature Macros >*/
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE     /*< MAP_ANONYMOUS, MAP_NORESERVE and MADV_HUGEPAGE >*/
+#endif
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+
+/*< Implements >*/
+#include "arena.h"
+#include "../../inc/utils.h"
+#include "../../inc/probes.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostArena
+  @package  Frost_Arena
+
+  @brief    Reserved range, bump offset and commit mark.
+============================================================================ **/
+struct frostArena
+{
+    char                *base;          /*< Huge-page aligned start of the range >*/
+    size_t              reserved;       /*< Size of the range >*/
+    unsigned int        flags;          /*< Flags given at creation >*/
+
+    pthread_mutex_t     commit_lock;    /*< Serializes commits >*/
+    atomic_size_t       committed;      /*< Bytes accessible from base >*/
+    atomic_size_t       used;           /*< Bump offset from base >*/
+};
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_arenaCommit
+  @package  Frost_Arena
+
+  @brief    Makes the arena accessible up to at least `end` bytes.
+
+  @param    arena     [in]:   Pointer to the arena.
+  @param    end       [in]:   Offset that must become accessible.
+
+  @return   FUNCTION_SUCCESS on success.
+            Negative errno value if mprotect fails.
+ =========================================================================== **/
+static int Frost_arenaCommit(arena_t *arena, size_t end)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCESS;
+    size_t committed    = 0u;
+    size_t target       = 0u;
+
+    /*< Start Function Algorithm >*/
+    pthread_mutex_lock(&arena->commit_lock);
+
+    committed   = atomic_load_explicit(&arena->committed, memory_order_relaxed);
+    target      = MIN(ALIGN_UP(end, (size_t)ARENA_COMMIT_GRANULE), arena->reserved);
+
+    if (target > committed)
+    {
+        if (mprotect(arena->base + committed, target - committed, PROT_READ | PROT_WRITE) != 0)
+        {
+            ret = -errno;
+            LOG_ERROR("Failed to commit arena memory.");
+        }
+        else
+        {
+            atomic_store_explicit(&arena->committed, target, memory_order_release);
+            FROST_PROBE2(arena__grow, arena->base, target);
+        }
+    }
+
+    pthread_mutex_unlock(&arena->commit_lock);
+
+    /*< Function Output >*/
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_arenaVtableAlloc
+  @package  Frost_Arena
+
+  @brief    frost_allocator_t alloc entry of Frost_arenaAllocator.
+ =========================================================================== **/
+static void *Frost_arenaVtableAlloc(void *ctx, size_t size, size_t alignment, frost_mem_tag_t tag)
+{
+    UNUSED(tag);
+
+    return Frost_arenaAlloc((arena_t *)ctx, size, alignment);
+}
+
+/** ============================================================================
+  @fn       Frost_arenaVtableRealloc
+  @package  Frost_Arena
+
+  @brief    frost_allocator_t realloc entry of Frost_arenaAllocator.
+
+  @details  Growing needs the old size to copy the contents; a block of
+            unknown size cannot be moved and the call fails.
+ =========================================================================== **/
+static void *Frost_arenaVtableRealloc(void *ctx, void *ptr, size_t old_size, size_t new_size,
+                                      frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    void *block_out = NULL;
+
+    UNUSED(tag);
+
+    /*< Security Checks >*/
+    if ( (ptr != NULL) && (old_size == 0u) )
+    {
+        LOG_ERROR("Arena cannot resize a block of unknown size.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if ( (ptr != NULL) && (new_size <= old_size) )
+    {
+        block_out = ptr;
+        goto end_of_function;
+    }
+
+    block_out = Frost_arenaAlloc((arena_t *)ctx, new_size, ARCH_ALIGNMENT);
+    if ( (block_out != NULL) && (ptr != NULL) )
+    {
+        memcpy(block_out, ptr, old_size);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return block_out;
+}
+
+/** ============================================================================
+  @fn       Frost_arenaVtableFree
+  @package  Frost_Arena
+
+  @brief    frost_allocator_t free entry of Frost_arenaAllocator: no-op.
+ =========================================================================== **/
+static void Frost_arenaVtableFree(void *ctx, void *ptr, size_t size, frost_mem_tag_t tag)
+{
+    UNUSED(ctx);
+    UNUSED(ptr);
+    UNUSED(size);
+    UNUSED(tag);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initArena
+  @package  Frost_Arena
+
+  @brief    Reserves the address range of a new arena.
+
+  @param    reserve   [in]:   Bytes of address space to reserve, rounded up
+                              to ARENA_HUGE_PAGE_SIZE.
+  @param    flags     [in]:   Zero or ARENA_HUGE_PAGES.
+
+  @return   Pointer to a newly created arena on success.
+            NULL if reserve is zero or the range cannot be mapped.
+ =========================================================================== **/
+arena_t *Frost_initArena(size_t reserve, unsigned int flags)
+{
+    /*< Variable Declarations >*/
+    arena_t *arena_out  = NULL;
+    char *mapping       = NULL;
+    char *base          = NULL;
+    size_t span         = 0u;
+    size_t head         = 0u;
+
+    /*< Security Checks >*/
+    if (reserve == 0u)
+    {
+        LOG_ERROR("Arena reservation is empty.");
+        goto end_of_function;
+    }
+
+    reserve = ALIGN_UP(reserve, (size_t)ARENA_HUGE_PAGE_SIZE);
+    span    = reserve + ARENA_HUGE_PAGE_SIZE;
+
+    /*< Allocate Memory >*/
+    arena_out = (arena_t *)Frost_memCalloc(1u, sizeof(arena_t), FROST_MEM_GENERAL);
+    if (arena_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for arena.");
+        goto end_of_function;
+    }
+
+    /*< Reserve and Align the Range >*/
+    mapping = (char *)mmap(NULL, span, PROT_NONE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mapping == (char *)MAP_FAILED)
+    {
+        LOG_ERROR("Failed to reserve arena address space.");
+        Frost_memFree(arena_out, sizeof(arena_t), FROST_MEM_GENERAL);
+        arena_out = NULL;
+        goto end_of_function;
+    }
+
+    base = (char *)ALIGN_UP((uintptr_t)mapping, (uintptr_t)ARENA_HUGE_PAGE_SIZE);
+    head = (size_t)(base - mapping);
+
+    if (head > 0u)
+    {
+        munmap(mapping, head);
+    }
+
+    if ((span - head) > reserve)
+    {
+        munmap(base + reserve, span - head - reserve);
+    }
+
+#if defined(MADV_HUGEPAGE)
+    if ( (flags & ARENA_HUGE_PAGES) && (madvise(base, reserve, MADV_HUGEPAGE) != 0) )
+    {
+        LOG_WARNING("Transparent huge pages are not available for the arena.");
+    }
+#endif
+
+    /*< Start Function Algorithm >*/
+    arena_out->base     = base;
+    arena_out->reserved = reserve;
+    arena_out->flags    = flags;
+
+    pthread_mutex_init(&arena_out->commit_lock, NULL);
+    atomic_init(&arena_out->committed, 0u);
+    atomic_init(&arena_out->used, 0u);
+
+    /*< Function Output >*/
+end_of_function:
+    return arena_out;
+}
+
+/** ============================================================================
+  @fn       Frost_freeArena
+  @package  Frost_Arena
+
+  @brief    Unmaps the arena and every block allocated from it.
+
+  @param    arena     [in]:   Pointer to the arena to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the arena is NULL.
+ =========================================================================== **/
+int Frost_freeArena(arena_t *arena)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (arena == NULL)
+    {
+        LOG_ERROR("Arena entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    munmap(arena->base, arena->reserved);
+    pthread_mutex_destroy(&arena->commit_lock);
+    Frost_memFree(arena, sizeof(arena_t), FROST_MEM_GENERAL);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_arenaAlloc
+  @package  Frost_Arena
+
+  @brief    Allocates a block by bumping the arena pointer.
+
+  @param    arena     [in]:   Pointer to the arena.
+  @param    size      [in]:   Number of bytes.
+  @param    alignment [in]:   Power of two alignment of the block.
+
+  @return   Pointer to uninitialized memory on success.
+            NULL if the arena is NULL, exhausted, or cannot commit memory.
+ =========================================================================== **/
+void *Frost_arenaAlloc(arena_t *arena, size_t size, size_t alignment)
+{
+    /*< Variable Declarations >*/
+    void *block_out = NULL;
+    size_t used     = 0u;
+    size_t start    = 0u;
+    size_t end      = 0u;
+
+    /*< Security Checks >*/
+    if (arena == NULL)
+    {
+        LOG_ERROR("Arena entry point is NULL.");
+        goto end_of_function;
+    }
+
+    alignment = MAX(alignment, (size_t)ARCH_ALIGNMENT);
+
+    /*< Start Function Algorithm >*/
+    used = atomic_load_explicit(&arena->used, memory_order_relaxed);
+
+    do
+    {
+        start   = ALIGN_UP(used, alignment);
+        end     = start + size;
+
+        if ( (start < used) || (end < start) || (end > arena->reserved) )
+        {
+            goto end_of_function;
+        }
+
+        if ( (end > atomic_load_explicit(&arena->committed, memory_order_acquire)) &&
+             (Frost_arenaCommit(arena, end) != FUNCTION_SUCESS) )
+        {
+            goto end_of_function;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&arena->used, &used, end,
+                                                    memory_order_relaxed,
+                                                    memory_order_relaxed));
+
+    block_out = arena->base + start;
+
+    /*< Function Output >*/
+end_of_function:
+    return block_out;
+}
+
+/** ============================================================================
+  @fn       Frost_arenaReset
+  @package  Frost_Arena
+
+  @brief    Releases every block at once, keeping the committed memory for
+            reuse.
+
+  @param    arena     [in]:   Pointer to the arena.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the arena is NULL.
+ =========================================================================== **/
+int Frost_arenaReset(arena_t *arena)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (arena == NULL)
+    {
+        LOG_ERROR("Arena entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    atomic_store_explicit(&arena->used, 0u, memory_order_relaxed);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_arenaUsage
+  @package  Frost_Arena
+
+  @brief    Returns how much of the arena is allocated and committed.
+
+  @param    arena     [in]:   Pointer to the arena.
+  @param    used      [out]:  Bytes handed out since the last reset, or NULL.
+  @param    committed [out]:  Bytes of address space committed, or NULL.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the arena is NULL.
+ =========================================================================== **/
+int Frost_arenaUsage(const arena_t *arena, size_t *used, size_t *committed)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (arena == NULL)
+    {
+        LOG_ERROR("Arena entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (used != NULL)
+    {
+        *used = atomic_load_explicit(&((arena_t *)arena)->used, memory_order_relaxed);
+    }
+
+    if (committed != NULL)
+    {
+        *committed = atomic_load_explicit(&((arena_t *)arena)->committed, memory_order_relaxed);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_arenaHugePages
+  @package  Frost_Arena
+
+  @brief    Reports how much of the arena is backed by huge pages.
+
+  @details  Reads the AnonHugePages field of the arena mapping in
+            /proc/self/smaps. Committing granules splits the mapping at the
+            commit mark, so every entry inside the range is summed.
+
+  @param    arena     [in]:   Pointer to the arena.
+  @param    bytes     [out]:  Bytes of the arena backed by huge pages.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            -ENOTSUP if the platform does not report huge page usage.
+            -ENOENT if the mapping was not found.
+ =========================================================================== **/
+int Frost_arenaHugePages(const arena_t *arena, size_t *bytes)
+{
+    /*< Variable Declarations >*/
+    int ret                 = -ENOENT;
+    FILE *smaps             = NULL;
+    char line[256]          = { 0 };
+    uintptr_t low           = 0u;
+    uintptr_t high          = 0u;
+    unsigned long kib       = 0u;
+    bool inside             = false;
+
+    /*< Security Checks >*/
+    if ( (arena == NULL) || (bytes == NULL) )
+    {
+        LOG_ERROR("Arena entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    *bytes = 0u;
+
+    /*< Start Function Algorithm >*/
+    smaps = fopen("/proc/self/smaps", "r");
+    if (smaps == NULL)
+    {
+        ret = -ENOTSUP;
+        goto end_of_function;
+    }
+
+    while (fgets(line, sizeof(line), smaps) != NULL)
+    {
+        if (sscanf(line, "%" SCNxPTR "-%" SCNxPTR " ", &low, &high) == 2)
+        {
+            inside = (low >= (uintptr_t)arena->base) &&
+                     (high <= (uintptr_t)arena->base + arena->reserved);
+
+            if (inside)
+            {
+                ret = FUNCTION_SUCESS;
+            }
+        }
+        else if ( (inside) && (sscanf(line, "AnonHugePages: %lu kB", &kib) == 1) )
+        {
+            *bytes += (size_t)kib * 1024u;
+        }
+    }
+
+    fclose(smaps);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_arenaAllocator
+  @package  Frost_Arena
+
+  @brief    Wraps an arena as a Frost allocator.
+
+  @param    arena     [in]:   Pointer to the arena.
+
+  @return   Allocator vtable backed by the arena.
+ =========================================================================== **/
+frost_allocator_t Frost_arenaAllocator(arena_t *arena)
+{
+    /*< Variable Declarations >*/
+    frost_allocator_t allocator_out =
+    {
+        .alloc      = Frost_arenaVtableAlloc,
+        .realloc    = Frost_arenaVtableRealloc,
+        .free       = Frost_arenaVtableFree,
+        .ctx        = arena,
+    };
+
+    /*< Function Output >*/
+    return allocator_out;
+}
+
+/*< end of file >*/
+/** @}*/
@@ -0,0 +1,195 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_Arena
+
+    @brief      This module provides bump-pointer arenas over large reserved
+                virtual ranges, optionally backed by transparent huge pages.
+
+    @file       arena.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Very large translation units keep hundreds of megabytes of
+                tokens, AST and IR alive, and with 4 KiB pages the TLB misses
+                show up in profiles. An arena reserves one big address range
+                up front with `mmap` (no memory is committed), aligned to the
+                huge page size. With ARENA_HUGE_PAGES it advises the kernel to
+                back the range with transparent huge pages. The range is then
+                committed lazily, ARENA_COMMIT_GRANULE at a time, as the bump
+                pointer advances. Frost_arenaAllocator wraps an arena as a
+                frost_allocator_t, so any subsystem can be pointed at it.
+
+    @note       - Memory is only released all at once, by Frost_arenaReset or
+                  Frost_freeArena; freeing individual blocks is a no-op.
+                - Allocation is lock-free and may be called from several
+                  threads; committing a new granule takes a short lock.
+                - Huge pages are advisory. Frost_arenaHugePages reports how
+                  much of the arena the kernel actually backed with them.
+ =========================================================================== **/
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+/*< Implements >*/
+#include "../allocator/allocator.h"
+
+/* ========================================================================== *\
+ *                              PUBLIC DEFINITIONS                            *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       ARENA_HUGE_PAGE_SIZE
+    @brief     Size of a transparent huge page, and alignment of arena bases.
+============================================================================ **/
+#define ARENA_HUGE_PAGE_SIZE        (2u * 1024u * 1024u)
+
+/** ============================================================================
+    @def       ARENA_COMMIT_GRANULE
+    @brief     Amount of address space made accessible at a time.
+============================================================================ **/
+#define ARENA_COMMIT_GRANULE        ARENA_HUGE_PAGE_SIZE
+
+/** ============================================================================
+    @def       ARENA_HUGE_PAGES
+    @brief     Frost_initArena flag: advise transparent huge pages.
+============================================================================ **/
+#define ARENA_HUGE_PAGES            (1u << 0)
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostArena
+  @package  Frost_Arena
+
+  @typedef  arena_t
+
+  @brief    Opaque handle to a reserved arena.
+============================================================================ **/
+typedef struct frostArena arena_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initArena
+  @package  Frost_Arena
+
+  @brief    Reserves the address range of a new arena.
+
+  @param    reserve   [in]:   Bytes of address space to reserve, rounded up
+                              to ARENA_HUGE_PAGE_SIZE.
+  @param    flags     [in]:   Zero or ARENA_HUGE_PAGES.
+
+  @return   Pointer to a newly created arena on success.
+            NULL if reserve is zero or the range cannot be mapped.
+ =========================================================================== **/
+arena_t *Frost_initArena(size_t reserve, unsigned int flags);
+
+/** ============================================================================
+  @fn       Frost_freeArena
+  @package  Frost_Arena
+
+  @brief    Unmaps the arena and every block allocated from it.
+
+  @param    arena     [in]:   Pointer to the arena to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the arena is NULL.
+ =========================================================================== **/
+int Frost_freeArena(arena_t *arena);
+
+/** ============================================================================
+  @fn       Frost_arenaAlloc
+  @package  Frost_Arena
+
+  @brief    Allocates a block by bumping the arena pointer.
+
+  @param    arena     [in]:   Pointer to the arena.
+  @param    size      [in]:   Number of bytes.
+  @param    alignment [in]:   Power of two alignment of the block.
+
+  @return   Pointer to uninitialized memory on success.
+            NULL if the arena is NULL, exhausted, or cannot commit memory.
+ =========================================================================== **/
+void *Frost_arenaAlloc(arena_t *arena, size_t size, size_t alignment);
+
+/** ============================================================================
+  @fn       Frost_arenaReset
+  @package  Frost_Arena
+
+  @brief    Releases every block at once, keeping the committed memory for
+            reuse.
+
+  @param    arena     [in]:   Pointer to the arena.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the arena is NULL.
+ =========================================================================== **/
+int Frost_arenaReset(arena_t *arena);
+
+/** ============================================================================
+  @fn       Frost_arenaUsage
+  @package  Frost_Arena
+
+  @brief    Returns how much of the arena is allocated and committed.
+
+  @param    arena     [in]:   Pointer to the arena.
+  @param    used      [out]:  Bytes handed out since the last reset, or NULL.
+  @param    committed [out]:  Bytes of address space committed, or NULL.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the arena is NULL.
+ =========================================================================== **/
+int Frost_arenaUsage(const arena_t *arena, size_t *used, size_t *committed);
+
+/** ============================================================================
+  @fn       Frost_arenaHugePages
+  @package  Frost_Arena
+
+  @brief    Reports how much of the arena is backed by huge pages.
+
+  @details  Reads the AnonHugePages field of the arena mapping in
+            /proc/self/smaps.
+
+  @param    arena     [in]:   Pointer to the arena.
+  @param    bytes     [out]:  Bytes of the arena backed by huge pages.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            -ENOTSUP if the platform does not report huge page usage.
+            -ENOENT if the mapping was not found.
+ =========================================================================== **/
+int Frost_arenaHugePages(const arena_t *arena, size_t *bytes);
+
+/** ============================================================================
+  @fn       Frost_arenaAllocator
+  @package  Frost_Arena
+
+  @brief    Wraps an arena as a Frost allocator.
+
+  @details  Allocations bump the arena, frees are no-ops, and reallocations
+            copy `old_size` bytes into a new block; since blocks carry no
+            size, resizing one with `old_size` zero returns NULL and keeps
+            it. The returned vtable holds the arena as its context; keep it
+            alive while it is installed.
+
+  @param    arena     [in]:   Pointer to the arena.
+
+  @return   Allocator vtable backed by the arena.
+ =========================================================================== **/
+frost_allocator_t Frost_arenaAllocator(arena_t *arena);
+
+#endif /* ARENA_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,325 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_Bracket
+
+    @package    Frost_Bracket
+    @brief      This module provides a bracket-match index over a token type
+                array, used to skip function bodies without parsing them.
+
+    @file       bracket.c
+    @headerfile bracket.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The six delimiter types, TOKEN_LEFT_PAREN to
+                TOKEN_RIGHT_BRACKET, are contiguous in token_type_t, so one
+                range check per lane tells whether a token is a delimiter.
+                The SIMD pass tests BRACKET_BLOCK tokens at a time (AVX2 when
+                available, SSE2 otherwise) and skips blocks without any
+                delimiter; only blocks with a hit go through the scalar
+                stack matcher. Targets without either instruction set use the
+                scalar path throughout.
+
+    @note       - Openers push their position on a stack; a closer matches
+                  the top only if it is the same kind of delimiter, otherwise
+                  it is left unmatched and the stack is kept.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    #include <immintrin.h>
+#endif
+
+/*< Implements >*/
+#include "bracket.h"
+#include "../allocator/allocator.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       BRACKET_BLOCK
+    @brief     Number of tokens tested per iteration of the SIMD pass.
+============================================================================ **/
+#define BRACKET_BLOCK               16u
+
+/** ============================================================================
+    @def       BRACKET_IS_DELIMITER(type)
+    @brief     Scalar range check matching the SIMD one.
+============================================================================ **/
+#define BRACKET_IS_DELIMITER(type)                                          \
+    ((uint32_t)((type) - TOKEN_LEFT_PAREN) <=                               \
+     (uint32_t)(TOKEN_RIGHT_BRACKET - TOKEN_LEFT_PAREN))
+
+_Static_assert(sizeof(token_type_t) == sizeof(int32_t),
+               "The SIMD pass loads token types as 32-bit lanes.");
+_Static_assert( (TOKEN_RIGHT_PAREN == TOKEN_LEFT_PAREN + 1) &&
+                (TOKEN_LEFT_BRACE == TOKEN_LEFT_PAREN + 2) &&
+                (TOKEN_RIGHT_BRACE == TOKEN_LEFT_PAREN + 3) &&
+                (TOKEN_LEFT_BRACKET == TOKEN_LEFT_PAREN + 4) &&
+                (TOKEN_RIGHT_BRACKET == TOKEN_LEFT_PAREN + 5),
+               "Delimiter token types must be contiguous and paired.");
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_bracketBlockHasDelimiter
+  @package  Frost_Bracket
+
+  @brief    Tells whether a block of BRACKET_BLOCK tokens holds a delimiter.
+
+  @param    types     [in]:   First token type of the block.
+
+  @return   Non-zero if at least one token of the block is a delimiter.
+ =========================================================================== **/
+static int Frost_bracketBlockHasDelimiter(const token_type_t *types)
+{
+    /*< Variable Declarations >*/
+    int ret = 0;
+
+    /*< Start Function Algorithm >*/
+#if defined(__AVX2__)
+    const __m256i low   = _mm256_set1_epi32((int)TOKEN_LEFT_PAREN - 1);
+    const __m256i high  = _mm256_set1_epi32((int)TOKEN_RIGHT_BRACKET + 1);
+    __m256i first       = _mm256_loadu_si256((const __m256i *)(const void *)&types[0]);
+    __m256i second      = _mm256_loadu_si256((const __m256i *)(const void *)&types[8]);
+
+    first   = _mm256_and_si256(_mm256_cmpgt_epi32(first, low), _mm256_cmpgt_epi32(high, first));
+    second  = _mm256_and_si256(_mm256_cmpgt_epi32(second, low), _mm256_cmpgt_epi32(high, second));
+    ret     = _mm256_movemask_epi8(_mm256_or_si256(first, second));
+#elif defined(__SSE2__)
+    const __m128i low   = _mm_set1_epi32((int)TOKEN_LEFT_PAREN - 1);
+    const __m128i high  = _mm_set1_epi32((int)TOKEN_RIGHT_BRACKET + 1);
+    __m128i hits        = _mm_setzero_si128();
+    __m128i lane        = _mm_setzero_si128();
+    size_t step         = 0u;
+
+    for (step = 0u; step < BRACKET_BLOCK; step += 4u)
+    {
+        lane = _mm_loadu_si128((const __m128i *)(const void *)&types[step]);
+        hits = _mm_or_si128(hits, _mm_and_si128(_mm_cmpgt_epi32(lane, low),
+                                                _mm_cmpgt_epi32(high, lane)));
+    }
+
+    ret = _mm_movemask_epi8(hits);
+#else
+    size_t step = 0u;
+
+    for (step = 0u; step < BRACKET_BLOCK; step++)
+    {
+        ret |= BRACKET_IS_DELIMITER(types[step]);
+    }
+#endif
+
+    /*< Function Output >*/
+    return ret;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initBracketIndex
+  @package  Frost_Bracket
+
+  @brief    Builds the bracket-match index of a token type array.
+
+  @param    types     [in]:   Type of every token, in source order.
+  @param    count     [in]:   Number of entries in types.
+
+  @return   Pointer to a newly created index on success.
+            NULL if types is NULL or memory allocation fails.
+ =========================================================================== **/
+bracket_index_t *Frost_initBracketIndex(const token_type_t *types, size_t count)
+{
+    /*< Variable Declarations >*/
+    bracket_index_t *index_out  = NULL;
+    size_t *stack               = NULL;
+    size_t depth                = 0u;
+    size_t block                = 0u;
+    size_t position             = 0u;
+    size_t limit                = 0u;
+
+    /*< Security Checks >*/
+    if (types == NULL)
+    {
+        LOG_ERROR("Token types entry point is NULL.");
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    index_out = (bracket_index_t *)Frost_memCalloc(1u, sizeof(bracket_index_t), FROST_MEM_BRACKET);
+    if (index_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for bracket index.");
+        goto end_of_function;
+    }
+
+    index_out->match    = (size_t *)Frost_memAlloc((count + 1u) * sizeof(size_t), FROST_MEM_BRACKET);
+    stack               = (size_t *)Frost_memAlloc((count + 1u) * sizeof(size_t), FROST_MEM_BRACKET);
+    if ( (index_out->match == NULL) || (stack == NULL) )
+    {
+        LOG_ERROR("Memory allocation failed for bracket index entries.");
+        Frost_memFree(stack, (count + 1u) * sizeof(size_t), FROST_MEM_BRACKET);
+        Frost_memFree(index_out->match, (count + 1u) * sizeof(size_t), FROST_MEM_BRACKET);
+        Frost_memFree(index_out, sizeof(bracket_index_t), FROST_MEM_BRACKET);
+        index_out = NULL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    index_out->count = count;
+    memset(index_out->match, 0xFF, count * sizeof(size_t));
+
+    for (block = 0u; block < count; block += BRACKET_BLOCK)
+    {
+        limit = MIN(block + BRACKET_BLOCK, count);
+
+        if ( (limit - block == BRACKET_BLOCK) &&
+             (!Frost_bracketBlockHasDelimiter(&types[block])) )
+        {
+            continue;
+        }
+
+        for (position = block; position < limit; position++)
+        {
+            token_type_t type = types[position];
+
+            if (!BRACKET_IS_DELIMITER(type))
+            {
+                continue;
+            }
+
+            if (((type - TOKEN_LEFT_PAREN) & 1u) == 0u)
+            {
+                stack[depth++] = position;
+            }
+            else if ( (depth > 0u) && (types[stack[depth - 1u]] == (token_type_t)(type - 1)) )
+            {
+                depth--;
+                index_out->match[stack[depth]]  = position;
+                index_out->match[position]      = stack[depth];
+            }
+        }
+    }
+
+    Frost_memFree(stack, (count + 1u) * sizeof(size_t), FROST_MEM_BRACKET);
+
+    /*< Function Output >*/
+end_of_function:
+    return index_out;
+}
+
+/** ============================================================================
+  @fn       Frost_freeBracketIndex
+  @package  Frost_Bracket
+
+  @brief    Frees a bracket-match index.
+
+  @param    index     [in]:   Pointer to the index to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the index is NULL.
+ =========================================================================== **/
+int Frost_freeBracketIndex(bracket_index_t *index)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (index == NULL)
+    {
+        LOG_ERROR("Bracket index entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_memFree(index->match, (index->count + 1u) * sizeof(size_t), FROST_MEM_BRACKET);
+    Frost_memFree(index, sizeof(bracket_index_t), FROST_MEM_BRACKET);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_bracketMatch
+  @package  Frost_Bracket
+
+  @brief    Returns the partner of a delimiter token.
+
+  @param    index     [in]:   Pointer to the index.
+  @param    position  [in]:   Position of the delimiter token.
+
+  @return   Position of the matching delimiter.
+            BRACKET_NO_MATCH if the token has no partner or is out of range.
+ =========================================================================== **/
+size_t Frost_bracketMatch(const bracket_index_t *index, size_t position)
+{
+    return ( (index != NULL) && (position < index->count) ) ?
+           index->match[position] : BRACKET_NO_MATCH;
+}
+
+/** ============================================================================
+  @fn       Frost_bracketSkipBody
+  @package  Frost_Bracket
+
+  @brief    Skips a braced body and records its range for later parsing.
+
+  @param    index     [in]:   Pointer to the index.
+  @param    open      [in]:   Position of the body's TOKEN_LEFT_BRACE.
+  @param    body      [out]:  Range of the skipped body.
+
+  @return   FUNCTION_SUCCESS on success, the parser resumes at body->close + 1.
+            -ENOMEM if a pointer argument is NULL.
+            -EINVAL if open is not an opening delimiter with a partner.
+ =========================================================================== **/
+int Frost_bracketSkipBody(const bracket_index_t *index, size_t open, lazy_body_t *body)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    size_t close    = BRACKET_NO_MATCH;
+
+    /*< Security Checks >*/
+    if ( (index == NULL) || (body == NULL) )
+    {
+        LOG_ERROR("Bracket index entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    close = Frost_bracketMatch(index, open);
+    if ( (close == BRACKET_NO_MATCH) || (close < open) )
+    {
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    body->open  = open;
+    body->close = close;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
+/** @}*/
@@ -0,0 +1,149 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_Bracket
+
+    @brief      This module provides a bracket-match index over a token type
+                array, used to skip function bodies without parsing them.
+
+    @file       bracket.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Header-heavy and IDE workloads rarely need the contents of
+                function bodies. Given the types of every token of a file, the
+                bracket index records, for each opening and closing paren,
+                brace and bracket, the position of its partner. The parser
+                can then jump from a body's TOKEN_LEFT_BRACE straight past its
+                TOKEN_RIGHT_BRACE, keep the token range in a lazy_body_t, and
+                parse it only if the body is ever needed. The index is built
+                with a SIMD pass that discards whole blocks of tokens holding
+                no delimiter before the stack-based matching runs.
+
+    @note       - Mismatched or unbalanced delimiters have no partner
+                  (BRACKET_NO_MATCH); the parser reports those errors.
+ =========================================================================== **/
+
+#ifndef BRACKET_H_
+#define BRACKET_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+
+/*< Implements >*/
+#include "../token/token.h"
+
+/* ========================================================================== *\
+ *                              PUBLIC DEFINITIONS                            *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       BRACKET_NO_MATCH
+    @brief     Partner of a token that is not a delimiter, or has no match.
+============================================================================ **/
+#define BRACKET_NO_MATCH            SIZE_MAX
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostBracketIndex
+  @package  Frost_Bracket
+
+  @typedef  bracket_index_t
+
+  @brief    Partner position of every delimiter token of a file.
+============================================================================ **/
+typedef struct frostBracketIndex
+{
+    size_t      *match;             /*< Partner of each token, or BRACKET_NO_MATCH >*/
+    size_t      count;              /*< Number of tokens indexed >*/
+} bracket_index_t;
+
+/** ============================================================================
+  @struct   frostLazyBody
+  @package  Frost_Bracket
+
+  @typedef  lazy_body_t
+
+  @brief    Token range of a skipped body, kept for parsing on demand.
+
+  @details  `open` and `close` are the positions of the braces; the body
+            proper is the half-open range [open + 1, close).
+============================================================================ **/
+typedef struct frostLazyBody
+{
+    size_t      open;               /*< Position of the TOKEN_LEFT_BRACE >*/
+    size_t      close;              /*< Position of the matching TOKEN_RIGHT_BRACE >*/
+} lazy_body_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initBracketIndex
+  @package  Frost_Bracket
+
+  @brief    Builds the bracket-match index of a token type array.
+
+  @param    types     [in]:   Type of every token, in source order.
+  @param    count     [in]:   Number of entries in types.
+
+  @return   Pointer to a newly created index on success.
+            NULL if types is NULL or memory allocation fails.
+ =========================================================================== **/
+bracket_index_t *Frost_initBracketIndex(const token_type_t *types, size_t count);
+
+/** ============================================================================
+  @fn       Frost_freeBracketIndex
+  @package  Frost_Bracket
+
+  @brief    Frees a bracket-match index.
+
+  @param    index     [in]:   Pointer to the index to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the index is NULL.
+ =========================================================================== **/
+int Frost_freeBracketIndex(bracket_index_t *index);
+
+/** ============================================================================
+  @fn       Frost_bracketMatch
+  @package  Frost_Bracket
+
+  @brief    Returns the partner of a delimiter token.
+
+  @param    index     [in]:   Pointer to the index.
+  @param    position  [in]:   Position of the delimiter token.
+
+  @return   Position of the matching delimiter.
+            BRACKET_NO_MATCH if the token has no partner or is out of range.
+ =========================================================================== **/
+size_t Frost_bracketMatch(const bracket_index_t *index, size_t position);
+
+/** ============================================================================
+  @fn       Frost_bracketSkipBody
+  @package  Frost_Bracket
+
+  @brief    Skips a braced body and records its range for later parsing.
+
+  @param    index     [in]:   Pointer to the index.
+  @param    open      [in]:   Position of the body's TOKEN_LEFT_BRACE.
+  @param    body      [out]:  Range of the skipped body.
+
+  @return   FUNCTION_SUCCESS on success, the parser resumes at body->close + 1.
+            -ENOMEM if a pointer argument is NULL.
+            -EINVAL if open is not an opening delimiter with a partner.
+ =========================================================================== **/
+int Frost_bracketSkipBody(const bracket_index_t *index, size_t open, lazy_body_t *body);
+
+#endif /* BRACKET_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,825 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_CompileCache
+
+    @package    Frost_CompileCache
+    @brief      This module provides an on-disk compile cache keyed by the
+                significant token stream of a translation unit.
+
+    @file       compile_cache.c
+    @headerfile compile_cache.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The fingerprint runs two 64-bit multiplicative lanes over the
+                bytes (one of them FNV-1a) and finishes both with the
+                splitmix64 avalanche, folding in the total length. Each token
+                is framed as type, length and bytes, so no two different token
+                streams feed the same byte sequence.
+
+                An entry is `<dir>/<first two hex digits>/<other 30 digits>`
+                and starts with a cache_entry_header_t repeating the key and
+                the payload size. Lookups reject entries whose header does not
+                match, so a file from another format version, or a truncated
+                one left by a crashed copy tool, reads as a miss.
+
+    @note       - Entries are not fsync'ed: after a power loss an entry may
+                  be missing or read as damaged, which is only a miss.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+
+/*< Implements >*/
+#include "compile_cache.h"
+#include "../lexer/lexer.h"
+#include "../allocator/allocator.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       CACHE_MAGIC
+    @brief     First bytes of every cache entry.
+============================================================================ **/
+#define CACHE_MAGIC                 "FRCC"
+
+/** ============================================================================
+    @def       CACHE_VERSION
+    @brief     Entry format version; bump it to orphan every existing entry.
+============================================================================ **/
+#define CACHE_VERSION               1u
+
+/** ============================================================================
+    @def       CACHE_FNV_OFFSET
+    @brief     Initial value of the FNV-1a lane.
+============================================================================ **/
+#define CACHE_FNV_OFFSET            UINT64_C(0xcbf29ce484222325)
+
+/** ============================================================================
+    @def       CACHE_FNV_PRIME
+    @brief     Multiplier of the FNV-1a lane.
+============================================================================ **/
+#define CACHE_FNV_PRIME             UINT64_C(0x00000100000001b3)
+
+/** ============================================================================
+    @def       CACHE_GOLDEN
+    @brief     Multiplier of the second lane (2^64 divided by the golden ratio).
+============================================================================ **/
+#define CACHE_GOLDEN                UINT64_C(0x9e3779b97f4a7c15)
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostCacheEntryHeader
+  @package  Frost_CompileCache
+
+  @typedef  cache_entry_header_t
+
+  @brief    Header written before the object in every entry.
+============================================================================ **/
+typedef struct frostCacheEntryHeader
+{
+    char                magic[4];       /*< CACHE_MAGIC, not terminated >*/
+    uint32_t            version;        /*< CACHE_VERSION >*/
+    cache_key_t         key;            /*< Key the entry was stored under >*/
+    uint64_t            size;           /*< Bytes of object after the header >*/
+} cache_entry_header_t;
+
+/** ============================================================================
+  @struct   frostCompileCache
+  @package  Frost_CompileCache
+
+  @brief    Cache directory handle.
+============================================================================ **/
+struct frostCompileCache
+{
+    char                *directory;     /*< Path of the cache directory >*/
+    size_t              length;         /*< strlen(directory) >*/
+};
+
+/** ============================================================================
+  @struct   frostCacheTokens
+  @package  Frost_CompileCache
+
+  @typedef  cache_tokens_t
+
+  @brief    Context of the token callback of Frost_cacheFingerprint.
+============================================================================ **/
+typedef struct frostCacheTokens
+{
+    cache_hasher_t      hasher;         /*< Fingerprint being built >*/
+    const char          *source;        /*< Source the offsets refer to >*/
+} cache_tokens_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Sequence number making temporary file names unique in the process >*/
+static atomic_uint cache_temp_sequence = 0u;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_cacheMix
+  @package  Frost_CompileCache
+
+  @brief    splitmix64 finalizer: spreads every input bit over the output.
+
+  @param    value     [in]:   Value to mix.
+
+  @return   Mixed value.
+ =========================================================================== **/
+static uint64_t Frost_cacheMix(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= UINT64_C(0xbf58476d1ce4e5b9);
+    value ^= value >> 27;
+    value *= UINT64_C(0x94d049bb133111eb);
+    value ^= value >> 31;
+
+    return value;
+}
+
+/** ============================================================================
+  @fn       Frost_cacheOnToken
+  @package  Frost_CompileCache
+
+  @brief    Token callback of Frost_cacheFingerprint.
+
+  @return   FUNCTION_SUCCESS, so that lexing continues.
+ =========================================================================== **/
+static int Frost_cacheOnToken(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    /*< Variable Declarations >*/
+    cache_tokens_t *tokens  = (cache_tokens_t *)ctx;
+    uint32_t type_value     = (uint32_t)type;
+    uint64_t length_value   = (uint64_t)length;
+
+    /*< Start Function Algorithm >*/
+    if ( (type != TOKEN_COMMENT) && (type != TOKEN_EOF) )
+    {
+        Frost_cacheHashBytes(&tokens->hasher, &type_value, sizeof(type_value));
+        Frost_cacheHashBytes(&tokens->hasher, &length_value, sizeof(length_value));
+        Frost_cacheHashBytes(&tokens->hasher, tokens->source + offset, length);
+    }
+
+    /*< Function Output >*/
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Frost_cachePath
+  @package  Frost_CompileCache
+
+  @brief    Builds the path of an entry, or of its fan-out directory.
+
+  @param    cache     [in]:   Pointer to the cache handle.
+  @param    key       [in]:   Cache key.
+  @param    directory [in]:   Stop after the fan-out directory.
+  @param    path      [out]:  Buffer of PATH_MAX bytes.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENAMETOOLONG if the path does not fit.
+ =========================================================================== **/
+static int Frost_cachePath(const compile_cache_t *cache, cache_key_t key, bool directory,
+                           char path[PATH_MAX])
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCESS;
+    char hex[CACHE_KEY_HEX_SIZE]    = { 0 };
+    int written                     = 0;
+
+    /*< Start Function Algorithm >*/
+    Frost_cacheKeyHex(key, hex);
+
+    written = directory ?
+              snprintf(path, PATH_MAX, "%s/%.2s", cache->directory, hex) :
+              snprintf(path, PATH_MAX, "%s/%.2s/%s", cache->directory, hex, &hex[2]);
+
+    if ( (written < 0) || (written >= PATH_MAX) )
+    {
+        LOG_ERROR("Cache entry path is too long.");
+        ret = -ENAMETOOLONG;
+    }
+
+    /*< Function Output >*/
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_cacheReadFull
+  @package  Frost_CompileCache
+
+  @brief    Reads exactly size bytes from a descriptor.
+
+  @param    fd        [in]:   Descriptor to read from.
+  @param    buffer    [out]:  Destination buffer.
+  @param    size      [in]:   Number of bytes to read.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOENT on premature end of file, or a negative errno value.
+ =========================================================================== **/
+static int Frost_cacheReadFull(int fd, void *buffer, size_t size)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    size_t done     = 0u;
+    ssize_t count   = 0;
+
+    /*< Start Function Algorithm >*/
+    while (done < size)
+    {
+        count = read(fd, (char *)buffer + done, size - done);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            ret = -errno;
+            goto end_of_function;
+        }
+
+        if (count == 0)
+        {
+            ret = -ENOENT;
+            goto end_of_function;
+        }
+
+        done += (size_t)count;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_cacheWriteFull
+  @package  Frost_CompileCache
+
+  @brief    Writes exactly size bytes to a descriptor.
+
+  @param    fd        [in]:   Descriptor to write to.
+  @param    buffer    [in]:   Source buffer.
+  @param    size      [in]:   Number of bytes to write.
+
+  @return   FUNCTION_SUCCESS on success, or a negative errno value.
+ =========================================================================== **/
+static int Frost_cacheWriteFull(int fd, const void *buffer, size_t size)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    size_t done     = 0u;
+    ssize_t count   = 0;
+
+    /*< Start Function Algorithm >*/
+    while (done < size)
+    {
+        count = write(fd, (const char *)buffer + done, size - done);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            ret = -errno;
+            goto end_of_function;
+        }
+
+        done += (size_t)count;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_cacheHashInit
+  @package  Frost_CompileCache
+
+  @brief    Starts a fingerprint.
+
+  @param    hasher    [out]:  State to initialize.
+ =========================================================================== **/
+void Frost_cacheHashInit(cache_hasher_t *hasher)
+{
+    hasher->a       = CACHE_FNV_OFFSET;
+    hasher->b       = CACHE_GOLDEN;
+    hasher->length  = 0u;
+}
+
+/** ============================================================================
+  @fn       Frost_cacheHashBytes
+  @package  Frost_CompileCache
+
+  @brief    Feeds bytes to a fingerprint.
+
+  @param    hasher    [in]:   State to update.
+  @param    data      [in]:   Bytes to hash.
+  @param    size      [in]:   Number of bytes.
+ =========================================================================== **/
+void Frost_cacheHashBytes(cache_hasher_t *hasher, const void *data, size_t size)
+{
+    /*< Variable Declarations >*/
+    const unsigned char *bytes  = (const unsigned char *)data;
+    uint64_t a                  = hasher->a;
+    uint64_t b                  = hasher->b;
+    size_t index                = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < size; index++)
+    {
+        a = (a ^ bytes[index]) * CACHE_FNV_PRIME;
+        b = ((b ^ bytes[index]) * CACHE_GOLDEN) ^ (b >> 29);
+    }
+
+    hasher->a        = a;
+    hasher->b        = b;
+    hasher->length  += size;
+}
+
+/** ============================================================================
+  @fn       Frost_cacheHashFinish
+  @package  Frost_CompileCache
+
+  @brief    Returns the fingerprint of everything fed so far.
+
+  @param    hasher    [in]:   State to read; it is left unchanged.
+
+  @return   The 128-bit fingerprint.
+ =========================================================================== **/
+cache_key_t Frost_cacheHashFinish(const cache_hasher_t *hasher)
+{
+    /*< Variable Declarations >*/
+    cache_key_t key_out = { 0u };
+
+    /*< Start Function Algorithm >*/
+    key_out.lo = Frost_cacheMix(hasher->a ^ hasher->length);
+    key_out.hi = Frost_cacheMix(hasher->b ^ (key_out.lo * CACHE_GOLDEN));
+
+    /*< Function Output >*/
+    return key_out;
+}
+
+/** ============================================================================
+  @fn       Frost_cacheFingerprint
+  @package  Frost_CompileCache
+
+  @brief    Fingerprints the significant token stream of a source.
+
+  @param    source    [in]:   Source buffer, not necessarily NUL-terminated.
+  @param    size      [in]:   Number of bytes of source.
+  @param    out       [out]:  Fingerprint of the source.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+ =========================================================================== **/
+int Frost_cacheFingerprint(const char *source, size_t size, cache_key_t *out)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCESS;
+    lexer_t *lexer          = NULL;
+    cache_tokens_t tokens   = { 0 };
+
+    /*< Security Checks >*/
+    if ( (source == NULL) || (out == NULL) )
+    {
+        LOG_ERROR("Fingerprint entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    lexer = Frost_initLexerView(source, size);
+    if (lexer == NULL)
+    {
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_cacheHashInit(&tokens.hasher);
+    tokens.source = source;
+
+    ret = Frost_lexStructural(lexer, Frost_cacheOnToken, &tokens);
+    if (ret == FUNCTION_SUCESS)
+    {
+        *out = Frost_cacheHashFinish(&tokens.hasher);
+    }
+
+    (void)Frost_freeLexer(lexer);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_cacheKey
+  @package  Frost_CompileCache
+
+  @brief    Combines a source fingerprint, the flags and the dependency
+            fingerprints into a cache key.
+
+  @param    source    [in]:   Fingerprint of the translation unit.
+  @param    flags     [in]:   Compiler identity and flags, or NULL.
+  @param    deps      [in]:   Fingerprints of the dependencies, in a stable
+                              order, or NULL if dep_count is zero.
+  @param    dep_count [in]:   Number of entries in deps.
+  @param    out       [out]:  Cache key.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if out is NULL, or deps is NULL with dep_count non-zero.
+ =========================================================================== **/
+int Frost_cacheKey(cache_key_t source, const char *flags, const cache_key_t *deps,
+                   size_t dep_count, cache_key_t *out)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCESS;
+    cache_hasher_t hasher   = { 0u };
+    uint64_t field          = 0u;
+    size_t index            = 0u;
+
+    /*< Security Checks >*/
+    if ( (out == NULL) || ((deps == NULL) && (dep_count != 0u)) )
+    {
+        LOG_ERROR("Cache key entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_cacheHashInit(&hasher);
+    Frost_cacheHashBytes(&hasher, &source, sizeof(source));
+
+    field = (flags != NULL) ? (uint64_t)strlen(flags) : 0u;
+    Frost_cacheHashBytes(&hasher, &field, sizeof(field));
+    Frost_cacheHashBytes(&hasher, (flags != NULL) ? flags : "", (size_t)field);
+
+    field = (uint64_t)dep_count;
+    Frost_cacheHashBytes(&hasher, &field, sizeof(field));
+
+    for (index = 0u; index < dep_count; index++)
+    {
+        Frost_cacheHashBytes(&hasher, &deps[index], sizeof(deps[index]));
+    }
+
+    *out = Frost_cacheHashFinish(&hasher);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_cacheKeyHex
+  @package  Frost_CompileCache
+
+  @brief    Prints a key as 32 lower-case hexadecimal digits.
+
+  @param    key       [in]:   Key to print.
+  @param    out       [out]:  Buffer of CACHE_KEY_HEX_SIZE bytes.
+ =========================================================================== **/
+void Frost_cacheKeyHex(cache_key_t key, char out[CACHE_KEY_HEX_SIZE])
+{
+    /*< Variable Declarations >*/
+    static const char digits[] = "0123456789abcdef";
+    size_t index               = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < 16u; index++)
+    {
+        out[index]          = digits[(key.hi >> (60u - (4u * index))) & 0xFu];
+        out[index + 16u]    = digits[(key.lo >> (60u - (4u * index))) & 0xFu];
+    }
+
+    out[CACHE_KEY_HEX_SIZE - 1u] = '\0';
+}
+
+/** ============================================================================
+  @fn       Frost_initCompileCache
+  @package  Frost_CompileCache
+
+  @brief    Opens a cache directory, creating it if needed.
+
+  @param    directory [in]:   Path of the cache directory.
+
+  @return   Pointer to a new cache handle on success.
+            NULL if the directory cannot be created or allocation fails.
+ =========================================================================== **/
+compile_cache_t *Frost_initCompileCache(const char *directory)
+{
+    /*< Variable Declarations >*/
+    compile_cache_t *cache_out  = NULL;
+    struct stat info            = { 0 };
+
+    /*< Security Checks >*/
+    if (directory == NULL)
+    {
+        LOG_ERROR("Cache directory entry point is NULL.");
+        goto end_of_function;
+    }
+
+    if ( (mkdir(directory, 0755) != 0) && (errno != EEXIST) )
+    {
+        LOG_ERROR("Cannot create the cache directory.");
+        goto end_of_function;
+    }
+
+    if ( (stat(directory, &info) != 0) || (!S_ISDIR(info.st_mode)) )
+    {
+        LOG_ERROR("Cache path is not a directory.");
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    cache_out = (compile_cache_t *)Frost_memCalloc(1u, sizeof(compile_cache_t), FROST_MEM_CACHE);
+    if (cache_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for compile cache.");
+        goto end_of_function;
+    }
+
+    cache_out->directory = Frost_memStrdup(directory, FROST_MEM_CACHE);
+    if (cache_out->directory == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for compile cache directory.");
+        Frost_memFree(cache_out, sizeof(compile_cache_t), FROST_MEM_CACHE);
+        cache_out = NULL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    cache_out->length = strlen(directory);
+
+    /*< Function Output >*/
+end_of_function:
+    return cache_out;
+}
+
+/** ============================================================================
+  @fn       Frost_freeCompileCache
+  @package  Frost_CompileCache
+
+  @brief    Releases a cache handle. Entries on disk are kept.
+
+  @param    cache     [in]:   Pointer to the cache handle.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the cache is NULL.
+ =========================================================================== **/
+int Frost_freeCompileCache(compile_cache_t *cache)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (cache == NULL)
+    {
+        LOG_ERROR("Compile cache entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Free Memory >*/
+    Frost_memFree(cache->directory, cache->length + 1u, FROST_MEM_CACHE);
+    Frost_memFree(cache, sizeof(compile_cache_t), FROST_MEM_CACHE);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_compileCacheLookup
+  @package  Frost_CompileCache
+
+  @brief    Reads the object stored under a key.
+
+  @param    cache     [in]:   Pointer to the cache handle.
+  @param    key       [in]:   Cache key.
+  @param    data      [out]:  Object contents, freed by the caller with
+                              Frost_memFree(data, size, FROST_MEM_CACHE).
+  @param    size      [out]:  Number of bytes of the object.
+
+  @return   FUNCTION_SUCCESS on a hit.
+            -ENOENT on a miss, or if the entry is damaged.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            Negative errno value if the entry cannot be read.
+ =========================================================================== **/
+int Frost_compileCacheLookup(compile_cache_t *cache, cache_key_t key, void **data, size_t *size)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCESS;
+    char path[PATH_MAX]             = { 0 };
+    cache_entry_header_t header     = { { 0 }, 0u, { 0u, 0u }, 0u };
+    struct stat info                = { 0 };
+    void *object                    = NULL;
+    int fd                          = -1;
+
+    /*< Security Checks >*/
+    if ( (cache == NULL) || (data == NULL) || (size == NULL) )
+    {
+        LOG_ERROR("Compile cache entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    ret = Frost_cachePath(cache, key, false, path);
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto end_of_function;
+    }
+
+    /*< Open and Check the Entry >*/
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        ret = (errno == ENOENT) ? -ENOENT : -errno;
+        goto end_of_function;
+    }
+
+    if ( (fstat(fd, &info) != 0) || ((size_t)info.st_size < sizeof(header)) )
+    {
+        ret = -ENOENT;
+        goto close_file;
+    }
+
+    ret = Frost_cacheReadFull(fd, &header, sizeof(header));
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto close_file;
+    }
+
+    if ( (memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0) ||
+         (header.version != CACHE_VERSION) ||
+         (header.key.lo != key.lo) || (header.key.hi != key.hi) ||
+         (header.size != ((uint64_t)info.st_size - sizeof(header))) )
+    {
+        ret = -ENOENT;
+        goto close_file;
+    }
+
+    /*< Allocate Memory >*/
+    object = Frost_memAlloc(MAX((size_t)header.size, (size_t)1u), FROST_MEM_CACHE);
+    if (object == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for cached object.");
+        ret = -ENOMEM;
+        goto close_file;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Frost_cacheReadFull(fd, object, (size_t)header.size);
+    if (ret != FUNCTION_SUCESS)
+    {
+        Frost_memFree(object, MAX((size_t)header.size, (size_t)1u), FROST_MEM_CACHE);
+        goto close_file;
+    }
+
+    *data = object;
+    *size = (size_t)header.size;
+
+close_file:
+    close(fd);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_compileCacheStore
+  @package  Frost_CompileCache
+
+  @brief    Stores an object under a key, atomically replacing any entry.
+
+  @param    cache     [in]:   Pointer to the cache handle.
+  @param    key       [in]:   Cache key.
+  @param    data      [in]:   Object contents.
+  @param    size      [in]:   Number of bytes of the object.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            Negative errno value if the entry cannot be written.
+ =========================================================================== **/
+int Frost_compileCacheStore(compile_cache_t *cache, cache_key_t key, const void *data, size_t size)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCESS;
+    char path[PATH_MAX]             = { 0 };
+    char temp[PATH_MAX]             = { 0 };
+    cache_entry_header_t header     = { { 0 }, 0u, { 0u, 0u }, 0u };
+    int written                     = 0;
+    int fd                          = -1;
+
+    /*< Security Checks >*/
+    if ( (cache == NULL) || ((data == NULL) && (size != 0u)) )
+    {
+        LOG_ERROR("Compile cache entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Create the Fan-out Directory and a Private Temporary File >*/
+    ret = Frost_cachePath(cache, key, true, path);
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto end_of_function;
+    }
+
+    if ( (mkdir(path, 0755) != 0) && (errno != EEXIST) )
+    {
+        ret = -errno;
+        LOG_ERROR("Cannot create a cache fan-out directory.");
+        goto end_of_function;
+    }
+
+    written = snprintf(temp, sizeof(temp), "%s/.tmp.%ld.%u", path, (long)getpid(),
+                       atomic_fetch_add_explicit(&cache_temp_sequence, 1u, memory_order_relaxed));
+    if ( (written < 0) || ((size_t)written >= sizeof(temp)) )
+    {
+        ret = -ENAMETOOLONG;
+        goto end_of_function;
+    }
+
+    ret = Frost_cachePath(cache, key, false, path);
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto end_of_function;
+    }
+
+    fd = open(temp, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        ret = -errno;
+        LOG_ERROR("Cannot create a cache temporary file.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version  = CACHE_VERSION;
+    header.key      = key;
+    header.size     = (uint64_t)size;
+
+    ret = Frost_cacheWriteFull(fd, &header, sizeof(header));
+    if (ret == FUNCTION_SUCESS)
+    {
+        ret = Frost_cacheWriteFull(fd, data, size);
+    }
+
+    if ( (close(fd) != 0) && (ret == FUNCTION_SUCESS) )
+    {
+        ret = -errno;
+    }
+
+    /*< Publish: readers see the old entry or the complete new one >*/
+    if ( (ret == FUNCTION_SUCESS) && (rename(temp, path) != 0) )
+    {
+        ret = -errno;
+    }
+
+    if (ret != FUNCTION_SUCESS)
+    {
+        LOG_ERROR("Failed to write a cache entry.");
+        (void)unlink(temp);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
+/** @}*/
@@ -0,0 +1,250 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_CompileCache
+
+    @brief      This module provides an on-disk compile cache keyed by the
+                significant token stream of a translation unit.
+
+    @file       compile_cache.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    A byte hash of the source changes on every reformat or
+                comment edit. Here the key is a 128-bit fingerprint of the
+                tokens the lexer produces (type and lexeme of each token,
+                without whitespace and without TOKEN_COMMENT), combined with
+                the compiler flags and the fingerprints of the dependencies.
+                Reformatting a file or editing its comments keeps its key, so
+                the cached object is returned without compiling.
+
+                Entries live in a directory shared by every compiler process,
+                fanned out over 256 subdirectories. A store writes a private
+                temporary file and renames it over the final name, so readers
+                see a complete entry or none, and concurrent writers of the
+                same key simply replace each other with identical contents.
+
+    @note       - The fingerprint is not cryptographic. It guards a local
+                  cache against accidental collisions, not against crafted
+                  inputs.
+                - Changing the compiler must change the flags string (e.g.
+                  include the compiler version) to invalidate old entries.
+ =========================================================================== **/
+
+#ifndef COMPILE_CACHE_H_
+#define COMPILE_CACHE_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+
+/* ========================================================================== *\
+ *                              PUBLIC DEFINITIONS                            *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       CACHE_KEY_HEX_SIZE
+    @brief     Characters of a key printed in hexadecimal, terminator included.
+============================================================================ **/
+#define CACHE_KEY_HEX_SIZE          33u
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostCacheKey
+  @package  Frost_CompileCache
+
+  @typedef  cache_key_t
+
+  @brief    128-bit fingerprint.
+============================================================================ **/
+typedef struct frostCacheKey
+{
+    uint64_t            lo;             /*< Low 64 bits >*/
+    uint64_t            hi;             /*< High 64 bits >*/
+} cache_key_t;
+
+/** ============================================================================
+  @struct   frostCacheHasher
+  @package  Frost_CompileCache
+
+  @typedef  cache_hasher_t
+
+  @brief    Streaming state of a fingerprint.
+============================================================================ **/
+typedef struct frostCacheHasher
+{
+    uint64_t            a;              /*< First lane >*/
+    uint64_t            b;              /*< Second lane >*/
+    uint64_t            length;         /*< Bytes hashed so far >*/
+} cache_hasher_t;
+
+/** ============================================================================
+  @struct   frostCompileCache
+  @package  Frost_CompileCache
+
+  @typedef  compile_cache_t
+
+  @brief    Opaque handle to a cache directory.
+============================================================================ **/
+typedef struct frostCompileCache compile_cache_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_cacheHashInit
+  @package  Frost_CompileCache
+
+  @brief    Starts a fingerprint.
+
+  @param    hasher    [out]:  State to initialize.
+ =========================================================================== **/
+void Frost_cacheHashInit(cache_hasher_t *hasher);
+
+/** ============================================================================
+  @fn       Frost_cacheHashBytes
+  @package  Frost_CompileCache
+
+  @brief    Feeds bytes to a fingerprint.
+
+  @param    hasher    [in]:   State to update.
+  @param    data      [in]:   Bytes to hash.
+  @param    size      [in]:   Number of bytes.
+ =========================================================================== **/
+void Frost_cacheHashBytes(cache_hasher_t *hasher, const void *data, size_t size);
+
+/** ============================================================================
+  @fn       Frost_cacheHashFinish
+  @package  Frost_CompileCache
+
+  @brief    Returns the fingerprint of everything fed so far.
+
+  @param    hasher    [in]:   State to read; it is left unchanged.
+
+  @return   The 128-bit fingerprint.
+ =========================================================================== **/
+cache_key_t Frost_cacheHashFinish(const cache_hasher_t *hasher);
+
+/** ============================================================================
+  @fn       Frost_cacheFingerprint
+  @package  Frost_CompileCache
+
+  @brief    Fingerprints the significant token stream of a source.
+
+  @details  Lexes the source in place and hashes, for every token except
+            comments, its type, its length and its bytes. Whitespace never
+            reaches the hash.
+
+  @param    source    [in]:   Source buffer, not necessarily NUL-terminated.
+  @param    size      [in]:   Number of bytes of source.
+  @param    out       [out]:  Fingerprint of the source.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+ =========================================================================== **/
+int Frost_cacheFingerprint(const char *source, size_t size, cache_key_t *out);
+
+/** ============================================================================
+  @fn       Frost_cacheKey
+  @package  Frost_CompileCache
+
+  @brief    Combines a source fingerprint, the flags and the dependency
+            fingerprints into a cache key.
+
+  @param    source    [in]:   Fingerprint of the translation unit.
+  @param    flags     [in]:   Compiler identity and flags, or NULL.
+  @param    deps      [in]:   Fingerprints of the dependencies, in a stable
+                              order, or NULL if dep_count is zero.
+  @param    dep_count [in]:   Number of entries in deps.
+  @param    out       [out]:  Cache key.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if out is NULL, or deps is NULL with dep_count non-zero.
+ =========================================================================== **/
+int Frost_cacheKey(cache_key_t source, const char *flags, const cache_key_t *deps,
+                   size_t dep_count, cache_key_t *out);
+
+/** ============================================================================
+  @fn       Frost_cacheKeyHex
+  @package  Frost_CompileCache
+
+  @brief    Prints a key as 32 lower-case hexadecimal digits.
+
+  @param    key       [in]:   Key to print.
+  @param    out       [out]:  Buffer of CACHE_KEY_HEX_SIZE bytes.
+ =========================================================================== **/
+void Frost_cacheKeyHex(cache_key_t key, char out[CACHE_KEY_HEX_SIZE]);
+
+/** ============================================================================
+  @fn       Frost_initCompileCache
+  @package  Frost_CompileCache
+
+  @brief    Opens a cache directory, creating it if needed.
+
+  @param    directory [in]:   Path of the cache directory.
+
+  @return   Pointer to a new cache handle on success.
+            NULL if the directory cannot be created or allocation fails.
+ =========================================================================== **/
+compile_cache_t *Frost_initCompileCache(const char *directory);
+
+/** ============================================================================
+  @fn       Frost_freeCompileCache
+  @package  Frost_CompileCache
+
+  @brief    Releases a cache handle. Entries on disk are kept.
+
+  @param    cache     [in]:   Pointer to the cache handle.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the cache is NULL.
+ =========================================================================== **/
+int Frost_freeCompileCache(compile_cache_t *cache);
+
+/** ============================================================================
+  @fn       Frost_compileCacheLookup
+  @package  Frost_CompileCache
+
+  @brief    Reads the object stored under a key.
+
+  @param    cache     [in]:   Pointer to the cache handle.
+  @param    key       [in]:   Cache key.
+  @param    data      [out]:  Object contents, freed by the caller with
+                              Frost_memFree(data, size, FROST_MEM_CACHE).
+  @param    size      [out]:  Number of bytes of the object.
+
+  @return   FUNCTION_SUCCESS on a hit.
+            -ENOENT on a miss, or if the entry is damaged.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            Negative errno value if the entry cannot be read.
+ =========================================================================== **/
+int Frost_compileCacheLookup(compile_cache_t *cache, cache_key_t key, void **data, size_t *size);
+
+/** ============================================================================
+  @fn       Frost_compileCacheStore
+  @package  Frost_CompileCache
+
+  @brief    Stores an object under a key, atomically replacing any entry.
+
+  @param    cache     [in]:   Pointer to the cache handle.
+  @param    key       [in]:   Cache key.
+  @param    data      [in]:   Object contents.
+  @param    size      [in]:   Number of bytes of the object.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            Negative errno value if the entry cannot be written.
+ =========================================================================== **/
+int Frost_compileCacheStore(compile_cache_t *cache, cache_key_t key, const void *data, size_t size);
+
+#endif /* COMPILE_CACHE_H_ */
+
+/*< end of header file >*/
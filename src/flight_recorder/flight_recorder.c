@@ -0,0 +1,601 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_FlightRecorder
+
+    @package    Frost_FlightRecorder
+    @brief      This module keeps the last events of every thread in a small
+                ring and dumps them when the compiler crashes.
+
+    @file       flight_recorder.c
+    @headerfile flight_recorder.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Rings live in a static array, so the signal handler never
+                touches memory that may have been freed, and a crashed heap
+                cannot hide them. A thread claims a slot with one
+                compare-and-swap on its first event and caches it in a
+                thread-local pointer; a pthread key destructor gives the slot
+                back when the thread exits, leaving its last events in place
+                until another thread claims it. Recording an event is then a
+                thread-local load, three plain stores and an increment.
+
+                The dump only uses async-signal-safe calls: it formats each
+                line by hand into a stack buffer and emits it with write(2).
+
+    @note       - The handlers are installed with SA_RESETHAND and re-raise
+                  the signal, so core dumps and exit statuses are unchanged.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Feature Macros >*/
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE     /*< sigaction(), sigaltstack() and SA_ONSTACK >*/
+#endif
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/*< Implements >*/
+#include "flight_recorder.h"
+#include "../time_trace/time_trace.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       FLIGHT_LINE_SIZE
+    @brief     Size of the buffer one dump line is formatted into.
+============================================================================ **/
+#define FLIGHT_LINE_SIZE            160u
+
+/** ============================================================================
+    @def       FLIGHT_ALT_STACK_SIZE
+    @brief     Size of the alternate signal stack of the installing thread.
+============================================================================ **/
+#define FLIGHT_ALT_STACK_SIZE       (64u * 1024u)
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostFlightEntry
+  @package  Frost_FlightRecorder
+
+  @typedef  flight_entry_t
+
+  @brief    One recorded event.
+============================================================================ **/
+typedef struct frostFlightEntry
+{
+    uint64_t            value;          /*< Wide argument >*/
+    uint32_t            aux;            /*< Small argument >*/
+    uint32_t            event;          /*< flight_event_t >*/
+} flight_entry_t;
+
+/** ============================================================================
+  @struct   frostFlightRing
+  @package  Frost_FlightRecorder
+
+  @typedef  flight_ring_t
+
+  @brief    Event ring of one thread.
+============================================================================ **/
+typedef struct frostFlightRing
+{
+    flight_entry_t      entries[FLIGHT_RECORDER_EVENTS];    /*< Event storage >*/
+    uint64_t            count;                              /*< Events ever recorded >*/
+    char                file[FLIGHT_RECORDER_NAME_SIZE];    /*< Current file name >*/
+    atomic_bool         in_use;                             /*< Claimed by a live thread >*/
+} flight_ring_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Printable name of each event kind >*/
+static const char *const flight_event_names[FLIGHT_EVENT_COUNT] =
+{
+    [FLIGHT_EVENT_NONE]         = "none",
+    [FLIGHT_EVENT_TOKEN]        = "token",
+    [FLIGHT_EVENT_PHASE_BEGIN]  = "begin",
+    [FLIGHT_EVENT_PHASE_END]    = "end",
+    [FLIGHT_EVENT_SOURCE]       = "source",
+    [FLIGHT_EVENT_FILE]         = "file",
+};
+
+/*< Fatal signals that trigger a dump >*/
+static const int flight_signals[] = { SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT, SIGQUIT };
+
+/*< Rings of every thread, in static storage so the dump never faults >*/
+static flight_ring_t flight_rings[FLIGHT_RECORDER_THREADS];
+
+/*< Ring of the calling thread, and whether it already tried to claim one >*/
+static _Thread_local flight_ring_t *flight_self = NULL;
+static _Thread_local bool flight_claimed = false;
+
+/*< Key whose destructor releases the ring of an exiting thread >*/
+static pthread_key_t flight_key;
+static pthread_once_t flight_key_once = PTHREAD_ONCE_INIT;
+
+/*< Descriptor the signal handler dumps to >*/
+static volatile sig_atomic_t flight_fd = STDERR_FILENO;
+
+/*< Alternate signal stack of the installing thread >*/
+static char flight_alt_stack[FLIGHT_ALT_STACK_SIZE];
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_flightRelease
+  @package  Frost_FlightRecorder
+
+  @brief    Key destructor: releases the ring of an exiting thread.
+
+  @param    ring      [in]:   Ring owned by the thread.
+ =========================================================================== **/
+static void Frost_flightRelease(void *ring)
+{
+    atomic_store_explicit(&((flight_ring_t *)ring)->in_use, false, memory_order_release);
+}
+
+/** ============================================================================
+  @fn       Frost_flightCreateKey
+  @package  Frost_FlightRecorder
+
+  @brief    Creates the key releasing rings at thread exit, once.
+ =========================================================================== **/
+static void Frost_flightCreateKey(void)
+{
+    (void)pthread_key_create(&flight_key, Frost_flightRelease);
+}
+
+/** ============================================================================
+  @fn       Frost_flightClaim
+  @package  Frost_FlightRecorder
+
+  @brief    Claims a free ring for the calling thread.
+
+  @return   Pointer to the ring on success.
+            NULL if every ring is in use.
+ =========================================================================== **/
+static flight_ring_t *Frost_flightClaim(void)
+{
+    /*< Variable Declarations >*/
+    flight_ring_t *ring_out = NULL;
+    bool expected           = false;
+    size_t index            = 0u;
+
+    /*< Start Function Algorithm >*/
+    flight_claimed = true;
+    pthread_once(&flight_key_once, Frost_flightCreateKey);
+
+    for (index = 0u; index < FLIGHT_RECORDER_THREADS; index++)
+    {
+        expected = false;
+        if (atomic_compare_exchange_strong_explicit(&flight_rings[index].in_use, &expected, true,
+                                                    memory_order_acquire, memory_order_relaxed))
+        {
+            ring_out = &flight_rings[index];
+            break;
+        }
+    }
+
+    if (ring_out != NULL)
+    {
+        memset(ring_out->entries, 0, sizeof(ring_out->entries));
+        memset(ring_out->file, 0, sizeof(ring_out->file));
+        ring_out->count = 0u;
+
+        (void)pthread_setspecific(flight_key, ring_out);
+    }
+
+    flight_self = ring_out;
+
+    /*< Function Output >*/
+    return ring_out;
+}
+
+/** ============================================================================
+  @fn       Frost_flightAppend
+  @package  Frost_FlightRecorder
+
+  @brief    Appends text to a line buffer, truncating at its end.
+
+  @param    line      [in]:   Line buffer of FLIGHT_LINE_SIZE bytes.
+  @param    length    [in]:   Bytes already used.
+  @param    text      [in]:   NUL-terminated text.
+
+  @return   New number of bytes used.
+ =========================================================================== **/
+static size_t Frost_flightAppend(char *line, size_t length, const char *text)
+{
+    for (; (*text != '\0') && (length < FLIGHT_LINE_SIZE); text++)
+    {
+        line[length++] = *text;
+    }
+
+    return length;
+}
+
+/** ============================================================================
+  @fn       Frost_flightAppendNumber
+  @package  Frost_FlightRecorder
+
+  @brief    Appends an unsigned number to a line buffer.
+
+  @param    line      [in]:   Line buffer of FLIGHT_LINE_SIZE bytes.
+  @param    length    [in]:   Bytes already used.
+  @param    number    [in]:   Number to write.
+  @param    base      [in]:   10 or 16; base 16 is prefixed with "0x".
+
+  @return   New number of bytes used.
+ =========================================================================== **/
+static size_t Frost_flightAppendNumber(char *line, size_t length, uint64_t number, unsigned int base)
+{
+    /*< Variable Declarations >*/
+    char digits[24]     = { 0 };
+    size_t count        = sizeof(digits) - 1u;
+
+    /*< Start Function Algorithm >*/
+    do
+    {
+        digits[--count] = "0123456789abcdef"[number % base];
+        number         /= base;
+    } while ( (number != 0u) && (count > 0u) );
+
+    if (base == 16u)
+    {
+        length = Frost_flightAppend(line, length, "0x");
+    }
+
+    /*< Function Output >*/
+    return Frost_flightAppend(line, length, &digits[count]);
+}
+
+/** ============================================================================
+  @fn       Frost_flightWrite
+  @package  Frost_FlightRecorder
+
+  @brief    Writes a whole buffer, retrying on partial writes and EINTR.
+
+  @param    fd        [in]:   Output file descriptor.
+  @param    buffer    [in]:   Bytes to write.
+  @param    size      [in]:   Number of bytes.
+ =========================================================================== **/
+static void Frost_flightWrite(int fd, const char *buffer, size_t size)
+{
+    /*< Variable Declarations >*/
+    ssize_t count = 0;
+
+    /*< Start Function Algorithm >*/
+    while (size > 0u)
+    {
+        count = write(fd, buffer, size);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        buffer  += count;
+        size    -= (size_t)count;
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_flightDumpRing
+  @package  Frost_FlightRecorder
+
+  @brief    Writes the events of one ring, oldest first.
+
+  @param    fd        [in]:   Output file descriptor.
+  @param    ring      [in]:   Ring to dump.
+  @param    slot      [in]:   Index of the ring, shown as the thread number.
+  @param    current   [in]:   The ring belongs to the dumping thread.
+  @param    exited    [in]:   The ring was released by a thread that exited.
+ =========================================================================== **/
+static void Frost_flightDumpRing(int fd, const flight_ring_t *ring, size_t slot, bool current, bool exited)
+{
+    /*< Variable Declarations >*/
+    char line[FLIGHT_LINE_SIZE + 1u]    = { 0 };
+    const flight_entry_t *entry         = NULL;
+    uint64_t count                      = ring->count;
+    uint64_t index                      = 0u;
+    size_t length                       = 0u;
+
+    /*< Start Function Algorithm >*/
+    length = Frost_flightAppend(line, 0u, "--- thread ");
+    length = Frost_flightAppendNumber(line, length, slot, 10u);
+    length = Frost_flightAppend(line, length, current ? " (this thread)" : "");
+    length = Frost_flightAppend(line, length, exited ? " (exited)" : "");
+    length = Frost_flightAppend(line, length, ", file \"");
+    length = Frost_flightAppend(line, length, ring->file);
+    length = Frost_flightAppend(line, length, "\", ");
+    length = Frost_flightAppendNumber(line, length, count, 10u);
+    length = Frost_flightAppend(line, length, " events ---\n");
+    Frost_flightWrite(fd, line, length);
+
+    index = (count > FLIGHT_RECORDER_EVENTS) ? (count - FLIGHT_RECORDER_EVENTS) : 0u;
+    for (; index < count; index++)
+    {
+        entry  = &ring->entries[index & (FLIGHT_RECORDER_EVENTS - 1u)];
+        length = Frost_flightAppend(line, 0u, "  ");
+        length = Frost_flightAppend(line, length,
+                                    flight_event_names[(entry->event < FLIGHT_EVENT_COUNT) ?
+                                                       entry->event : FLIGHT_EVENT_NONE]);
+
+        switch (entry->event)
+        {
+            case FLIGHT_EVENT_TOKEN:
+                length = Frost_flightAppend(line, length, " type ");
+                length = Frost_flightAppendNumber(line, length, entry->aux, 10u);
+                length = Frost_flightAppend(line, length, " at offset ");
+                length = Frost_flightAppendNumber(line, length, entry->value, 10u);
+                break;
+
+            case FLIGHT_EVENT_PHASE_BEGIN:
+            case FLIGHT_EVENT_PHASE_END:
+                length = Frost_flightAppend(line, length, " ");
+                length = Frost_flightAppend(line, length,
+                                            Frost_tracePhaseName((trace_phase_t)entry->aux));
+                break;
+
+            case FLIGHT_EVENT_SOURCE:
+                length = Frost_flightAppend(line, length, " ");
+                length = Frost_flightAppendNumber(line, length, entry->value, 16u);
+                length = Frost_flightAppend(line, length, " size ");
+                length = Frost_flightAppendNumber(line, length, entry->aux, 10u);
+                break;
+
+            default:
+                break;
+        }
+
+        length = Frost_flightAppend(line, length, "\n");
+        Frost_flightWrite(fd, line, length);
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_flightHandler
+  @package  Frost_FlightRecorder
+
+  @brief    Fatal signal handler: dumps every ring and re-raises the signal.
+
+  @param    signal    [in]:   Signal number.
+ =========================================================================== **/
+static void Frost_flightHandler(int signal)
+{
+    /*< Variable Declarations >*/
+    char line[FLIGHT_LINE_SIZE + 1u]    = { 0 };
+    size_t length                       = 0u;
+    int saved_errno                     = errno;
+
+    /*< Start Function Algorithm >*/
+    length = Frost_flightAppend(line, 0u, "=== Frost flight recorder: signal ");
+    length = Frost_flightAppendNumber(line, length, (uint64_t)signal, 10u);
+    length = Frost_flightAppend(line, length, " ===\n");
+    Frost_flightWrite((int)flight_fd, line, length);
+
+    (void)Frost_flightRecorderDump((int)flight_fd);
+
+    errno = saved_errno;
+    (void)raise(signal);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_flightRecord
+  @package  Frost_FlightRecorder
+
+  @brief    Appends an event to the ring of the calling thread.
+
+  @param    event     [in]:   Kind of event.
+  @param    aux       [in]:   Small argument, see flight_event_t.
+  @param    value     [in]:   Wide argument, see flight_event_t.
+ =========================================================================== **/
+void Frost_flightRecord(flight_event_t event, uint32_t aux, uint64_t value)
+{
+    /*< Variable Declarations >*/
+    flight_ring_t *ring     = flight_self;
+    flight_entry_t *entry   = NULL;
+
+    /*< Security Checks >*/
+    if (ring == NULL)
+    {
+        if (flight_claimed)
+        {
+            goto end_of_function;
+        }
+
+        ring = Frost_flightClaim();
+        if (ring == NULL)
+        {
+            goto end_of_function;
+        }
+    }
+
+    /*< Start Function Algorithm >*/
+    entry           = &ring->entries[ring->count & (FLIGHT_RECORDER_EVENTS - 1u)];
+    entry->value    = value;
+    entry->aux      = aux;
+    entry->event    = (uint32_t)event;
+    ring->count++;
+
+    /*< Function Output >*/
+end_of_function:
+    return;
+}
+
+/** ============================================================================
+  @fn       Frost_flightRecordFile
+  @package  Frost_FlightRecorder
+
+  @brief    Sets the current file name of the calling thread and records a
+            FLIGHT_EVENT_FILE.
+
+  @param    name      [in]:   File name, copied up to FLIGHT_RECORDER_NAME_SIZE
+                              - 1 bytes. NULL is ignored.
+ =========================================================================== **/
+void Frost_flightRecordFile(const char *name)
+{
+    /*< Variable Declarations >*/
+    size_t length = 0u;
+
+    /*< Security Checks >*/
+    if (name == NULL)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_flightRecord(FLIGHT_EVENT_FILE, 0u, 0u);
+
+    if (flight_self != NULL)
+    {
+        length = strnlen(name, FLIGHT_RECORDER_NAME_SIZE - 1u);
+        memcpy(flight_self->file, name, length);
+        flight_self->file[length] = '\0';
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return;
+}
+
+/** ============================================================================
+  @fn       Frost_flightRecorderInstall
+  @package  Frost_FlightRecorder
+
+  @brief    Installs the signal handlers that dump the rings.
+
+  @details  Also gives the calling thread an alternate signal stack, so a
+            stack overflow on it can still be reported.
+
+  @param    fd        [in]:   File descriptor receiving the dump, e.g.
+                              STDERR_FILENO.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EINVAL if fd is negative.
+            Negative errno value if a handler cannot be installed.
+ =========================================================================== **/
+int Frost_flightRecorderInstall(int fd)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCESS;
+    struct sigaction action = { 0 };
+    stack_t stack           = { 0 };
+    size_t index            = 0u;
+
+    /*< Security Checks >*/
+    if (fd < 0)
+    {
+        LOG_ERROR("Invalid flight recorder descriptor.");
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    flight_fd = fd;
+
+    stack.ss_sp     = flight_alt_stack;
+    stack.ss_size   = sizeof(flight_alt_stack);
+    if (sigaltstack(&stack, NULL) != 0)
+    {
+        LOG_WARNING("No alternate signal stack; stack overflows will not be reported.");
+    }
+
+    action.sa_handler   = Frost_flightHandler;
+    action.sa_flags     = SA_RESETHAND | SA_ONSTACK;
+    sigemptyset(&action.sa_mask);
+
+    for (index = 0u; index < (sizeof(flight_signals) / sizeof(flight_signals[0])); index++)
+    {
+        if (sigaction(flight_signals[index], &action, NULL) != 0)
+        {
+            ret = -errno;
+            LOG_ERROR("Failed to install the flight recorder handler.");
+            goto end_of_function;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_flightRecorderDump
+  @package  Frost_FlightRecorder
+
+  @brief    Writes the rings of every thread. Async-signal-safe.
+
+  @details  Rings released by threads that exited still hold their last
+            events until another thread claims them, and are dumped too,
+            marked as exited.
+
+  @param    fd        [in]:   Output file descriptor.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EINVAL if fd is negative.
+ =========================================================================== **/
+int Frost_flightRecorderDump(int fd)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCESS;
+    const flight_ring_t *ring   = NULL;
+    size_t index                = 0u;
+    bool exited                 = false;
+
+    /*< Security Checks >*/
+    if (fd < 0)
+    {
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < FLIGHT_RECORDER_THREADS; index++)
+    {
+        ring    = &flight_rings[index];
+        exited  = !atomic_load_explicit(&ring->in_use, memory_order_acquire);
+
+        if ( (ring == flight_self) || (ring->count != 0u) )
+        {
+            Frost_flightDumpRing(fd, ring, index, (ring == flight_self), exited);
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
+/** @}*/
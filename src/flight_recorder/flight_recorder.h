@@ -0,0 +1,150 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_FlightRecorder
+
+    @brief      This module keeps the last events of every thread in a small
+                ring and dumps them when the compiler crashes.
+
+    @file       flight_recorder.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Recording is always on. Each thread writes its events (tokens
+                with their offsets, phase transitions, source and file
+                switches) into its own fixed-size ring with plain stores; the
+                oldest event is overwritten once the ring is full. After
+                Frost_flightRecorderInstall, a fatal signal (SIGSEGV, SIGBUS,
+                SIGILL, SIGFPE, SIGABRT) or SIGQUIT dumps the rings of every
+                thread with write(2), then lets the signal take its default
+                action. Sending SIGQUIT to a hung compiler shows where each of
+                its threads was.
+
+    @note       - At most FLIGHT_RECORDER_THREADS threads have a ring at a
+                  time; a slot is released when its thread exits, and keeps
+                  its last events, dumped as exited, until another thread
+                  claims it. Threads beyond that limit record nothing.
+                - The dump reads rings other threads may still be writing;
+                  it is best-effort post-mortem context, not a consistent
+                  snapshot.
+ =========================================================================== **/
+
+#ifndef FLIGHT_RECORDER_H_
+#define FLIGHT_RECORDER_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdint.h>
+
+/* ========================================================================== *\
+ *                              PUBLIC DEFINITIONS                            *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       FLIGHT_RECORDER_EVENTS
+    @brief     Events kept per thread, a power of two.
+============================================================================ **/
+#define FLIGHT_RECORDER_EVENTS      256u
+
+/** ============================================================================
+    @def       FLIGHT_RECORDER_THREADS
+    @brief     Maximum number of threads recording at the same time.
+============================================================================ **/
+#define FLIGHT_RECORDER_THREADS     64u
+
+/** ============================================================================
+    @def       FLIGHT_RECORDER_NAME_SIZE
+    @brief     Bytes kept of the current file name, including the terminator.
+============================================================================ **/
+#define FLIGHT_RECORDER_NAME_SIZE   64u
+
+/* ========================================================================== *\
+ *                                PUBLIC ENUMS                                *
+\* ========================================================================== */
+
+/** ============================================================================
+    @enum       frostFlightEvent
+    @package    Frost_FlightRecorder
+
+    @typedef    flight_event_t
+
+    @brief      Kinds of recorded events, with the meaning of their `aux` and
+                `value` fields.
+============================================================================ **/
+typedef enum frostFlightEvent
+{
+    FLIGHT_EVENT_NONE           = 0u,   /**< Empty ring entry */
+    FLIGHT_EVENT_TOKEN          = 1u,   /**< aux: token type, value: offset */
+    FLIGHT_EVENT_PHASE_BEGIN    = 2u,   /**< aux: trace phase */
+    FLIGHT_EVENT_PHASE_END      = 3u,   /**< aux: trace phase */
+    FLIGHT_EVENT_SOURCE         = 4u,   /**< aux: size (saturated), value: address */
+    FLIGHT_EVENT_FILE           = 5u,   /**< The current file name changed */
+    FLIGHT_EVENT_COUNT          = 6u,   /**< Number of event kinds */
+} flight_event_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_flightRecord
+  @package  Frost_FlightRecorder
+
+  @brief    Appends an event to the ring of the calling thread.
+
+  @param    event     [in]:   Kind of event.
+  @param    aux       [in]:   Small argument, see flight_event_t.
+  @param    value     [in]:   Wide argument, see flight_event_t.
+ =========================================================================== **/
+void Frost_flightRecord(flight_event_t event, uint32_t aux, uint64_t value);
+
+/** ============================================================================
+  @fn       Frost_flightRecordFile
+  @package  Frost_FlightRecorder
+
+  @brief    Sets the current file name of the calling thread and records a
+            FLIGHT_EVENT_FILE.
+
+  @param    name      [in]:   File name, copied up to FLIGHT_RECORDER_NAME_SIZE
+                              - 1 bytes. NULL is ignored.
+ =========================================================================== **/
+void Frost_flightRecordFile(const char *name);
+
+/** ============================================================================
+  @fn       Frost_flightRecorderInstall
+  @package  Frost_FlightRecorder
+
+  @brief    Installs the signal handlers that dump the rings.
+
+  @details  Also gives the calling thread an alternate signal stack, so a
+            stack overflow on it can still be reported.
+
+  @param    fd        [in]:   File descriptor receiving the dump, e.g.
+                              STDERR_FILENO.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EINVAL if fd is negative.
+            Negative errno value if a handler cannot be installed.
+ =========================================================================== **/
+int Frost_flightRecorderInstall(int fd);
+
+/** ============================================================================
+  @fn       Frost_flightRecorderDump
+  @package  Frost_FlightRecorder
+
+  @brief    Writes the rings of every thread, including those of threads
+            that already exited. Async-signal-safe.
+
+  @param    fd        [in]:   Output file descriptor.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EINVAL if fd is negative.
+ =========================================================================== **/
+int Frost_flightRecorderDump(int fd);
+
+#endif /* FLIGHT_RECORDER_H_ */
+
+/*< end of header file >*/
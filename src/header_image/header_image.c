@@ -0,0 +1,890 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_HeaderImage
+
+    @package    Frost_HeaderImage
+    @brief      This module writes the lexed state of a header to a
+                position-independent image that later compiles map and use in
+                place.
+
+    @file       header_image.c
+    @headerfile header_image.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Building collects the tokens of the header in a growing array,
+                then interns every TOKEN_ID into an open-addressing table with
+                linear probing, sized to twice the number of identifier
+                tokens rounded up to a power of two. The table is written as
+                is, so a lookup in a mapped image runs the same probe loop the
+                builder ran.
+
+                Opening checks only the fixed header and that each section
+                lies inside the file. Individual records are checked when they
+                are read, which keeps the cost of opening independent of the
+                size of the header.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*< Implements >*/
+#include "header_image.h"
+#include "../lexer/lexer.h"
+#include "../allocator/allocator.h"
+#include "../time_trace/time_trace.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       IMAGE_SECTION_ALIGNMENT
+    @brief     Alignment of every section after the header.
+============================================================================ **/
+#define IMAGE_SECTION_ALIGNMENT     8u
+
+/** ============================================================================
+    @def       IMAGE_MIN_BUCKETS
+    @brief     Smallest intern table, so that an empty header still has one.
+============================================================================ **/
+#define IMAGE_MIN_BUCKETS           8u
+
+/** ============================================================================
+    @def       IMAGE_INITIAL_TOKENS
+    @brief     Initial capacity of the token array while building.
+============================================================================ **/
+#define IMAGE_INITIAL_TOKENS        1024u
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostHeaderImage
+  @package  Frost_HeaderImage
+
+  @brief    Mapped image and pointers to its sections.
+============================================================================ **/
+struct frostHeaderImage
+{
+    const unsigned char         *base;      /*< Start of the mapping >*/
+    size_t                      size;       /*< Bytes mapped >*/
+    const header_image_header_t *header;    /*< Header, at base >*/
+    const char                  *source;    /*< Source section >*/
+    const image_token_t         *tokens;    /*< Token section >*/
+    const image_ident_t         *idents;    /*< Identifier section >*/
+    const uint32_t              *buckets;   /*< Bucket section >*/
+};
+
+/** ============================================================================
+  @struct   frostImageBuilder
+  @package  Frost_HeaderImage
+
+  @typedef  image_builder_t
+
+  @brief    State of Frost_headerImageBuild.
+============================================================================ **/
+typedef struct frostImageBuilder
+{
+    const char          *source;        /*< Header text >*/
+    image_token_t       *tokens;        /*< Tokens collected so far >*/
+    size_t              token_count;    /*< Entries used in tokens >*/
+    size_t              token_capacity; /*< Entries allocated in tokens >*/
+    size_t              id_tokens;      /*< Number of TOKEN_ID tokens >*/
+    image_ident_t       *idents;        /*< Intern table records >*/
+    size_t              ident_count;    /*< Entries used in idents >*/
+    uint32_t            *buckets;       /*< Intern table buckets >*/
+    size_t              bucket_count;   /*< Entries in buckets >*/
+} image_builder_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Sequence number making temporary file names unique in the process >*/
+static atomic_uint image_temp_sequence = 0u;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_imageHash
+  @package  Frost_HeaderImage
+
+  @brief    32-bit FNV-1a of an identifier.
+
+  @param    name      [in]:   Identifier bytes.
+  @param    length    [in]:   Number of bytes.
+
+  @return   Hash value.
+ =========================================================================== **/
+static uint32_t Frost_imageHash(const char *name, size_t length)
+{
+    /*< Variable Declarations >*/
+    uint32_t hash   = UINT32_C(2166136261);
+    size_t index    = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < length; index++)
+    {
+        hash = (hash ^ (unsigned char)name[index]) * UINT32_C(16777619);
+    }
+
+    /*< Function Output >*/
+    return hash;
+}
+
+/** ============================================================================
+  @fn       Frost_imageOnToken
+  @package  Frost_HeaderImage
+
+  @brief    Token callback of Frost_headerImageBuild.
+
+  @return   FUNCTION_SUCCESS to continue lexing.
+            -ENOMEM if the token array cannot grow.
+ =========================================================================== **/
+static int Frost_imageOnToken(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    /*< Variable Declarations >*/
+    image_builder_t *builder    = (image_builder_t *)ctx;
+    image_token_t *grown        = NULL;
+    size_t capacity             = 0u;
+    int ret                     = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if ( (type == TOKEN_COMMENT) || (type == TOKEN_EOF) )
+    {
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    if (builder->token_count == builder->token_capacity)
+    {
+        capacity = MAX(builder->token_capacity * 2u, (size_t)IMAGE_INITIAL_TOKENS);
+
+        grown = (image_token_t *)Frost_memRealloc(builder->tokens,
+                                                  builder->token_capacity * sizeof(image_token_t),
+                                                  capacity * sizeof(image_token_t), FROST_MEM_IMAGE);
+        if (grown == NULL)
+        {
+            LOG_ERROR("Memory allocation failed for header image tokens.");
+            ret = -ENOMEM;
+            goto end_of_function;
+        }
+
+        builder->tokens         = grown;
+        builder->token_capacity = capacity;
+    }
+
+    /*< Start Function Algorithm >*/
+    builder->tokens[builder->token_count] = (image_token_t)
+    {
+        .type   = (uint32_t)type,
+        .ident  = HEADER_IMAGE_NO_IDENT,
+        .offset = (uint32_t)offset,
+        .length = (uint32_t)length,
+    };
+
+    builder->token_count++;
+    builder->id_tokens += (type == TOKEN_ID) ? 1u : 0u;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_imageIntern
+  @package  Frost_HeaderImage
+
+  @brief    Interns every identifier token and numbers the tokens.
+
+  @param    builder   [in]:   Builder holding the collected tokens.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if allocation fails.
+ =========================================================================== **/
+static int Frost_imageIntern(image_builder_t *builder)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCESS;
+    image_token_t *token    = NULL;
+    const image_ident_t *id = NULL;
+    const char *name        = NULL;
+    uint32_t hash           = 0u;
+    size_t mask             = 0u;
+    size_t slot             = 0u;
+    size_t index            = 0u;
+
+    /*< Allocate Memory >*/
+    builder->bucket_count = IMAGE_MIN_BUCKETS;
+    while (builder->bucket_count < (builder->id_tokens * 2u))
+    {
+        builder->bucket_count <<= 1u;
+    }
+
+    builder->buckets = (uint32_t *)Frost_memCalloc(builder->bucket_count, sizeof(uint32_t), FROST_MEM_IMAGE);
+    builder->idents  = (image_ident_t *)Frost_memCalloc(MAX(builder->id_tokens, (size_t)1u),
+                                                        sizeof(image_ident_t), FROST_MEM_IMAGE);
+    if ( (builder->buckets == NULL) || (builder->idents == NULL) )
+    {
+        LOG_ERROR("Memory allocation failed for header image intern table.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    mask = builder->bucket_count - 1u;
+
+    for (index = 0u; index < builder->token_count; index++)
+    {
+        token = &builder->tokens[index];
+        if (token->type != (uint32_t)TOKEN_ID)
+        {
+            continue;
+        }
+
+        name = builder->source + token->offset;
+        hash = Frost_imageHash(name, token->length);
+
+        for (slot = hash & mask; builder->buckets[slot] != 0u; slot = (slot + 1u) & mask)
+        {
+            id = &builder->idents[builder->buckets[slot] - 1u];
+            if ( (id->hash == hash) && (id->length == token->length) &&
+                 (memcmp(builder->source + id->offset, name, token->length) == 0) )
+            {
+                break;
+            }
+        }
+
+        if (builder->buckets[slot] == 0u)
+        {
+            builder->idents[builder->ident_count] = (image_ident_t)
+            {
+                .offset     = token->offset,
+                .length     = token->length,
+                .hash       = hash,
+                .reserved   = 0u,
+            };
+
+            builder->ident_count++;
+            builder->buckets[slot] = (uint32_t)builder->ident_count;
+        }
+
+        token->ident = builder->buckets[slot];
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_imageWriteFile
+  @package  Frost_HeaderImage
+
+  @brief    Writes a buffer to a temporary file and renames it over path.
+
+  @param    path      [in]:   Final path.
+  @param    data      [in]:   Bytes to write.
+  @param    size      [in]:   Number of bytes.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENAMETOOLONG if the temporary path does not fit.
+            Negative errno value if the file cannot be written.
+ =========================================================================== **/
+static int Frost_imageWriteFile(const char *path, const void *data, size_t size)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCESS;
+    char temp[PATH_MAX] = { 0 };
+    size_t done         = 0u;
+    ssize_t count       = 0;
+    int written         = 0;
+    int fd              = -1;
+
+    /*< Security Checks >*/
+    written = snprintf(temp, sizeof(temp), "%s.tmp.%ld.%u", path, (long)getpid(),
+                       atomic_fetch_add_explicit(&image_temp_sequence, 1u, memory_order_relaxed));
+    if ( (written < 0) || ((size_t)written >= sizeof(temp)) )
+    {
+        LOG_ERROR("Header image path is too long.");
+        ret = -ENAMETOOLONG;
+        goto end_of_function;
+    }
+
+    fd = open(temp, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        ret = -errno;
+        LOG_ERROR("Cannot create a header image temporary file.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    while (done < size)
+    {
+        count = write(fd, (const char *)data + done, size - done);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            ret = -errno;
+            break;
+        }
+
+        done += (size_t)count;
+    }
+
+    if ( (close(fd) != 0) && (ret == FUNCTION_SUCESS) )
+    {
+        ret = -errno;
+    }
+
+    if ( (ret == FUNCTION_SUCESS) && (rename(temp, path) != 0) )
+    {
+        ret = -errno;
+    }
+
+    if (ret != FUNCTION_SUCESS)
+    {
+        LOG_ERROR("Failed to write a header image.");
+        (void)unlink(temp);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_imageSectionValid
+  @package  Frost_HeaderImage
+
+  @brief    Checks that an array section lies inside the image.
+
+  @param    image_size [in]:  Bytes of the image.
+  @param    offset    [in]:   Offset of the section.
+  @param    count     [in]:   Number of elements.
+  @param    element   [in]:   Bytes per element.
+
+  @return   true if the section is aligned and fits, false otherwise.
+ =========================================================================== **/
+static bool Frost_imageSectionValid(uint64_t image_size, uint64_t offset, uint64_t count, uint64_t element)
+{
+    return ( (offset >= sizeof(header_image_header_t)) &&
+             ((offset % IMAGE_SECTION_ALIGNMENT) == 0u) &&
+             (offset <= image_size) &&
+             (count <= ((image_size - offset) / element)) );
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_headerImageBuild
+  @package  Frost_HeaderImage
+
+  @brief    Lexes a header and writes its image.
+
+  @param    source    [in]:   Header text, not necessarily NUL-terminated.
+  @param    size      [in]:   Bytes of header text, at most UINT32_MAX.
+  @param    path      [in]:   Path of the image to write.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            -EFBIG if the header is too large for 32-bit offsets.
+            Negative errno value if the image cannot be written.
+ =========================================================================== **/
+int Frost_headerImageBuild(const char *source, size_t size, const char *path)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCESS;
+    image_builder_t builder         = { 0 };
+    header_image_header_t header    = { { 0 }, 0u, 0u, 0u, { 0u, 0u }, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u };
+    lexer_t *lexer                  = NULL;
+    unsigned char *image            = NULL;
+
+    /*< Security Checks >*/
+    if ( (source == NULL) || (path == NULL) )
+    {
+        LOG_ERROR("Header image entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if ((uint64_t)size > UINT32_MAX)
+    {
+        LOG_ERROR("Header is too large for an image.");
+        ret = -EFBIG;
+        goto end_of_function;
+    }
+
+    /*< Collect and Intern the Tokens >*/
+    ret = Frost_cacheFingerprint(source, size, &header.fingerprint);
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto end_of_function;
+    }
+
+    lexer = Frost_initLexerView(source, size);
+    if (lexer == NULL)
+    {
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    builder.source = source;
+
+    ret = Frost_lexStructural(lexer, Frost_imageOnToken, &builder);
+    (void)Frost_freeLexer(lexer);
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto free_builder;
+    }
+
+    ret = Frost_imageIntern(&builder);
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto free_builder;
+    }
+
+    /*< Lay Out the Sections >*/
+    memcpy(header.magic, HEADER_IMAGE_MAGIC, sizeof(header.magic));
+    header.version          = HEADER_IMAGE_VERSION;
+    header.header_size      = (uint32_t)sizeof(header_image_header_t);
+    header.source_offset    = ALIGN_UP((uint64_t)sizeof(header_image_header_t), IMAGE_SECTION_ALIGNMENT);
+    header.source_size      = (uint64_t)size;
+    header.tokens_offset    = header.source_offset + ALIGN_UP((uint64_t)size, IMAGE_SECTION_ALIGNMENT);
+    header.token_count      = (uint64_t)builder.token_count;
+    header.idents_offset    = header.tokens_offset + (header.token_count * sizeof(image_token_t));
+    header.ident_count      = (uint64_t)builder.ident_count;
+    header.buckets_offset   = header.idents_offset + (header.ident_count * sizeof(image_ident_t));
+    header.bucket_count     = (uint64_t)builder.bucket_count;
+    header.image_size       = header.buckets_offset + (header.bucket_count * sizeof(uint32_t));
+
+    /*< Allocate Memory >*/
+    image = (unsigned char *)Frost_memCalloc(1u, (size_t)header.image_size, FROST_MEM_IMAGE);
+    if (image == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for header image.");
+        ret = -ENOMEM;
+        goto free_builder;
+    }
+
+    /*< Start Function Algorithm >*/
+    memcpy(image, &header, sizeof(header));
+    memcpy(image + header.source_offset, source, size);
+    memcpy(image + header.tokens_offset, builder.tokens, builder.token_count * sizeof(image_token_t));
+    memcpy(image + header.idents_offset, builder.idents, builder.ident_count * sizeof(image_ident_t));
+    memcpy(image + header.buckets_offset, builder.buckets, builder.bucket_count * sizeof(uint32_t));
+
+    ret = Frost_imageWriteFile(path, image, (size_t)header.image_size);
+
+    /*< Free Memory >*/
+    Frost_memFree(image, (size_t)header.image_size, FROST_MEM_IMAGE);
+
+free_builder:
+    Frost_memFree(builder.tokens, builder.token_capacity * sizeof(image_token_t), FROST_MEM_IMAGE);
+    Frost_memFree(builder.idents, MAX(builder.id_tokens, (size_t)1u) * sizeof(image_ident_t), FROST_MEM_IMAGE);
+    Frost_memFree(builder.buckets, builder.bucket_count * sizeof(uint32_t), FROST_MEM_IMAGE);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_headerImageOpen
+  @package  Frost_HeaderImage
+
+  @brief    Maps an image read-only and checks its header.
+
+  @param    path      [in]:   Path of the image.
+
+  @return   Pointer to a new handle on success.
+            NULL if the file cannot be mapped or is not a valid image.
+ =========================================================================== **/
+header_image_t *Frost_headerImageOpen(const char *path)
+{
+    /*< Variable Declarations >*/
+    header_image_t *image_out           = NULL;
+    const header_image_header_t *header = NULL;
+    struct stat info                    = { 0 };
+    void *base                          = MAP_FAILED;
+    int fd                              = -1;
+    trace_span_t span                   = { 0 };
+
+    /*< Security Checks >*/
+    if (path == NULL)
+    {
+        LOG_ERROR("Header image entry point is NULL.");
+        goto end_of_function;
+    }
+
+    /*< Map the File >*/
+    Frost_traceBegin(&span, TRACE_PHASE_READ, path);
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        goto end_trace;
+    }
+
+    if ( (fstat(fd, &info) != 0) || (!S_ISREG(info.st_mode)) ||
+         ((size_t)info.st_size < sizeof(header_image_header_t)) )
+    {
+        close(fd);
+        goto end_trace;
+    }
+
+    base = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        LOG_ERROR("Cannot map a header image.");
+        goto end_trace;
+    }
+
+    /*< Check the Header and the Section Bounds >*/
+    header = (const header_image_header_t *)base;
+
+    if ( (memcmp(header->magic, HEADER_IMAGE_MAGIC, sizeof(header->magic)) != 0) ||
+         (header->version != HEADER_IMAGE_VERSION) ||
+         (header->header_size != sizeof(header_image_header_t)) ||
+         (header->image_size != (uint64_t)info.st_size) ||
+         (header->source_size > UINT32_MAX) ||
+         (!Frost_imageSectionValid(header->image_size, header->source_offset, header->source_size, 1u)) ||
+         (!Frost_imageSectionValid(header->image_size, header->tokens_offset, header->token_count,
+                                   sizeof(image_token_t))) ||
+         (!Frost_imageSectionValid(header->image_size, header->idents_offset, header->ident_count,
+                                   sizeof(image_ident_t))) ||
+         (!Frost_imageSectionValid(header->image_size, header->buckets_offset, header->bucket_count,
+                                   sizeof(uint32_t))) ||
+         (header->bucket_count == 0u) ||
+         ((header->bucket_count & (header->bucket_count - 1u)) != 0u) ||
+         (header->ident_count >= header->bucket_count) )
+    {
+        LOG_ERROR("File is not a valid header image.");
+        goto unmap_file;
+    }
+
+    /*< Allocate Memory >*/
+    image_out = (header_image_t *)Frost_memCalloc(1u, sizeof(header_image_t), FROST_MEM_IMAGE);
+    if (image_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for header image handle.");
+        goto unmap_file;
+    }
+
+    /*< Start Function Algorithm >*/
+    image_out->base     = (const unsigned char *)base;
+    image_out->size     = (size_t)info.st_size;
+    image_out->header   = header;
+    image_out->source   = (const char *)(image_out->base + header->source_offset);
+    image_out->tokens   = (const image_token_t *)(const void *)(image_out->base + header->tokens_offset);
+    image_out->idents   = (const image_ident_t *)(const void *)(image_out->base + header->idents_offset);
+    image_out->buckets  = (const uint32_t *)(const void *)(image_out->base + header->buckets_offset);
+    goto end_trace;
+
+unmap_file:
+    (void)munmap(base, (size_t)info.st_size);
+
+end_trace:
+    Frost_traceEnd(&span);
+
+    /*< Function Output >*/
+end_of_function:
+    return image_out;
+}
+
+/** ============================================================================
+  @fn       Frost_headerImageClose
+  @package  Frost_HeaderImage
+
+  @brief    Unmaps an image. Pointers obtained from it become invalid.
+
+  @param    image     [in]:   Pointer to the image handle.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the image is NULL.
+ =========================================================================== **/
+int Frost_headerImageClose(header_image_t *image)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (image == NULL)
+    {
+        LOG_ERROR("Header image entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Free Memory >*/
+    (void)munmap((void *)(uintptr_t)image->base, image->size);
+    Frost_memFree(image, sizeof(header_image_t), FROST_MEM_IMAGE);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_headerImageFingerprint
+  @package  Frost_HeaderImage
+
+  @brief    Returns the token fingerprint of the header the image was built
+            from.
+
+  @param    image     [in]:   Pointer to the image handle.
+
+  @return   The fingerprint, or a zero key if the image is NULL.
+ =========================================================================== **/
+cache_key_t Frost_headerImageFingerprint(const header_image_t *image)
+{
+    /*< Variable Declarations >*/
+    cache_key_t key_out = { 0u, 0u };
+
+    /*< Start Function Algorithm >*/
+    if (image != NULL)
+    {
+        key_out = image->header->fingerprint;
+    }
+
+    /*< Function Output >*/
+    return key_out;
+}
+
+/** ============================================================================
+  @fn       Frost_headerImageSource
+  @package  Frost_HeaderImage
+
+  @brief    Returns the header text stored in the image.
+
+  @param    image     [in]:   Pointer to the image handle.
+  @param    size      [out]:  Bytes of header text.
+
+  @return   Pointer into the mapping, or NULL if an argument is NULL.
+ =========================================================================== **/
+const char *Frost_headerImageSource(const header_image_t *image, size_t *size)
+{
+    /*< Variable Declarations >*/
+    const char *source_out = NULL;
+
+    /*< Start Function Algorithm >*/
+    if ( (image != NULL) && (size != NULL) )
+    {
+        *size       = (size_t)image->header->source_size;
+        source_out  = image->source;
+    }
+
+    /*< Function Output >*/
+    return source_out;
+}
+
+/** ============================================================================
+  @fn       Frost_headerImageTokens
+  @package  Frost_HeaderImage
+
+  @brief    Returns the token array of the image, in place.
+
+  @param    image     [in]:   Pointer to the image handle.
+  @param    count     [out]:  Number of tokens.
+
+  @return   Pointer into the mapping, or NULL if an argument is NULL.
+ =========================================================================== **/
+const image_token_t *Frost_headerImageTokens(const header_image_t *image, size_t *count)
+{
+    /*< Variable Declarations >*/
+    const image_token_t *tokens_out = NULL;
+
+    /*< Start Function Algorithm >*/
+    if ( (image != NULL) && (count != NULL) )
+    {
+        *count      = (size_t)image->header->token_count;
+        tokens_out  = image->tokens;
+    }
+
+    /*< Function Output >*/
+    return tokens_out;
+}
+
+/** ============================================================================
+  @fn       Frost_headerImageToken
+  @package  Frost_HeaderImage
+
+  @brief    Describes one token of the image as a token view.
+
+  @param    image     [in]:   Pointer to the image handle.
+  @param    index     [in]:   Token number.
+  @param    token     [out]:  View whose lexeme points into the mapping.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            -ERANGE if index is past the last token.
+            -EINVAL if the record points outside the source section.
+ =========================================================================== **/
+int Frost_headerImageToken(const header_image_t *image, size_t index, token_view_t *token)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCESS;
+    const image_token_t *record = NULL;
+
+    /*< Security Checks >*/
+    if ( (image == NULL) || (token == NULL) )
+    {
+        LOG_ERROR("Header image entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if ((uint64_t)index >= image->header->token_count)
+    {
+        ret = -ERANGE;
+        goto end_of_function;
+    }
+
+    record = &image->tokens[index];
+    if (((uint64_t)record->offset + record->length) > image->header->source_size)
+    {
+        LOG_ERROR("Header image token is out of bounds.");
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    token->lexeme   = image->source + record->offset;
+    token->offset   = (size_t)record->offset;
+    token->length   = (size_t)record->length;
+    token->type     = (token_type_t)record->type;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_headerImageIntern
+  @package  Frost_HeaderImage
+
+  @brief    Finds the identifier number of a name in the intern table.
+
+  @param    image     [in]:   Pointer to the image handle.
+  @param    name      [in]:   Identifier, not necessarily NUL-terminated.
+  @param    length    [in]:   Bytes of name.
+
+  @return   Identifier number, starting at 1.
+            HEADER_IMAGE_NO_IDENT if the header never uses the name.
+ =========================================================================== **/
+uint32_t Frost_headerImageIntern(const header_image_t *image, const char *name, size_t length)
+{
+    /*< Variable Declarations >*/
+    uint32_t ident_out      = HEADER_IMAGE_NO_IDENT;
+    const image_ident_t *id = NULL;
+    uint32_t hash           = 0u;
+    uint32_t entry          = 0u;
+    uint64_t mask           = 0u;
+    uint64_t probe          = 0u;
+
+    /*< Security Checks >*/
+    if ( (image == NULL) || (name == NULL) )
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    hash = Frost_imageHash(name, length);
+    mask = image->header->bucket_count - 1u;
+
+    /*< Bounded, so a damaged table with no empty bucket still ends >*/
+    for (probe = 0u; probe < image->header->bucket_count; probe++)
+    {
+        entry = image->buckets[(hash + probe) & mask];
+        if ( (entry == 0u) || ((uint64_t)entry > image->header->ident_count) )
+        {
+            break;
+        }
+
+        id = &image->idents[entry - 1u];
+        if ( (id->hash == hash) && (id->length == length) &&
+             (((uint64_t)id->offset + id->length) <= image->header->source_size) &&
+             (memcmp(image->source + id->offset, name, length) == 0) )
+        {
+            ident_out = entry;
+            break;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ident_out;
+}
+
+/** ============================================================================
+  @fn       Frost_headerImageIdent
+  @package  Frost_HeaderImage
+
+  @brief    Returns the spelling of an identifier number.
+
+  @param    image     [in]:   Pointer to the image handle.
+  @param    ident     [in]:   Identifier number.
+  @param    length    [out]:  Bytes of the identifier.
+
+  @return   Pointer into the mapping, not NUL-terminated.
+            NULL if an argument is invalid or the record is damaged.
+ =========================================================================== **/
+const char *Frost_headerImageIdent(const header_image_t *image, uint32_t ident, size_t *length)
+{
+    /*< Variable Declarations >*/
+    const char *name_out    = NULL;
+    const image_ident_t *id = NULL;
+
+    /*< Security Checks >*/
+    if ( (image == NULL) || (length == NULL) || (ident == HEADER_IMAGE_NO_IDENT) ||
+         ((uint64_t)ident > image->header->ident_count) )
+    {
+        goto end_of_function;
+    }
+
+    id = &image->idents[ident - 1u];
+    if (((uint64_t)id->offset + id->length) > image->header->source_size)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    *length     = (size_t)id->length;
+    name_out    = image->source + id->offset;
+
+    /*< Function Output >*/
+end_of_function:
+    return name_out;
+}
+
+/*< end of file >*/
+/** @}*/
@@ -0,0 +1,295 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_HeaderImage
+
+    @brief      This module writes the lexed state of a header to a
+                position-independent image that later compiles map and use in
+                place.
+
+    @file       header_image.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    An image holds a copy of the header text, its token stream
+                and an intern table of its identifiers, each identifier stored
+                once with a hash table to find it by name. Every reference
+                inside the image is an offset from its first byte, never a
+                pointer, so Frost_headerImageOpen only maps the file read-only
+                and checks the section bounds: there is no deserialization
+                pass, and the pages a compile never touches are never read.
+                Several compiler processes mapping the same image share its
+                page cache pages.
+
+                Image layout, all fields in host byte order:
+
+                | Section  | Contents                                      |
+                |----------|-----------------------------------------------|
+                | header   | header_image_header_t                         |
+                | source   | header text, padded to 8 bytes                |
+                | tokens   | image_token_t per token, comments dropped     |
+                | idents   | image_ident_t per distinct identifier         |
+                | buckets  | uint32_t per bucket: ident index + 1, 0 empty |
+
+    @note       - The parser does not exist yet, so an image carries what the
+                  front end produces today: tokens and identifiers. The format
+                  is versioned so that declaration and type sections can be
+                  appended once the parser lands.
+                - The image stores the token fingerprint of the header (see
+                  Frost_cacheFingerprint); a driver compares it with its
+                  dependency records to decide whether the image is stale.
+                - Images are not portable across byte orders.
+ =========================================================================== **/
+
+#ifndef HEADER_IMAGE_H_
+#define HEADER_IMAGE_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../token/token.h"
+#include "../compile_cache/compile_cache.h"
+
+/* ========================================================================== *\
+ *                              PUBLIC DEFINITIONS                            *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       HEADER_IMAGE_MAGIC
+    @brief     First eight bytes of every image.
+============================================================================ **/
+#define HEADER_IMAGE_MAGIC          "FROSTHDR"
+
+/** ============================================================================
+    @def       HEADER_IMAGE_VERSION
+    @brief     Image format version.
+============================================================================ **/
+#define HEADER_IMAGE_VERSION        2u
+
+/** ============================================================================
+    @def       HEADER_IMAGE_NO_IDENT
+    @brief     Identifier number of tokens that are not identifiers, and result
+               of a failed lookup.
+============================================================================ **/
+#define HEADER_IMAGE_NO_IDENT       0u
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostHeaderImageHeader
+  @package  Frost_HeaderImage
+
+  @typedef  header_image_header_t
+
+  @brief    First bytes of an image, describing its sections.
+============================================================================ **/
+typedef struct frostHeaderImageHeader
+{
+    char                magic[8];       /*< HEADER_IMAGE_MAGIC, not terminated >*/
+    uint32_t            version;        /*< HEADER_IMAGE_VERSION >*/
+    uint32_t            header_size;    /*< sizeof(header_image_header_t) >*/
+    uint64_t            image_size;     /*< Total bytes of the image >*/
+    cache_key_t         fingerprint;    /*< Token fingerprint of the header >*/
+    uint64_t            source_offset;  /*< Offset of the header text >*/
+    uint64_t            source_size;    /*< Bytes of header text, unpadded >*/
+    uint64_t            tokens_offset;  /*< Offset of the token array >*/
+    uint64_t            token_count;    /*< Number of tokens >*/
+    uint64_t            idents_offset;  /*< Offset of the identifier array >*/
+    uint64_t            ident_count;    /*< Number of distinct identifiers >*/
+    uint64_t            buckets_offset; /*< Offset of the hash buckets >*/
+    uint64_t            bucket_count;   /*< Number of buckets, a power of two >*/
+} header_image_header_t;
+
+/** ============================================================================
+  @struct   frostImageToken
+  @package  Frost_HeaderImage
+
+  @typedef  image_token_t
+
+  @brief    Token record of an image.
+============================================================================ **/
+typedef struct frostImageToken
+{
+    uint32_t            type;           /*< token_type_t of the token >*/
+    uint32_t            ident;          /*< Identifier number, or HEADER_IMAGE_NO_IDENT >*/
+    uint32_t            offset;         /*< Offset of the lexeme in the source section >*/
+    uint32_t            length;         /*< Bytes of the lexeme >*/
+} image_token_t;
+
+/** ============================================================================
+  @struct   frostImageIdent
+  @package  Frost_HeaderImage
+
+  @typedef  image_ident_t
+
+  @brief    Intern table record of an image.
+============================================================================ **/
+typedef struct frostImageIdent
+{
+    uint32_t            offset;         /*< First occurrence in the source section >*/
+    uint32_t            length;         /*< Bytes of the identifier >*/
+    uint32_t            hash;           /*< 32-bit FNV-1a of the identifier >*/
+    uint32_t            reserved;       /*< Zero >*/
+} image_ident_t;
+
+/** ============================================================================
+  @struct   frostHeaderImage
+  @package  Frost_HeaderImage
+
+  @typedef  header_image_t
+
+  @brief    Opaque handle to a mapped image.
+============================================================================ **/
+typedef struct frostHeaderImage header_image_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_headerImageBuild
+  @package  Frost_HeaderImage
+
+  @brief    Lexes a header and writes its image.
+
+  @details  The image is written to a temporary file next to path and renamed
+            over it, so concurrent builds and readers never see a partial
+            image.
+
+  @param    source    [in]:   Header text, not necessarily NUL-terminated.
+  @param    size      [in]:   Bytes of header text, at most UINT32_MAX.
+  @param    path      [in]:   Path of the image to write.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            -EFBIG if the header is too large for 32-bit offsets.
+            Negative errno value if the image cannot be written.
+ =========================================================================== **/
+int Frost_headerImageBuild(const char *source, size_t size, const char *path);
+
+/** ============================================================================
+  @fn       Frost_headerImageOpen
+  @package  Frost_HeaderImage
+
+  @brief    Maps an image read-only and checks its header.
+
+  @param    path      [in]:   Path of the image.
+
+  @return   Pointer to a new handle on success.
+            NULL if the file cannot be mapped or is not a valid image.
+ =========================================================================== **/
+header_image_t *Frost_headerImageOpen(const char *path);
+
+/** ============================================================================
+  @fn       Frost_headerImageClose
+  @package  Frost_HeaderImage
+
+  @brief    Unmaps an image. Pointers obtained from it become invalid.
+
+  @param    image     [in]:   Pointer to the image handle.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the image is NULL.
+ =========================================================================== **/
+int Frost_headerImageClose(header_image_t *image);
+
+/** ============================================================================
+  @fn       Frost_headerImageFingerprint
+  @package  Frost_HeaderImage
+
+  @brief    Returns the token fingerprint of the header the image was built
+            from.
+
+  @param    image     [in]:   Pointer to the image handle.
+
+  @return   The fingerprint, or a zero key if the image is NULL.
+ =========================================================================== **/
+cache_key_t Frost_headerImageFingerprint(const header_image_t *image);
+
+/** ============================================================================
+  @fn       Frost_headerImageSource
+  @package  Frost_HeaderImage
+
+  @brief    Returns the header text stored in the image.
+
+  @param    image     [in]:   Pointer to the image handle.
+  @param    size      [out]:  Bytes of header text.
+
+  @return   Pointer into the mapping, or NULL if an argument is NULL.
+ =========================================================================== **/
+const char *Frost_headerImageSource(const header_image_t *image, size_t *size);
+
+/** ============================================================================
+  @fn       Frost_headerImageTokens
+  @package  Frost_HeaderImage
+
+  @brief    Returns the token array of the image, in place.
+
+  @details  The records come straight from the file: callers that use their
+            offsets directly must check them against the source size, or go
+            through Frost_headerImageToken, which does.
+
+  @param    image     [in]:   Pointer to the image handle.
+  @param    count     [out]:  Number of tokens.
+
+  @return   Pointer into the mapping, or NULL if an argument is NULL.
+ =========================================================================== **/
+const image_token_t *Frost_headerImageTokens(const header_image_t *image, size_t *count);
+
+/** ============================================================================
+  @fn       Frost_headerImageToken
+  @package  Frost_HeaderImage
+
+  @brief    Describes one token of the image as a token view.
+
+  @param    image     [in]:   Pointer to the image handle.
+  @param    index     [in]:   Token number.
+  @param    token     [out]:  View whose lexeme points into the mapping.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            -ERANGE if index is past the last token.
+            -EINVAL if the record points outside the source section.
+ =========================================================================== **/
+int Frost_headerImageToken(const header_image_t *image, size_t index, token_view_t *token);
+
+/** ============================================================================
+  @fn       Frost_headerImageIntern
+  @package  Frost_HeaderImage
+
+  @brief    Finds the identifier number of a name in the intern table.
+
+  @param    image     [in]:   Pointer to the image handle.
+  @param    name      [in]:   Identifier, not necessarily NUL-terminated.
+  @param    length    [in]:   Bytes of name.
+
+  @return   Identifier number, starting at 1.
+            HEADER_IMAGE_NO_IDENT if the header never uses the name.
+ =========================================================================== **/
+uint32_t Frost_headerImageIntern(const header_image_t *image, const char *name, size_t length);
+
+/** ============================================================================
+  @fn       Frost_headerImageIdent
+  @package  Frost_HeaderImage
+
+  @brief    Returns the spelling of an identifier number.
+
+  @param    image     [in]:   Pointer to the image handle.
+  @param    ident     [in]:   Identifier number.
+  @param    length    [out]:  Bytes of the identifier.
+
+  @return   Pointer into the mapping, not NUL-terminated.
+            NULL if an argument is invalid or the record is damaged.
+ =========================================================================== **/
+const char *Frost_headerImageIdent(const header_image_t *image, uint32_t ident, size_t *length);
+
+#endif /* HEADER_IMAGE_H_ */
+
+/*< end of header file >*/
@@ -23,6 +23,10 @@
                   formatted to avoid errors during tokenization.
                 - This module is tightly coupled with the `Frost_Token` module
                   for creating and managing token objects.
+                - No mutable static or global state: the character, dispatch
+                  and operator tables are `static const`, and all scanner
+                  state lives in the lexer_t or on the stack. Keep it that
+                  way; see the reentrancy note in lexer.h.
  =========================================================================== **/
 
 /* ========================================================================== *\
@@ -32,19 +36,706 @@
 /*< Dependencies >*/
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdbool.h>
 #include <string.h>
-#include <stdlib.h>
-#include <ctype.h>
+#include <stdint.h>
 #include <errno.h>
 
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
 /*< Implements >*/
 #include "lexer.h"
+#include "../allocator/allocator.h"
+#include "../time_trace/time_trace.h"
+#include "../flight_recorder/flight_recorder.h"
 #include "../../inc/utils.h"
+#include "../../inc/probes.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       LEXER_BLOCK_SIZE
+    @brief     Number of source bytes classified at once by the structural
+               engine, one bit per byte.
+============================================================================ **/
+#define LEXER_BLOCK_SIZE            64u
+
+/** ============================================================================
+    @def       LEXER_CHAR_IDENT_START, LEXER_CHAR_IDENT, LEXER_CHAR_DIGIT,
+               LEXER_CHAR_SPACE, LEXER_CHAR_NEWLINE, LEXER_CHAR_OPERATOR,
+               LEXER_CHAR_QUOTE, LEXER_CHAR_NUMBER
+    @brief     Character properties stored in lexer_char_class.
+============================================================================ **/
+#define LEXER_CHAR_IDENT_START      0x01u   /*< Letter or underscore >*/
+#define LEXER_CHAR_IDENT            0x02u   /*< Letter, digit or underscore >*/
+#define LEXER_CHAR_DIGIT            0x04u   /*< Decimal digit >*/
+#define LEXER_CHAR_SPACE            0x08u   /*< Space, tab, carriage return, newline >*/
+#define LEXER_CHAR_NEWLINE          0x10u   /*< Newline >*/
+#define LEXER_CHAR_OPERATOR         0x20u   /*< First character of an operator or punctuator >*/
+#define LEXER_CHAR_QUOTE            0x40u   /*< Single or double quote >*/
+#define LEXER_CHAR_NUMBER           0x80u   /*< Continues a numeric literal >*/
+
+/** ============================================================================
+    @def       LEXER_IS(character, property)
+    @brief     Tests a character property with one load and one mask.
+============================================================================ **/
+#define LEXER_IS(character, property)                                       \
+    ((lexer_char_class[(unsigned char)(character)] & (property)) != 0u)
+
+/** ============================================================================
+    @def       LEXER_WORD(a, b)
+    @brief     Two characters packed the way Frost_lexerLoadWord loads them,
+               so they can be compared against the low half of a word.
+               LEXER_WORD3 does the same for three characters.
+============================================================================ **/
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    #define LEXER_WORD(a, b)        (((uint32_t)(unsigned char)(a) << 24) | \
+                                     ((uint32_t)(unsigned char)(b) << 16))
+    #define LEXER_WORD3(a, b, c)    (LEXER_WORD(a, b) | ((uint32_t)(unsigned char)(c) << 8))
+    #define LEXER_WORD_MASK2        UINT32_C(0xFFFF0000)
+    #define LEXER_WORD_MASK3        UINT32_C(0xFFFFFF00)
+#else
+    #define LEXER_WORD(a, b)        ((uint32_t)(unsigned char)(a) | \
+                                     ((uint32_t)(unsigned char)(b) << 8))
+    #define LEXER_WORD3(a, b, c)    (LEXER_WORD(a, b) | ((uint32_t)(unsigned char)(c) << 16))
+    #define LEXER_WORD_MASK2        UINT32_C(0x0000FFFF)
+    #define LEXER_WORD_MASK3        UINT32_C(0x00FFFFFF)
+#endif
+
+/** ============================================================================
+    @def       LEXER_COMPUTED_GOTO
+    @brief     Build option: define FROST_COMPUTED_GOTO to make the scanner
+               dispatch on the first byte with labels-as-values, so each
+               token class gets its own indirect branch. Compilers without
+               the extension always use the portable `switch`.
+============================================================================ **/
+#if defined(FROST_COMPUTED_GOTO) && (defined(__GNUC__) || defined(__clang__))
+    #define LEXER_COMPUTED_GOTO     1
+#else
+    #define LEXER_COMPUTED_GOTO     0
+#endif
+
+/** ============================================================================
+    @def       LEXER_DISPATCH(class), LEXER_CASE(class), LEXER_NEXT,
+               LEXER_FALLTHROUGH
+    @brief     Scanner dispatch, written once for both strategies: a jump
+               through lexer_dispatch_labels, or a `switch` on the class.
+============================================================================ **/
+#if LEXER_COMPUTED_GOTO
+    #define LEXER_DISPATCH(class)   goto *lexer_dispatch_labels[(class)];
+    #define LEXER_CASE(class)       lexer_case_##class:
+    #define LEXER_NEXT              goto lexer_dispatch_done
+    #define LEXER_FALLTHROUGH
+#else
+    #define LEXER_DISPATCH(class)   switch (class)
+    #define LEXER_CASE(class)       case class:
+    #define LEXER_NEXT              break
+    #if defined(__GNUC__) || defined(__clang__)
+        #define LEXER_FALLTHROUGH   __attribute__((fallthrough))
+    #else
+        #define LEXER_FALLTHROUGH
+    #endif
+#endif
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @enum     frostLexerClass
+  @package  Frost_Lexer
+
+  @typedef  lexer_class_t
+
+  @brief    Scanner entry point selected by the first byte of a token.
+============================================================================ **/
+typedef enum frostLexerClass
+{
+    LEXER_CLASS_OPERATOR    = 0u,   /*< Operators, punctuators and stray bytes >*/
+    LEXER_CLASS_END         = 1u,   /*< NUL byte, ends the source >*/
+    LEXER_CLASS_IDENT       = 2u,   /*< Letter or underscore >*/
+    LEXER_CLASS_DIGIT       = 3u,   /*< Decimal digit >*/
+    LEXER_CLASS_QUOTE       = 4u,   /*< Single or double quote >*/
+    LEXER_CLASS_SLASH       = 5u,   /*< Comment or division operator >*/
+} lexer_class_t;
+
+/** ============================================================================
+  @struct   frostLexerBlock
+  @package  Frost_Lexer
+
+  @typedef  lexer_block_t
+
+  @brief    Character-class bitmasks of one LEXER_BLOCK_SIZE source block.
+
+  @details  Bit i of each mask describes byte i of the block. Bytes past the
+            end of the source read as zero and belong to no class.
+============================================================================ **/
+typedef struct frostLexerBlock
+{
+    uint64_t    space;              /*< Whitespace skipped by the scanner >*/
+    uint64_t    ident;              /*< Letters, digits and underscores >*/
+    uint64_t    dot;                /*< Periods, which continue numbers >*/
+    uint64_t    starts;             /*< Bytes that may begin a token >*/
+} lexer_block_t;
+
+/** ============================================================================
+  @struct   frostLexerOperator
+  @package  Frost_Lexer
+
+  @typedef  lexer_operator_t
+
+  @brief    Entry of the multi-character operator table.
+============================================================================ **/
+typedef struct frostLexerOperator
+{
+    uint32_t        pattern;        /*< Operator characters, see LEXER_WORD >*/
+    token_type_t    type;           /*< Token type of the operator >*/
+} lexer_operator_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+    @var       lexer_char_class
+    @brief     LEXER_CHAR_* properties of every byte value.
+
+    @details   Read-only and statically initialized, so it is shared by every
+               thread without synchronization, and independent of the C
+               locale. It starts on a cache-line boundary, so its 256 bytes
+               occupy as few lines as possible. Bytes above 0x7F have no
+               property.
+============================================================================ **/
+static const unsigned char lexer_char_class[256]
+    __attribute__((aligned(ARCH_CACHE_LINE_SIZE))) =
+{
+    /* 0x00 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00,
+    /* 0x10 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x20 */ 0x08, 0x20, 0x40, 0x00, 0x00, 0x20, 0x20, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xA0, 0x20,
+    /* 0x30 */ 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    /* 0x40 */ 0x00, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    /* 0x50 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x20, 0x00, 0x20, 0x20, 0x83,
+    /* 0x60 */ 0x00, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+    /* 0x70 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x20, 0x20, 0x20, 0x20, 0x00,
+    /* 0x80 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x90 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0xA0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0xB0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0xC0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0xD0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0xE0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0xF0 */ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/** ============================================================================
+    @var       lexer_dispatch
+    @brief     Scanner entry point of every byte value, as a lexer_class_t:
+               0 operator, 1 NUL, 2 letter or underscore, 3 digit, 4 quote,
+               5 slash.
+============================================================================ **/
+static const unsigned char lexer_dispatch[256] =
+{
+    /* 0x00 */ 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x20 */ 0, 0, 4, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 5,
+    /* 0x30 */ 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+    /* 0x40 */ 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    /* 0x50 */ 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2,
+    /* 0x60 */ 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    /* 0x70 */ 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+    /* 0x80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xA0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xB0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xC0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xD0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xE0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xF0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/** ============================================================================
+    @var       lexer_operators3
+    @brief     Three-character operators, matched against the first three
+               bytes of the word at the cursor before lexer_operators, so the
+               longest match wins.
+============================================================================ **/
+static const lexer_operator_t lexer_operators3[] =
+{
+    { LEXER_WORD3('<', '<', '='), TOKEN_LEFT_SHIFT_ASSIGN   },
+    { LEXER_WORD3('>', '>', '='), TOKEN_RIGHT_SHIFT_ASSIGN  },
+};
+
+/** ============================================================================
+    @var       lexer_operators
+    @brief     Two-character operators, matched against the low half of the
+               word at the cursor. Single characters fall back to
+               Frost_lexerPunctuator.
+============================================================================ **/
+static const lexer_operator_t lexer_operators[] =
+{
+    { LEXER_WORD('=', '='), TOKEN_EQUAL             },
+    { LEXER_WORD('!', '='), TOKEN_NOT_EQUAL         },
+    { LEXER_WORD('<', '='), TOKEN_LESS_EQUAL        },
+    { LEXER_WORD('>', '='), TOKEN_GREATER_EQUAL     },
+    { LEXER_WORD('&', '&'), TOKEN_AND               },
+    { LEXER_WORD('|', '|'), TOKEN_OR                },
+    { LEXER_WORD('+', '='), TOKEN_PLUS_ASSIGN       },
+    { LEXER_WORD('-', '='), TOKEN_MINUS_ASSIGN      },
+    { LEXER_WORD('*', '='), TOKEN_MULTIPLY_ASSIGN   },
+    { LEXER_WORD('/', '='), TOKEN_DIVIDE_ASSIGN     },
+    { LEXER_WORD('<', '<'), TOKEN_LEFT_SHIFT        },
+    { LEXER_WORD('>', '>'), TOKEN_RIGHT_SHIFT       },
+    { LEXER_WORD(':', ':'), TOKEN_DOUBLE_COLON      },
+};
 
 /* ========================================================================== *\
  *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
 \* ========================================================================== */
 
+/** ============================================================================
+  @fn       Frost_lexerAttach
+  @package  Frost_Lexer
+
+  @brief    Points a lexer at a source buffer and rewinds its cursor.
+
+  @details  Releases the previous source if the lexer owned it. Re-attaching
+            the buffer the lexer already owns, e.g. with Frost_lexerResetView
+            on lexer->source, rewinds it and keeps it owned, so it is still
+            freed with the lexer. The first character is only read when the
+            buffer is not empty, so borrowed buffers are never read past their
+            size.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+  @param    source    [in]:   Buffer containing the source code.
+  @param    size      [in]:   Number of bytes of source.
+  @param    owns      [in]:   Whether the lexer takes ownership of source.
+ =========================================================================== **/
+static void Frost_lexerAttach(lexer_t *lexer, const char *source, size_t size, bool owns)
+{
+    /*< Start Function Algorithm >*/
+    if ( (lexer->owns_source) && (lexer->source != source) )
+    {
+        Frost_memFree((char *)lexer->source, 0u, FROST_MEM_SOURCE);
+    }
+
+    lexer->owns_source  = (owns) || ( (lexer->owns_source) && (lexer->source == source) );
+    lexer->source       = source;
+    lexer->source_size  = size;
+    lexer->index        = 0u;
+    lexer->current_char = (size > 0u) ? source[0] : '\0';
+
+    FROST_PROBE2(lexer__init, source, size);
+    Frost_flightRecord(FLIGHT_EVENT_SOURCE, (uint32_t)MIN(size, (size_t)UINT32_MAX), (uintptr_t)source);
+}
+
+/** ============================================================================
+  @fn       Frost_lexerPunctuator
+  @package  Frost_Lexer
+
+  @brief    Maps a single punctuation character to its token type.
+
+  @param    character [in]:   Character to classify.
+
+  @return   The token type of the punctuator.
+            TOKEN_ERROR if the character is not a known punctuator.
+ =========================================================================== **/
+static token_type_t Frost_lexerPunctuator(char character)
+{
+    /*< Variable Declarations >*/
+    token_type_t type_out = TOKEN_ERROR;
+
+    /*< Start Function Algorithm >*/
+    switch (character)
+    {
+        case '+':   type_out = TOKEN_PLUS;              break;
+        case '-':   type_out = TOKEN_MINUS;             break;
+        case '*':   type_out = TOKEN_MULTIPLY;          break;
+        case '/':   type_out = TOKEN_DIVIDE;            break;
+        case '%':   type_out = TOKEN_MODULO;            break;
+        case '<':   type_out = TOKEN_LESS;              break;
+        case '>':   type_out = TOKEN_GREATER;           break;
+        case '!':   type_out = TOKEN_NOT;               break;
+        case '=':   type_out = TOKEN_ASSIGN;            break;
+        case '&':   type_out = TOKEN_BITWISE_AND;       break;
+        case '|':   type_out = TOKEN_BITWISE_OR;        break;
+        case '^':   type_out = TOKEN_BITWISE_XOR;       break;
+        case '~':   type_out = TOKEN_BITWISE_NOT;       break;
+        case ';':   type_out = TOKEN_SEMICOLON;         break;
+        case ',':   type_out = TOKEN_COMMA;             break;
+        case '.':   type_out = TOKEN_PERIOD;            break;
+        case ':':   type_out = TOKEN_COLON;             break;
+        case '(':   type_out = TOKEN_LEFT_PAREN;        break;
+        case ')':   type_out = TOKEN_RIGHT_PAREN;       break;
+        case '{':   type_out = TOKEN_LEFT_BRACE;        break;
+        case '}':   type_out = TOKEN_RIGHT_BRACE;       break;
+        case '[':   type_out = TOKEN_LEFT_BRACKET;      break;
+        case ']':   type_out = TOKEN_RIGHT_BRACKET;     break;
+        default:                                        break;
+    }
+
+    /*< Function Output >*/
+    return type_out;
+}
+
+/** ============================================================================
+  @fn       Frost_lexerLoadWord
+  @package  Frost_Lexer
+
+  @brief    Loads the next four source bytes as one unaligned integer.
+
+  @details  Borrowed sources carry no padding, so near the end of the buffer
+            only the remaining bytes are copied and the rest of the word
+            reads as zero. Both paths compile to a single load or a short
+            copy; no byte past `end` is ever touched.
+
+  @param    source    [in]:   Buffer containing the source code.
+  @param    pos       [in]:   Offset of the first byte to load.
+  @param    end       [in]:   Number of bytes of source.
+
+  @return   The bytes at pos, in memory order.
+ =========================================================================== **/
+static inline uint32_t Frost_lexerLoadWord(const char *source, size_t pos, size_t end)
+{
+    /*< Variable Declarations >*/
+    uint32_t word = 0u;
+
+    /*< Start Function Algorithm >*/
+    if ((end - pos) >= sizeof(word))
+    {
+        memcpy(&word, source + pos, sizeof(word));
+    }
+    else if (pos < end)
+    {
+        memcpy(&word, source + pos, end - pos);
+    }
+
+    /*< Function Output >*/
+    return word;
+}
+
+/** ============================================================================
+  @fn       Frost_lexerOperator
+  @package  Frost_Lexer
+
+  @brief    Recognizes the operator or punctuator at the cursor.
+
+  @details  The word at the cursor is masked down to three characters and
+            compared against every entry of lexer_operators3, then down to
+            two characters and compared against lexer_operators; there are
+            no per-character peeks or bound checks. Without a match, the
+            first character is mapped by Frost_lexerPunctuator.
+
+  @param    word      [in]:   Word loaded by Frost_lexerLoadWord.
+  @param    length    [out]:  Number of characters in the operator.
+
+  @return   The token type of the operator.
+            TOKEN_ERROR if the character is not a known punctuator.
+ =========================================================================== **/
+static token_type_t Frost_lexerOperator(uint32_t word, size_t *length)
+{
+    /*< Variable Declarations >*/
+    token_type_t type_out   = TOKEN_ERROR;
+    uint32_t triple         = word & LEXER_WORD_MASK3;
+    uint32_t pair           = word & LEXER_WORD_MASK2;
+    size_t entry            = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (entry = 0u; entry < (sizeof(lexer_operators3) / sizeof(lexer_operators3[0])); entry++)
+    {
+        if (triple == lexer_operators3[entry].pattern)
+        {
+            *length = 3u;
+            type_out = lexer_operators3[entry].type;
+            goto end_of_function;
+        }
+    }
+
+    for (entry = 0u; entry < (sizeof(lexer_operators) / sizeof(lexer_operators[0])); entry++)
+    {
+        if (pair == lexer_operators[entry].pattern)
+        {
+            *length = 2u;
+            type_out = lexer_operators[entry].type;
+            goto end_of_function;
+        }
+    }
+
+    *length = 1u;
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    type_out = Frost_lexerPunctuator((char)(word >> 24));
+#else
+    type_out = Frost_lexerPunctuator((char)(word & 0xFFu));
+#endif
+
+    /*< Function Output >*/
+end_of_function:
+    return type_out;
+}
+
+/** ============================================================================
+  @fn       Frost_lexerScan
+  @package  Frost_Lexer
+
+  @brief    Finds the extent and type of the next token.
+
+  @details  Core scanner shared by every tokenization API. It works on the
+            raw source with a local cursor, skips whitespace, and recognizes
+            one token without allocating anything. The first byte selects the
+            token class through lexer_dispatch; see LEXER_COMPUTED_GOTO for
+            how the jump is made. The lexer cursor is left right after the
+            token. Unterminated literals and block comments
+            run to the end of the line or source and yield TOKEN_ERROR.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+  @param    offset    [out]:  Offset of the first character of the token.
+  @param    length    [out]:  Number of characters in the token.
+
+  @return   The type of the token, TOKEN_EOF at the end of the source.
+ =========================================================================== **/
+static token_type_t Frost_lexerScan(lexer_t *lexer, size_t *offset, size_t *length)
+{
+    /*< Variable Declarations >*/
+    const char *source  = lexer->source;
+    size_t end          = lexer->source_size;
+    size_t pos          = lexer->index;
+    size_t start        = 0u;
+    size_t length_op    = 0u;
+    token_type_t type   = TOKEN_ERROR;
+    char quote          = '\0';
+
+    /*< Skip Whitespace >*/
+    while ( (pos < end) && (LEXER_IS(source[pos], LEXER_CHAR_SPACE)) )
+    {
+        pos++;
+    }
+
+    start = pos;
+
+    /*< Start Function Algorithm >*/
+    if (pos >= end)
+    {
+        type = TOKEN_EOF;
+        goto end_of_function;
+    }
+
+#if LEXER_COMPUTED_GOTO
+    static const void *const lexer_dispatch_labels[] =
+    {
+        [LEXER_CLASS_OPERATOR]  = &&lexer_case_LEXER_CLASS_OPERATOR,
+        [LEXER_CLASS_END]       = &&lexer_case_LEXER_CLASS_END,
+        [LEXER_CLASS_IDENT]     = &&lexer_case_LEXER_CLASS_IDENT,
+        [LEXER_CLASS_DIGIT]     = &&lexer_case_LEXER_CLASS_DIGIT,
+        [LEXER_CLASS_QUOTE]     = &&lexer_case_LEXER_CLASS_QUOTE,
+        [LEXER_CLASS_SLASH]     = &&lexer_case_LEXER_CLASS_SLASH,
+    };
+#endif
+
+    LEXER_DISPATCH(lexer_dispatch[(unsigned char)source[pos]])
+    {
+        LEXER_CASE(LEXER_CLASS_END)
+        {
+            type = TOKEN_EOF;
+            LEXER_NEXT;
+        }
+
+        LEXER_CASE(LEXER_CLASS_IDENT)
+        {
+            /*< Identifier >*/
+            type = TOKEN_ID;
+
+            do
+            {
+                pos++;
+            } while ( (pos < end) && (LEXER_IS(source[pos], LEXER_CHAR_IDENT)) );
+            LEXER_NEXT;
+        }
+
+        LEXER_CASE(LEXER_CLASS_DIGIT)
+        {
+            /*< Numeric literal, suffixes and radix prefixes included >*/
+            type = TOKEN_LITERAL_INT;
+
+            do
+            {
+                if (source[pos] == '.')
+                {
+                    type = TOKEN_LITERAL_FLOAT;
+                }
+
+                pos++;
+            } while ( (pos < end) && (LEXER_IS(source[pos], LEXER_CHAR_NUMBER)) );
+            LEXER_NEXT;
+        }
+
+        LEXER_CASE(LEXER_CLASS_QUOTE)
+        {
+            /*< String or character literal >*/
+            quote = source[pos++];
+
+            while ( (pos < end) && (source[pos] != quote) && (source[pos] != '\n') )
+            {
+                pos += ( (source[pos] == '\\') && ((pos + 1u) < end) ) ? 2u : 1u;
+            }
+
+            if ( (pos < end) && (source[pos] == quote) )
+            {
+                pos++;
+                type = (quote == '"') ? TOKEN_LITERAL_STRING : TOKEN_LITERAL_CHAR;
+            }
+            LEXER_NEXT;
+        }
+
+        LEXER_CASE(LEXER_CLASS_SLASH)
+        {
+            if ( ((pos + 1u) < end) && (source[pos + 1u] == '/') )
+            {
+                /*< Line comment >*/
+                type = TOKEN_COMMENT;
+
+                while ( (pos < end) && (source[pos] != '\n') )
+                {
+                    pos++;
+                }
+                LEXER_NEXT;
+            }
+
+            if ( ((pos + 1u) < end) && (source[pos + 1u] == '*') )
+            {
+                /*< Block comment >*/
+                pos += 2u;
+
+                while ( ((pos + 1u) < end) && !((source[pos] == '*') && (source[pos + 1u] == '/')) )
+                {
+                    pos++;
+                }
+
+                if ((pos + 1u) < end)
+                {
+                    pos += 2u;
+                    type = TOKEN_COMMENT;
+                }
+                else
+                {
+                    pos = end;
+                }
+                LEXER_NEXT;
+            }
+
+            /*< Division operator >*/
+        }
+        LEXER_FALLTHROUGH;
+
+        LEXER_CASE(LEXER_CLASS_OPERATOR)
+        {
+            /*< Operator or punctuator, longest match first >*/
+            type = Frost_lexerOperator(Frost_lexerLoadWord(source, pos, end), &length_op);
+            pos += length_op;
+            LEXER_NEXT;
+        }
+    }
+
+#if LEXER_COMPUTED_GOTO
+lexer_dispatch_done:
+#endif
+
+    /*< Function Output >*/
+end_of_function:
+    lexer->index        = pos;
+    lexer->current_char = (pos < end) ? source[pos] : '\0';
+
+    *offset = start;
+    *length = pos - start;
+
+    return type;
+}
+
+/** ============================================================================
+  @fn       Frost_lexerClassifyBlock
+  @package  Frost_Lexer
+
+  @brief    Stage 1 of the structural engine: classifies one source block.
+
+  @details  Builds the class bitmasks of the block without branching on its
+            contents, 16 bytes per SSE2 compare when available. A byte is a
+            token start when it is not whitespace and does not continue an
+            identifier run; the carry from the previous block is taken from
+            the byte just before it. The last partial block is copied into a
+            zeroed buffer, so borrowed sources are never read past their size.
+
+  @param    source    [in]:   Buffer containing the source code.
+  @param    size      [in]:   Number of bytes of source.
+  @param    block     [in]:   Index of the block to classify.
+  @param    masks     [out]:  Bitmasks of the block.
+ =========================================================================== **/
+static void Frost_lexerClassifyBlock(const char *source, size_t size, size_t block,
+                                     lexer_block_t *masks)
+{
+    /*< Variable Declarations >*/
+    unsigned char bytes[LEXER_BLOCK_SIZE]   = { 0u };
+    const unsigned char *data               = NULL;
+    size_t base                             = block * LEXER_BLOCK_SIZE;
+    size_t lane                             = 0u;
+    uint64_t carry                          = 0u;
+
+    /*< Start Function Algorithm >*/
+    if ((size - base) >= LEXER_BLOCK_SIZE)
+    {
+        data = (const unsigned char *)source + base;
+    }
+    else
+    {
+        memcpy(bytes, source + base, size - base);
+        data = bytes;
+    }
+
+    masks->space    = 0u;
+    masks->ident    = 0u;
+    masks->dot      = 0u;
+
+#if defined(__SSE2__)
+    for (lane = 0u; lane < LEXER_BLOCK_SIZE; lane += 16u)
+    {
+        const __m128i chunk = _mm_loadu_si128((const __m128i *)(const void *)(data + lane));
+        const __m128i lower = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+        const __m128i alpha = _mm_cmplt_epi8(_mm_add_epi8(lower, _mm_set1_epi8((char)(0x80 - 'a'))),
+                                             _mm_set1_epi8((char)(0x80 + 26)));
+        const __m128i digit = _mm_cmplt_epi8(_mm_add_epi8(chunk, _mm_set1_epi8((char)(0x80 - '0'))),
+                                             _mm_set1_epi8((char)(0x80 + 10)));
+        const __m128i under = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_'));
+        const __m128i blank = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')),
+                                                        _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))),
+                                           _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')),
+                                                        _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'))));
+
+        masks->space    |= (uint64_t)(uint16_t)_mm_movemask_epi8(blank) << lane;
+        masks->ident    |= (uint64_t)(uint16_t)_mm_movemask_epi8(
+                               _mm_or_si128(_mm_or_si128(alpha, digit), under)) << lane;
+        masks->dot      |= (uint64_t)(uint16_t)_mm_movemask_epi8(
+                               _mm_cmpeq_epi8(chunk, _mm_set1_epi8('.'))) << lane;
+    }
+#else
+    for (lane = 0u; lane < LEXER_BLOCK_SIZE; lane++)
+    {
+        const unsigned char c = data[lane];
+
+        masks->space    |= (uint64_t)LEXER_IS(c, LEXER_CHAR_SPACE) << lane;
+        masks->ident    |= (uint64_t)LEXER_IS(c, LEXER_CHAR_IDENT) << lane;
+        masks->dot      |= (uint64_t)(c == '.') << lane;
+    }
+#endif
+
+    if (base > 0u)
+    {
+        carry = (uint64_t)LEXER_IS(source[base - 1u], LEXER_CHAR_IDENT);
+    }
+
+    masks->starts = ~masks->space & ~(masks->ident & ((masks->ident << 1) | carry));
+}
+
 /** ============================================================================
   @fn       Frost_initLexer
   @package  Frost_Lexer
@@ -73,7 +764,52 @@ lexer_t *Frost_initLexer(char *source)
     }
 
     /*< Allocate Memory >*/
-    lexer_out = (lexer_t *)calloc(1u, sizeof(lexer_t));
+    lexer_out = (lexer_t *)Frost_memCalloc(1u, sizeof(lexer_t), FROST_MEM_LEXER);
+    if (lexer_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for lexer.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_lexerAttach(lexer_out, source, strlen(source), true);
+
+   /*< Function Output >*/
+end_of_function:
+    return lexer_out;
+}
+
+/** ============================================================================
+  @fn       Frost_initLexerView
+  @package  Frost_Lexer
+
+  @brief    Initializes a lexer over a borrowed source buffer.
+
+  @details  Allocates a lexer that reads the given bytes in place. The source
+            is neither copied nor freed, and does not need to be
+            NUL-terminated, so it may live in an mmap, a string literal or a
+            slice of a larger buffer. It must outlive the lexer.
+
+  @param    source    [in]:   Buffer containing the source code to be tokenized.
+  @param    size      [in]:   Number of bytes of source to tokenize.
+
+  @return   Pointer to a newly created lexer object on success.
+            NULL if the source is NULL or memory allocation fails.
+ =========================================================================== **/
+lexer_t *Frost_initLexerView(const char *source, size_t size)
+{
+    /*< Variable Declarations >*/
+    lexer_t *lexer_out = NULL;
+
+    /*< Security Checks >*/
+    if (source == NULL)
+    {
+        LOG_ERROR("Source entry point is NULL.");
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    lexer_out = (lexer_t *)Frost_memCalloc(1u, sizeof(lexer_t), FROST_MEM_LEXER);
     if (lexer_out == NULL)
     {
         LOG_ERROR("Memory allocation failed for lexer.");
@@ -81,10 +817,7 @@ lexer_t *Frost_initLexer(char *source)
     }
 
     /*< Start Function Algorithm >*/
-    lexer_out->source       = source;
-    lexer_out->source_size  = strlen(source);
-    lexer_out->index        = 0u;
-    lexer_out->current_char = (char)(source[lexer_out->index]);
+    Frost_lexerAttach(lexer_out, source, size, false);
 
    /*< Function Output >*/
 end_of_function:
@@ -98,7 +831,8 @@ end_of_function:
   @brief    Frees the memory associated with a lexer object.
 
   @details  Releases all memory allocated for the lexer, including its source
-            and the lexer itself. If the lexer is NULL, returns an error code.
+            when the lexer owns it, and the lexer itself. If the lexer is NULL,
+            returns an error code.
 
   @param    lexer     [in]:   Pointer to the lexer to be freed.
 
@@ -113,15 +847,18 @@ int Frost_freeLexer(lexer_t *lexer)
     /*< Start Function Algorithm >*/
     if (lexer != NULL)
     {
-        free(lexer->source); 
-        free(lexer);
+        if (lexer->owns_source)
+        {
+            Frost_memFree((char *)lexer->source, 0u, FROST_MEM_SOURCE);
+        }
 
         lexer->source   = NULL;
-        lexer           = NULL;
+
+        Frost_memFree(lexer, sizeof(lexer_t), FROST_MEM_LEXER);
     }
     else
     {
-        LOG_ERRROR("Lexer entry point is NULL.");
+        LOG_ERROR("Lexer entry point is NULL.");
         ret = -ENOMEM;
         goto end_of_function;
     }
@@ -131,6 +868,163 @@ end_of_function:
     return ret;
 }
 
+/** ============================================================================
+  @fn       Frost_lexerReset
+  @package  Frost_Lexer
+
+  @brief    Re-targets an existing lexer to a new source buffer.
+
+  @details  Releases the previous source exactly as Frost_freeLexer would,
+            takes ownership of the new one, and rewinds the cursor to its
+            first character. The lexer object itself is kept, so a pooled
+            lexer can scan any number of buffers without being reallocated.
+            The size is given explicitly; no `strlen` pass is made over the
+            new source.
+
+  @param    lexer     [in]:   Pointer to the lexer to be reset.
+  @param    source    [in]:   String containing the source code to be tokenized.
+  @param    size      [in]:   Length of the source, excluding the terminator.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the lexer or the source is NULL.
+ =========================================================================== **/
+int Frost_lexerReset(lexer_t *lexer, char *source, size_t size)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if ( (lexer == NULL) || (source == NULL) )
+    {
+        LOG_ERROR("Lexer entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_lexerAttach(lexer, source, size, true);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_lexerResetView
+  @package  Frost_Lexer
+
+  @brief    Re-targets an existing lexer to a borrowed source buffer.
+
+  @details  Same as Frost_lexerReset, except that the new source is borrowed:
+            it is neither copied nor freed, and need not be NUL-terminated.
+
+  @param    lexer     [in]:   Pointer to the lexer to be reset.
+  @param    source    [in]:   Buffer containing the source code to be tokenized.
+  @param    size      [in]:   Number of bytes of source to tokenize.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the lexer or the source is NULL.
+ =========================================================================== **/
+int Frost_lexerResetView(lexer_t *lexer, const char *source, size_t size)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if ( (lexer == NULL) || (source == NULL) )
+    {
+        LOG_ERROR("Lexer entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_lexerAttach(lexer, source, size, false);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_lexerCheckpoint
+  @package  Frost_Lexer
+
+  @brief    Saves the current position of a lexer.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+
+  @return   Checkpoint of the current position. A NULL lexer yields a
+            checkpoint that no lexer accepts.
+ =========================================================================== **/
+lexer_checkpoint_t Frost_lexerCheckpoint(const lexer_t *lexer)
+{
+    /*< Variable Declarations >*/
+    lexer_checkpoint_t checkpoint_out = { NULL, 0u };
+
+    /*< Security Checks >*/
+    if (lexer == NULL)
+    {
+        LOG_ERROR("Lexer entry point is NULL.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    checkpoint_out.source   = lexer->source;
+    checkpoint_out.index    = lexer->index;
+
+    /*< Function Output >*/
+end_of_function:
+    return checkpoint_out;
+}
+
+/** ============================================================================
+  @fn       Frost_lexerRestore
+  @package  Frost_Lexer
+
+  @brief    Rewinds a lexer to a previously saved position.
+
+  @details  Runs in constant time: only the index and the current character
+            are restored. Tokens already handed out by the lexer are not
+            affected.
+
+  @param    lexer       [in]: Pointer to the lexer.
+  @param    checkpoint  [in]: Position saved with Frost_lexerCheckpoint.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the lexer is NULL.
+            -EINVAL if the checkpoint was taken on another source.
+ =========================================================================== **/
+int Frost_lexerRestore(lexer_t *lexer, lexer_checkpoint_t checkpoint)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (lexer == NULL)
+    {
+        LOG_ERROR("Lexer entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if ( (checkpoint.source != lexer->source) || (checkpoint.index > lexer->source_size) )
+    {
+        LOG_ERROR("Checkpoint does not belong to this lexer source.");
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    lexer->index        = checkpoint.index;
+    lexer->current_char = (checkpoint.index < lexer->source_size) ?
+                          lexer->source[checkpoint.index] : '\0';
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
 /** ============================================================================
   @fn       Frost_lexerAdvance
   @package  Frost_Lexer
@@ -162,7 +1056,8 @@ int Frost_lexerAdvance(lexer_t *lexer)
     if ( (lexer->index < lexer->source_size) && (lexer->current_char != '\0') )
     {
         lexer->index++;
-        lexer->current_char = lexer->source[lexer->index];
+        lexer->current_char = (lexer->index < lexer->source_size) ?
+                              lexer->source[lexer->index] : '\0';
     }
 
     /*< Function Output >*/
@@ -239,12 +1134,7 @@ int Frost_lexerSkipWhiteSpace(lexer_t *lexer)
     }
 
     /*< Start Function Algorithm >*/
-    while ( 
-            (lexer->current_char == 13)     || 
-            (lexer->current_char == 10)     || 
-            (lexer->current_char == ' ')    ||
-            (lexer->current_char == '\t')
-          )
+    while (LEXER_IS(lexer->current_char, LEXER_CHAR_SPACE))
     {
         Frost_lexerAdvance(lexer);
     }
@@ -273,7 +1163,7 @@ token_t *Frost_lexerParseID(lexer_t *lexer)
 {
     /*< Variable Declarations >*/
     token_t *token_out  = NULL;
-    char *value         = NULL;
+    size_t start        = 0u;
     
     /*< Security Checks >*/
     if (lexer == NULL)
@@ -282,29 +1172,15 @@ token_t *Frost_lexerParseID(lexer_t *lexer)
         goto end_of_function;
     }
 
-    /*< Allocate Memory >*/
-    value = (char *)calloc(1, sizeof(char));
-    if (value == NULL)
-    {
-        LOG_ERROR("Fail at alloc for value.");
-        goto end_of_function;
-    }
-
     /*< Start Function Algorithm >*/
-    while (isalnum(lexer->current_char))
-    {
-        value = (char *)realloc(value, ((strlen(value) + 2u) * sizeof(char)));
-        if (value == NULL)
-        {
-            LOG_ERROR("Fail at realloc for value.");
-            goto end_of_function;
-        }
+    start = lexer->index;
 
-        strcat(value, (char[]){lexer->current_char, 0u});
+    while (LEXER_IS(lexer->current_char, LEXER_CHAR_IDENT))
+    {
         Frost_lexerAdvance(lexer);
     }
 
-    token_out = Frost_initToken(value, TOKEN_ID);
+    token_out = Frost_initTokenSpan(lexer->source + start, lexer->index - start, TOKEN_ID);
 
     /*< Function Output >*/
 end_of_function:
@@ -320,17 +1196,17 @@ end_of_function:
   @details  Looks ahead or behind in the source string by a given offset relative
             to the current index in the lexer. Ensures that the returned character
             does not exceed the bounds of the source string. Returns a default
-            space character if the lexer is NULL or if the calculated offset is
-            invalid.
+            space character if the lexer is NULL, and the NUL character if the
+            calculated offset falls outside of the source.
 
   @param    lexer     [in]:   Pointer to the lexer.
   @param    offset    [in]:   Offset from the current index to peek the character.
 
   @return   The character at the specified offset on success.
-            A default space character (' ') if the lexer is NULL or the offset
-            exceeds the bounds of the source string.
+            A default space character (' ') if the lexer is NULL.
+            The NUL character ('\0') if the offset is out of bounds.
  =========================================================================== **/
-char Frost_lexerPeek(lexer_t *lexer, int offset)
+char Frost_lexerPeek(const lexer_t *lexer, int offset)
 {
     /*< Variable Declarations >*/
     char ret = ' ';
@@ -343,7 +1219,43 @@ char Frost_lexerPeek(lexer_t *lexer, int offset)
     }
 
     /*< Start Function Algorithm >*/
-    ret = (char)lexer->source[MIN((lexer->index + offset), lexer->source_size)];
+    ret = ((lexer->index + offset) < lexer->source_size) ?
+          lexer->source[lexer->index + offset] : '\0';
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_lexerPeekWord
+  @package  Frost_Lexer
+
+  @brief    Returns the next four source bytes as one integer.
+
+  @details  Lookahead primitive for multi-character matches: one load
+            replaces a chain of Frost_lexerPeek calls. Bytes past the end of
+            the source read as zero.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+
+  @return   The four bytes at the cursor, in memory order.
+            Zero if the lexer is NULL.
+ =========================================================================== **/
+uint32_t Frost_lexerPeekWord(const lexer_t *lexer)
+{
+    /*< Variable Declarations >*/
+    uint32_t ret = 0u;
+
+    /*< Security Checks >*/
+    if (lexer == NULL)
+    {
+        LOG_ERROR("Lexer entry point is NULL.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Frost_lexerLoadWord(lexer->source, lexer->index, lexer->source_size);
 
     /*< Function Output >*/
 end_of_function:
@@ -356,9 +1268,11 @@ end_of_function:
 
   @brief    Retrieves the next token from the source string.
 
-  @details  Identifies and returns the next token in the source string. If the
-            token is an identifier, it calls Frost_lexerParseID. If no valid
-            token is found, it returns an EOF token.
+  @details  Identifies and returns the next token in the source string.
+            Whitespace is skipped; identifiers, numeric, character and string
+            literals, comments, operators and punctuators are
+            recognized, and any other character yields a TOKEN_ERROR token.
+            When the end of the source is reached, it returns an EOF token.
 
   @param    lexer     [in]:   Pointer to the lexer.
 
@@ -368,8 +1282,12 @@ end_of_function:
 token_t *Frost_nextToken(lexer_t *lexer)
 {
     /*< Variable Declarations >*/
-    token_t *token_out = NULL;
-    
+    token_t *token_out      = NULL;
+    token_type_t type       = TOKEN_EOF;
+    size_t offset           = 0u;
+    size_t length           = 0u;
+    trace_phase_t previous  = TRACE_PHASE_OTHER;
+
     /*< Security Checks >*/
     if (lexer == NULL)
     {
@@ -378,27 +1296,295 @@ token_t *Frost_nextToken(lexer_t *lexer)
     }
 
     /*< Start Function Algorithm >*/
-    while (lexer->current_char != '\0')
+    previous    = Frost_tracePhaseEnter(TRACE_PHASE_LEX);
+    type        = Frost_lexerScan(lexer, &offset, &length);
+    token_out   = Frost_initTokenSpan(lexer->source + offset, length, type);
+    Frost_tracePhaseLeave(previous);
+
+    FROST_PROBE3(token, type, offset, length);
+    Frost_flightRecord(FLIGHT_EVENT_TOKEN, (uint32_t)type, offset);
+    if (type == TOKEN_EOF)
+    {
+        FROST_PROBE2(lex__done, lexer->source, lexer->source_size);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return token_out;
+}
+
+/** ============================================================================
+  @fn       Frost_nextTokenInto
+  @package  Frost_Lexer
+
+  @brief    Retrieves the next token into caller-owned storage.
+
+  @details  Allocation-free variant of Frost_nextToken: the token is written
+            by value into a token view whose lexeme points into the lexer
+            source. At the end of the source the view is set to TOKEN_EOF
+            with a zero length.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+  @param    token     [out]:  Caller-owned token view to fill.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the lexer or the token is NULL.
+ =========================================================================== **/
+int Frost_nextTokenInto(lexer_t *lexer, token_view_t *token)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if ( (lexer == NULL) || (token == NULL) )
+    {
+        LOG_ERROR("Lexer entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    token->type     = Frost_lexerScan(lexer, &token->offset, &token->length);
+    token->lexeme   = lexer->source + token->offset;
+
+    FROST_PROBE3(token, token->type, token->offset, token->length);
+    Frost_flightRecord(FLIGHT_EVENT_TOKEN, (uint32_t)token->type, token->offset);
+    if (token->type == TOKEN_EOF)
+    {
+        FROST_PROBE2(lex__done, lexer->source, lexer->source_size);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_lexWithCallback
+  @package  Frost_Lexer
+
+  @brief    Streams every remaining token of the source to a callback.
+
+  @details  Runs the same scanner as Frost_nextToken, but instead of building
+            token objects it hands the type, offset and length of each token
+            to the callback from inside the lexing loop. Nothing is
+            allocated, so a whole file is processed in O(1) memory. The final
+            TOKEN_EOF token is delivered too.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+  @param    callback  [in]:   Function receiving each token.
+  @param    ctx       [in]:   User context passed to the callback.
+
+  @return   FUNCTION_SUCCESS once the end of the source was delivered.
+            -ENOMEM if the lexer or the callback is NULL.
+            The value returned by the callback, if it stopped early.
+ =========================================================================== **/
+int Frost_lexWithCallback(lexer_t *lexer, lexer_callback_t callback, void *ctx)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCESS;
+    token_type_t type   = TOKEN_EOF;
+    size_t offset       = 0u;
+    size_t length       = 0u;
+    trace_span_t span   = { 0 };
+
+    /*< Security Checks >*/
+    if ( (lexer == NULL) || (callback == NULL) )
+    {
+        LOG_ERROR("Lexer entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_traceBegin(&span, TRACE_PHASE_LEX, NULL);
+
+    do
+    {
+        type    = Frost_lexerScan(lexer, &offset, &length);
+        FROST_PROBE3(token, type, offset, length);
+        Frost_flightRecord(FLIGHT_EVENT_TOKEN, (uint32_t)type, offset);
+
+        /*< The consumer is not lexing: its time and allocations belong to the caller >*/
+        Frost_traceSuspend(&span);
+        ret     = callback(type, offset, length, ctx);
+        Frost_traceResume(&span);
+    } while ( (ret == FUNCTION_SUCESS) && (type != TOKEN_EOF) );
+
+    if (type == TOKEN_EOF)
+    {
+        FROST_PROBE2(lex__done, lexer->source, lexer->source_size);
+    }
+
+    Frost_traceEnd(&span);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_lexStructural
+  @package  Frost_Lexer
+
+  @brief    Streams every remaining token of the source to a callback, using
+            the two-stage structural engine.
+
+  @details  Produces exactly the tokens of Frost_lexWithCallback. Stage 1
+            (Frost_lexerClassifyBlock) turns each 64-byte block into
+            whitespace, identifier and token-start bitmasks. Stage 2 walks
+            the start bits: identifiers and numbers end at the first cleared
+            bit of the identifier mask, found with a count-trailing-zeros
+            instead of a per-byte loop, and every other token is handed to
+            the shared scanner from its start. After each token, the start
+            bits it covers are dropped with a single mask, so bits inside
+            strings and comments never need to be visited.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+  @param    callback  [in]:   Function receiving each token.
+  @param    ctx       [in]:   User context passed to the callback.
+
+  @return   FUNCTION_SUCCESS once the end of the source was delivered.
+            -ENOMEM if the lexer or the callback is NULL.
+            The value returned by the callback, if it stopped early.
+ =========================================================================== **/
+int Frost_lexStructural(lexer_t *lexer, lexer_callback_t callback, void *ctx)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCESS;
+    const char *source  = NULL;
+    size_t size         = 0u;
+    size_t pos          = 0u;
+    size_t start        = 0u;
+    size_t block        = 0u;
+    size_t length       = 0u;
+    uint64_t starts     = 0u;
+    uint64_t run        = 0u;
+    uint64_t span       = 0u;
+    token_type_t type   = TOKEN_EOF;
+    lexer_block_t masks = { 0u };
+    trace_span_t trace  = { 0 };
+    unsigned char c     = 0u;
+
+    /*< Security Checks >*/
+    if ( (lexer == NULL) || (callback == NULL) )
+    {
+        LOG_ERROR("Lexer entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_traceBegin(&trace, TRACE_PHASE_LEX, NULL);
+
+    source  = lexer->source;
+    size    = lexer->source_size;
+    pos     = MIN(lexer->index, size);
+    block   = pos / LEXER_BLOCK_SIZE;
+
+    if (pos < size)
     {
-        if (isaalpha(lexer->current_char))
+        /*< The cursor may sit inside an identifier run; it still starts a token >*/
+        Frost_lexerClassifyBlock(source, size, block, &masks);
+        starts = (masks.starts | (~masks.space & (UINT64_C(1) << (pos % LEXER_BLOCK_SIZE)))) &
+                 (~UINT64_C(0) << (pos % LEXER_BLOCK_SIZE));
+    }
+
+    do
+    {
+        /*< Find the next start bit >*/
+        while ( (starts == 0u) && (((block + 1u) * LEXER_BLOCK_SIZE) < size) )
         {
-            token_out = Frost_lexerAdvanceWith(lexer, Frost_lexerParseID(lexer));
-            goto end_of_function;
+            block++;
+            Frost_lexerClassifyBlock(source, size, block, &masks);
+            starts = masks.starts;
         }
 
-        switch (lexer->current_char)
+        start   = (starts != 0u) ? (block * LEXER_BLOCK_SIZE) + (size_t)__builtin_ctzll(starts) : size;
+        c       = (start < size) ? (unsigned char)source[start] : 0u;
+        pos     = start;
+
+        if ( (start < size) && (LEXER_IS(c, LEXER_CHAR_IDENT)) )
+        {
+            /*< Identifier or number: run of identifier bits, and periods for numbers >*/
+            type = (LEXER_IS(c, LEXER_CHAR_DIGIT)) ? TOKEN_LITERAL_INT : TOKEN_ID;
+
+            for (;;)
+            {
+                run = (type == TOKEN_ID) ? masks.ident : (masks.ident | masks.dot);
+                run = ~run & (~UINT64_C(0) << (pos % LEXER_BLOCK_SIZE));
+
+                span = ~UINT64_C(0) << (pos % LEXER_BLOCK_SIZE);
+                if (run != 0u)
+                {
+                    span &= (UINT64_C(1) << __builtin_ctzll(run)) - 1u;
+                }
+
+                if ( (type != TOKEN_ID) && ((masks.dot & span) != 0u) )
+                {
+                    type = TOKEN_LITERAL_FLOAT;
+                }
+
+                if (run != 0u)
+                {
+                    pos = (block * LEXER_BLOCK_SIZE) + (size_t)__builtin_ctzll(run);
+                    break;
+                }
+
+                pos = (block + 1u) * LEXER_BLOCK_SIZE;
+                if (pos >= size)
+                {
+                    break;
+                }
+
+                block++;
+                Frost_lexerClassifyBlock(source, size, block, &masks);
+            }
+
+            pos = MIN(pos, size);
+        }
+        else
         {
-            case ':':
+            /*< Literals, comments, punctuators and EOF go through the shared scanner >*/
+            lexer->index    = start;
+            type            = Frost_lexerScan(lexer, &start, &length);
+            pos             = start + length;
+        }
+
+        FROST_PROBE3(token, type, start, pos - start);
+        Frost_flightRecord(FLIGHT_EVENT_TOKEN, (uint32_t)type, start);
+
+        /*< The consumer is not lexing: its time and allocations belong to the caller >*/
+        Frost_traceSuspend(&trace);
+        ret = callback(type, start, pos - start, ctx);
+        Frost_traceResume(&trace);
 
-                break;
+        /*< Drop the start bits covered by the token >*/
+        if ((pos / LEXER_BLOCK_SIZE) != block)
+        {
+            block = pos / LEXER_BLOCK_SIZE;
+            if (pos < size)
+            {
+                Frost_lexerClassifyBlock(source, size, block, &masks);
+            }
         }
+
+        starts = (pos < size) ? (masks.starts & (~UINT64_C(0) << (pos % LEXER_BLOCK_SIZE))) : 0u;
+    } while ( (ret == FUNCTION_SUCESS) && (type != TOKEN_EOF) );
+
+    lexer->index        = pos;
+    lexer->current_char = (pos < size) ? source[pos] : '\0';
+
+    if (type == TOKEN_EOF)
+    {
+        FROST_PROBE2(lex__done, source, size);
     }
 
-    token_out = Frost_initToken(0u, TOKEN_EOF);
+    Frost_traceEnd(&trace);
 
     /*< Function Output >*/
 end_of_function:
-    return token_out;
+    return ret;
 }
 
 /*< end of file >*/
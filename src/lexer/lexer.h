@@ -22,6 +22,14 @@
                   initializing the lexer to prevent errors during tokenization.
                 - The module relies on the Frost_Token module for creating and
                   managing token objects
+                - Reentrancy: every function works only on the lexer_t it is
+                  given and on read-only static tables, and never consults
+                  the C locale. Any number of lexers may run concurrently on
+                  different threads without locking, including lexers that
+                  borrow the same source buffer. A single lexer_t must not
+                  be used by two threads at once. On invalid arguments the
+                  LOG_* macros write one line with fprintf, which locks the
+                  stream for the duration of the call.
  =========================================================================== **/
 
 #ifndef LEXER_H_
@@ -33,6 +41,8 @@
 
 /*< Dependencies >*/
 #include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
 
 /*< Implements >*/
 #include "../token/token.h"
@@ -52,15 +62,56 @@
   @details  The lexer structure contains the source code string being analyzed,
             the current character being processed, the total size of the source
             string, and the current index of the lexer within the source.
+            Sources handed over by Frost_initLexer are owned by the lexer and
+            freed with it; sources given to Frost_initLexerView are borrowed
+            and never freed, copied, or read past source_size.
 ============================================================================ **/
 typedef struct __attribute__((packed)) frostLexer
 {
-    char        *source;            /*< Pointer to the source string >*/
+    const char  *source;            /*< Pointer to the source string >*/
     char        current_char;       /*< Current character being processed >*/
     size_t      source_size;        /*< Total size of the source string >*/
     size_t      index;              /*< Current index in the source string >*/
+    bool        owns_source;        /*< Source is freed along with the lexer >*/
 } lexer_t;
 
+/** ============================================================================
+  @struct   frostLexerCheckpoint
+  @package  Frost_Lexer
+
+  @typedef  lexer_checkpoint_t
+
+  @brief    Saved cursor position of a lexer, for speculative parsing.
+
+  @details  A checkpoint is a small value type that can be copied freely.
+            Restoring it rewinds the lexer in O(1); it remains valid as long
+            as the lexer is not reset to another source.
+============================================================================ **/
+typedef struct frostLexerCheckpoint
+{
+    const char  *source;            /*< Source the checkpoint belongs to >*/
+    size_t      index;              /*< Saved index in the source string >*/
+} lexer_checkpoint_t;
+
+/** ============================================================================
+  @typedef  lexer_callback_t
+  @package  Frost_Lexer
+
+  @brief    Signature of the function receiving tokens from
+            Frost_lexWithCallback.
+
+  @details  The lexeme of the token is the `length` bytes found at `offset`
+            in the lexer source; nothing is copied or allocated.
+
+  @param    type      [in]:   Type of the token.
+  @param    offset    [in]:   Offset of the first character in the source.
+  @param    length    [in]:   Number of characters in the token.
+  @param    ctx       [in]:   User context given to Frost_lexWithCallback.
+
+  @return   FUNCTION_SUCCESS to continue, any other value to stop lexing.
+============================================================================ **/
+typedef int (*lexer_callback_t)(token_type_t type, size_t offset, size_t length, void *ctx);
+
 /* ========================================================================== *\
  *                       PUBLIC FUNCTIONS PROTOTYPES                          *
 \* ========================================================================== */
@@ -73,7 +124,9 @@ typedef struct __attribute__((packed)) frostLexer
 
   @details  Allocates memory for a lexer object and initializes its internal
             fields based on the provided source string. If the source is NULL,
-            or memory allocation fails, it returns NULL.
+            or memory allocation fails, it returns NULL. The lexer takes
+            ownership of the source, which must come from the current
+            Frost allocator (FROST_MEM_SOURCE).
 
   @param    source    [in]:   String containing the source code to be tokenized.
 
@@ -82,6 +135,25 @@ typedef struct __attribute__((packed)) frostLexer
  =========================================================================== **/
 lexer_t *Frost_initLexer(char *source);
 
+/** ============================================================================
+  @fn       Frost_initLexerView
+  @package  Frost_Lexer
+
+  @brief    Initializes a lexer over a borrowed source buffer.
+
+  @details  Allocates a lexer that reads the given bytes in place. The source
+            is neither copied nor freed, and does not need to be
+            NUL-terminated, so it may live in an mmap, a string literal or a
+            slice of a larger buffer. It must outlive the lexer.
+
+  @param    source    [in]:   Buffer containing the source code to be tokenized.
+  @param    size      [in]:   Number of bytes of source to tokenize.
+
+  @return   Pointer to a newly created lexer object on success.
+            NULL if the source is NULL or memory allocation fails.
+ =========================================================================== **/
+lexer_t *Frost_initLexerView(const char *source, size_t size);
+
 /** ============================================================================
   @fn       Frost_freeLexer
   @package  Frost_Lexer
@@ -89,7 +161,8 @@ lexer_t *Frost_initLexer(char *source);
   @brief    Frees the memory associated with a lexer object.
 
   @details  Releases all memory allocated for the lexer, including its source
-            and the lexer itself. If the lexer is NULL, returns an error code.
+            when the lexer owns it, and the lexer itself. If the lexer is NULL,
+            returns an error code.
 
   @param    lexer     [in]:   Pointer to the lexer to be freed.
 
@@ -98,6 +171,80 @@ lexer_t *Frost_initLexer(char *source);
  =========================================================================== **/
 int Frost_freeLexer(lexer_t *lexer);
 
+/** ============================================================================
+  @fn       Frost_lexerReset
+  @package  Frost_Lexer
+
+  @brief    Re-targets an existing lexer to a new source buffer.
+
+  @details  Releases the previous source exactly as Frost_freeLexer would,
+            takes ownership of the new one (allocated like the source of
+            Frost_initLexer), and rewinds the cursor to its
+            first character. The lexer object itself is kept, so a pooled
+            lexer can scan any number of buffers without being reallocated.
+            The size is given explicitly; no `strlen` pass is made over the
+            new source.
+
+  @param    lexer     [in]:   Pointer to the lexer to be reset.
+  @param    source    [in]:   String containing the source code to be tokenized.
+  @param    size      [in]:   Length of the source, excluding the terminator.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the lexer or the source is NULL.
+ =========================================================================== **/
+int Frost_lexerReset(lexer_t *lexer, char *source, size_t size);
+
+/** ============================================================================
+  @fn       Frost_lexerResetView
+  @package  Frost_Lexer
+
+  @brief    Re-targets an existing lexer to a borrowed source buffer.
+
+  @details  Same as Frost_lexerReset, except that the new source is borrowed:
+            it is neither copied nor freed, and need not be NUL-terminated.
+            Re-targeting a lexer to the buffer it already owns keeps it owned.
+
+  @param    lexer     [in]:   Pointer to the lexer to be reset.
+  @param    source    [in]:   Buffer containing the source code to be tokenized.
+  @param    size      [in]:   Number of bytes of source to tokenize.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the lexer or the source is NULL.
+ =========================================================================== **/
+int Frost_lexerResetView(lexer_t *lexer, const char *source, size_t size);
+
+/** ============================================================================
+  @fn       Frost_lexerCheckpoint
+  @package  Frost_Lexer
+
+  @brief    Saves the current position of a lexer.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+
+  @return   Checkpoint of the current position. A NULL lexer yields a
+            checkpoint that no lexer accepts.
+ =========================================================================== **/
+lexer_checkpoint_t Frost_lexerCheckpoint(const lexer_t *lexer);
+
+/** ============================================================================
+  @fn       Frost_lexerRestore
+  @package  Frost_Lexer
+
+  @brief    Rewinds a lexer to a previously saved position.
+
+  @details  Runs in constant time: only the index and the current character
+            are restored. Tokens already handed out by the lexer are not
+            affected.
+
+  @param    lexer       [in]: Pointer to the lexer.
+  @param    checkpoint  [in]: Position saved with Frost_lexerCheckpoint.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the lexer is NULL.
+            -EINVAL if the checkpoint was taken on another source.
+ =========================================================================== **/
+int Frost_lexerRestore(lexer_t *lexer, lexer_checkpoint_t checkpoint);
+
 /** ============================================================================
   @fn       Frost_lexerAdvance
   @package  Frost_Lexer
@@ -173,17 +320,35 @@ token_t *Frost_lexerParseID(lexer_t *lexer);
   @details  Looks ahead or behind in the source string by a given offset relative
             to the current index in the lexer. Ensures that the returned character
             does not exceed the bounds of the source string. Returns a default
-            space character if the lexer is NULL or if the calculated offset is
-            invalid.
+            space character if the lexer is NULL, and the NUL character if the
+            calculated offset falls outside of the source.
 
   @param    lexer     [in]:   Pointer to the lexer.
   @param    offset    [in]:   Offset from the current index to peek the character.
 
   @return   The character at the specified offset on success.
-            A default space character (' ') if the lexer is NULL or the offset
-            exceeds the bounds of the source string.
+            A default space character (' ') if the lexer is NULL.
+            The NUL character ('\0') if the offset is out of bounds.
  =========================================================================== **/
-char Frost_lexerPeek(lexer_t *lexer, int offset);
+char Frost_lexerPeek(const lexer_t *lexer, int offset);
+
+/** ============================================================================
+  @fn       Frost_lexerPeekWord
+  @package  Frost_Lexer
+
+  @brief    Returns the next four source bytes as one integer.
+
+  @details  Lookahead primitive for multi-character matches: one unaligned
+            load replaces a chain of Frost_lexerPeek calls. The bytes are in
+            memory order, and those past the end of the source read as zero,
+            so borrowed buffers need no padding.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+
+  @return   The four bytes at the cursor, in memory order.
+            Zero if the lexer is NULL.
+ =========================================================================== **/
+uint32_t Frost_lexerPeekWord(const lexer_t *lexer);
 
 /** ============================================================================
   @fn       Frost_nextToken
@@ -191,9 +356,11 @@ char Frost_lexerPeek(lexer_t *lexer, int offset);
 
   @brief    Retrieves the next token from the source string.
 
-  @details  Identifies and returns the next token in the source string. If the
-            token is an identifier, it calls Frost_lexerParseID. If no valid
-            token is found, it returns an EOF token.
+  @details  Identifies and returns the next token in the source string.
+            Whitespace is skipped; identifiers, numeric, character and string
+            literals, comments, operators and punctuators are
+            recognized, and any other character yields a TOKEN_ERROR token.
+            When the end of the source is reached, it returns an EOF token.
 
   @param    lexer     [in]:   Pointer to the lexer.
 
@@ -202,6 +369,72 @@ char Frost_lexerPeek(lexer_t *lexer, int offset);
  =========================================================================== **/
 token_t *Frost_nextToken(lexer_t *lexer);
 
+/** ============================================================================
+  @fn       Frost_nextTokenInto
+  @package  Frost_Lexer
+
+  @brief    Retrieves the next token into caller-owned storage.
+
+  @details  Allocation-free variant of Frost_nextToken: the token is written
+            by value into a token view whose lexeme points into the lexer
+            source. At the end of the source the view is set to TOKEN_EOF
+            with a zero length.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+  @param    token     [out]:  Caller-owned token view to fill.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the lexer or the token is NULL.
+ =========================================================================== **/
+int Frost_nextTokenInto(lexer_t *lexer, token_view_t *token);
+
+/** ============================================================================
+  @fn       Frost_lexWithCallback
+  @package  Frost_Lexer
+
+  @brief    Streams every remaining token of the source to a callback.
+
+  @details  Runs the same scanner as Frost_nextToken, but instead of building
+            token objects it hands the type, offset and length of each token
+            to the callback from inside the lexing loop. Nothing is
+            allocated, so a whole file is processed in O(1) memory. The final
+            TOKEN_EOF token is delivered too. The callback runs in the phase
+            of the caller, not in TRACE_PHASE_LEX, and its time is left out
+            of the lex span.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+  @param    callback  [in]:   Function receiving each token.
+  @param    ctx       [in]:   User context passed to the callback.
+
+  @return   FUNCTION_SUCCESS once the end of the source was delivered.
+            -ENOMEM if the lexer or the callback is NULL.
+            The value returned by the callback, if it stopped early.
+ =========================================================================== **/
+int Frost_lexWithCallback(lexer_t *lexer, lexer_callback_t callback, void *ctx);
+
+/** ============================================================================
+  @fn       Frost_lexStructural
+  @package  Frost_Lexer
+
+  @brief    Streams every remaining token of the source to a callback, using
+            the two-stage structural engine.
+
+  @details  Drop-in alternative to Frost_lexWithCallback that yields the same
+            tokens. A first pass classifies the source 64 bytes at a time
+            into bitmasks; a second pass walks the token-start bits and finds
+            identifier and number ends with bit scans, which pays off on
+            plain code with long identifier runs.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+  @param    callback  [in]:   Function receiving each token.
+  @param    ctx       [in]:   User context passed to the callback.
+
+  @return   FUNCTION_SUCCESS once the end of the source was delivered.
+            -ENOMEM if the lexer or the callback is NULL.
+            The value returned by the callback, if it stopped early.
+ =========================================================================== **/
+int Frost_lexStructural(lexer_t *lexer, lexer_callback_t callback, void *ctx);
+
 #endif /* LEXER_H_ */
 
 /*< end of header file >*/
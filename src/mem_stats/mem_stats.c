@@ -0,0 +1,669 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_MemStats
+
+    @package    Frost_MemStats
+    @brief      This module accounts every allocation per memory tag and per
+                compiler phase, and reports counts, live bytes and peaks.
+
+    @file       mem_stats.c
+    @headerfile mem_stats.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Callers pass a size of zero to free and realloc when they do
+                not know it (token lexemes, owned lexer sources), so the
+                accounting allocator records the size itself: each block is
+                preceded by a mem_header_t holding the requested size, the
+                tag and the distance back to the start of the inner block.
+                The header takes MEM_STATS_HEADER_SIZE bytes, or `alignment`
+                bytes for over-aligned blocks, so the returned pointer keeps
+                the requested alignment. Inner allocators are always given
+                exact sizes, so an arena can sit underneath.
+
+    @note       - With several threads in different phases, a phase peak is
+                  the total live memory of the whole process at the moment a
+                  thread in that phase allocated, not memory of that phase
+                  alone.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <stdatomic.h>
+
+/*< Implements >*/
+#include "mem_stats.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       MEM_STATS_HEADER_SIZE
+    @brief     Room reserved before a block with the default alignment.
+============================================================================ **/
+#define MEM_STATS_HEADER_SIZE       ALIGN_UP(sizeof(mem_header_t), (size_t)ARCH_ALIGNMENT)
+
+/** ============================================================================
+    @def       MEM_STATS_KIB
+    @brief     Converts a byte count to KiB for the report.
+============================================================================ **/
+#define MEM_STATS_KIB(bytes)        ((double)(bytes) / 1024.0)
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostMemHeader
+  @package  Frost_MemStats
+
+  @typedef  mem_header_t
+
+  @brief    Bookkeeping stored right before every accounted block.
+============================================================================ **/
+typedef struct frostMemHeader
+{
+    size_t              size;           /*< Size requested by the caller >*/
+    uint32_t            tag;            /*< Tag given at allocation >*/
+    uint32_t            offset;         /*< Bytes from the inner block to the user block >*/
+} mem_header_t;
+
+/** ============================================================================
+  @struct   frostMemTagCounters
+  @package  Frost_MemStats
+
+  @typedef  mem_tag_counters_t
+
+  @brief    Live counters of one memory tag.
+============================================================================ **/
+typedef struct frostMemTagCounters
+{
+    atomic_uint_fast64_t    allocs;     /*< Blocks allocated >*/
+    atomic_uint_fast64_t    frees;      /*< Blocks freed >*/
+    atomic_uint_fast64_t    bytes;      /*< Bytes allocated >*/
+    atomic_size_t           live;       /*< Bytes currently allocated >*/
+    atomic_size_t           peak;       /*< High-water mark of live >*/
+} mem_tag_counters_t;
+
+/** ============================================================================
+  @struct   frostMemPhaseCounters
+  @package  Frost_MemStats
+
+  @typedef  mem_phase_counters_t
+
+  @brief    Live counters of one trace phase.
+============================================================================ **/
+typedef struct frostMemPhaseCounters
+{
+    atomic_uint_fast64_t    allocs;     /*< Blocks allocated >*/
+    atomic_uint_fast64_t    bytes;      /*< Bytes allocated >*/
+    atomic_size_t           peak;       /*< Highest total live bytes seen >*/
+} mem_phase_counters_t;
+
+/** ============================================================================
+  @struct   frostMemStats
+  @package  Frost_MemStats
+
+  @brief    Inner allocator plus every counter.
+============================================================================ **/
+struct frostMemStats
+{
+    frost_allocator_t       inner;                          /*< Allocator doing the work >*/
+    unsigned int            flags;                          /*< MEM_STATS_* flags >*/
+    mem_tag_counters_t      tags[FROST_MEM_TAG_COUNT];      /*< Per-tag counters >*/
+    mem_phase_counters_t    phases[TRACE_PHASE_COUNT];      /*< Per-phase counters >*/
+    atomic_size_t           live;                           /*< Total live bytes >*/
+    atomic_size_t           peak;                           /*< High-water mark of live >*/
+    atomic_uint_fast64_t    violations;                     /*< Allocations refused by the guard >*/
+};
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_memStatsRaise
+  @package  Frost_MemStats
+
+  @brief    Raises a high-water mark to value if it is lower.
+
+  @param    peak      [in]:   High-water mark to update.
+  @param    value     [in]:   Candidate value.
+ =========================================================================== **/
+static void Frost_memStatsRaise(atomic_size_t *peak, size_t value)
+{
+    /*< Variable Declarations >*/
+    size_t current = atomic_load_explicit(peak, memory_order_relaxed);
+
+    /*< Start Function Algorithm >*/
+    while ( (current < value) &&
+            (!atomic_compare_exchange_weak_explicit(peak, &current, value,
+                                                    memory_order_relaxed, memory_order_relaxed)) )
+    {
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsGuard
+  @package  Frost_MemStats
+
+  @brief    Applies MEM_STATS_GUARD_LEX to an allocation.
+
+  @param    stats     [in]:   Pointer to the stats.
+
+  @return   true if the allocation must be refused.
+ =========================================================================== **/
+static bool Frost_memStatsGuard(mem_stats_t *stats)
+{
+    /*< Variable Declarations >*/
+    bool refuse = false;
+
+    /*< Start Function Algorithm >*/
+    if ( ((stats->flags & MEM_STATS_GUARD_LEX) != 0u) &&
+         (Frost_tracePhaseCurrent() == TRACE_PHASE_LEX) )
+    {
+        if (atomic_fetch_add_explicit(&stats->violations, 1u, memory_order_relaxed) == 0u)
+        {
+            LOG_ERROR("Allocation during lexing refused by the memory guard.");
+        }
+
+        refuse = true;
+    }
+
+    /*< Function Output >*/
+    return refuse;
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsAdd
+  @package  Frost_MemStats
+
+  @brief    Records an allocation.
+
+  @param    stats     [in]:   Pointer to the stats.
+  @param    tag       [in]:   Tag of the block.
+  @param    size      [in]:   Size of the block.
+ =========================================================================== **/
+static void Frost_memStatsAdd(mem_stats_t *stats, frost_mem_tag_t tag, size_t size)
+{
+    /*< Variable Declarations >*/
+    mem_tag_counters_t *counters    = &stats->tags[tag];
+    mem_phase_counters_t *phase     = &stats->phases[Frost_tracePhaseCurrent()];
+    size_t live                     = 0u;
+
+    /*< Start Function Algorithm >*/
+    atomic_fetch_add_explicit(&counters->allocs, 1u, memory_order_relaxed);
+    atomic_fetch_add_explicit(&counters->bytes, size, memory_order_relaxed);
+    live = atomic_fetch_add_explicit(&counters->live, size, memory_order_relaxed) + size;
+    Frost_memStatsRaise(&counters->peak, live);
+
+    live = atomic_fetch_add_explicit(&stats->live, size, memory_order_relaxed) + size;
+    Frost_memStatsRaise(&stats->peak, live);
+
+    atomic_fetch_add_explicit(&phase->allocs, 1u, memory_order_relaxed);
+    atomic_fetch_add_explicit(&phase->bytes, size, memory_order_relaxed);
+    Frost_memStatsRaise(&phase->peak, live);
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsSub
+  @package  Frost_MemStats
+
+  @brief    Records a free.
+
+  @param    stats     [in]:   Pointer to the stats.
+  @param    tag       [in]:   Tag of the block.
+  @param    size      [in]:   Size of the block.
+ =========================================================================== **/
+static void Frost_memStatsSub(mem_stats_t *stats, frost_mem_tag_t tag, size_t size)
+{
+    atomic_fetch_add_explicit(&stats->tags[tag].frees, 1u, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&stats->tags[tag].live, size, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&stats->live, size, memory_order_relaxed);
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsVtableAlloc
+  @package  Frost_MemStats
+
+  @brief    frost_allocator_t alloc entry of Frost_memStatsAllocator.
+ =========================================================================== **/
+static void *Frost_memStatsVtableAlloc(void *ctx, size_t size, size_t alignment, frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    mem_stats_t *stats      = (mem_stats_t *)ctx;
+    mem_header_t *header    = NULL;
+    char *block             = NULL;
+    char *block_out         = NULL;
+    size_t offset           = MAX(alignment, MEM_STATS_HEADER_SIZE);
+
+    /*< Security Checks >*/
+    tag = (tag < FROST_MEM_TAG_COUNT) ? tag : FROST_MEM_GENERAL;
+
+    if ( (Frost_memStatsGuard(stats)) || (size > (SIZE_MAX - offset)) )
+    {
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    block = (char *)stats->inner.alloc(stats->inner.ctx, size + offset, alignment, tag);
+    if (block == NULL)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    block_out       = block + offset;
+    header          = (mem_header_t *)block_out - 1;
+    header->size    = size;
+    header->tag     = (uint32_t)tag;
+    header->offset  = (uint32_t)offset;
+
+    Frost_memStatsAdd(stats, tag, size);
+
+    /*< Function Output >*/
+end_of_function:
+    return block_out;
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsVtableFree
+  @package  Frost_MemStats
+
+  @brief    frost_allocator_t free entry of Frost_memStatsAllocator.
+ =========================================================================== **/
+static void Frost_memStatsVtableFree(void *ctx, void *ptr, size_t size, frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    mem_stats_t *stats      = (mem_stats_t *)ctx;
+    mem_header_t *header    = NULL;
+    size_t offset           = 0u;
+
+    /*< Security Checks >*/
+    if (ptr == NULL)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    header  = (mem_header_t *)ptr - 1;
+    size    = header->size;
+    tag     = (frost_mem_tag_t)header->tag;
+    offset  = header->offset;
+
+    Frost_memStatsSub(stats, tag, size);
+    stats->inner.free(stats->inner.ctx, (char *)ptr - offset, size + offset, tag);
+
+    /*< Function Output >*/
+end_of_function:
+    return;
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsVtableRealloc
+  @package  Frost_MemStats
+
+  @brief    frost_allocator_t realloc entry of Frost_memStatsAllocator.
+
+  @details  Counted as a free of the old block and an allocation of the new
+            one. The sizes in the header replace the ones given by the
+            caller. Over-aligned blocks are moved by hand, with their
+            original alignment, since the inner realloc cannot keep it.
+ =========================================================================== **/
+static void *Frost_memStatsVtableRealloc(void *ctx, void *ptr, size_t old_size, size_t new_size,
+                                         frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    mem_stats_t *stats      = (mem_stats_t *)ctx;
+    mem_header_t *header    = NULL;
+    char *block             = NULL;
+    char *block_out         = NULL;
+    size_t offset           = 0u;
+
+    /*< Security Checks >*/
+    if (ptr == NULL)
+    {
+        block_out = (char *)Frost_memStatsVtableAlloc(ctx, new_size, ARCH_ALIGNMENT, tag);
+        goto end_of_function;
+    }
+
+    header      = (mem_header_t *)ptr - 1;
+    old_size    = header->size;
+    tag         = (frost_mem_tag_t)header->tag;
+    offset      = header->offset;
+
+    /*< The offset of an over-aligned block is its alignment >*/
+    if (offset > MEM_STATS_HEADER_SIZE)
+    {
+        block_out = (char *)Frost_memStatsVtableAlloc(ctx, new_size, offset, tag);
+        if (block_out != NULL)
+        {
+            memcpy(block_out, ptr, MIN(old_size, new_size));
+            Frost_memStatsVtableFree(ctx, ptr, old_size, tag);
+        }
+
+        goto end_of_function;
+    }
+
+    if ( (Frost_memStatsGuard(stats)) || (new_size > (SIZE_MAX - offset)) )
+    {
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    block = (char *)stats->inner.realloc(stats->inner.ctx, (char *)ptr - offset,
+                                         old_size + offset, new_size + offset, tag);
+    if (block == NULL)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    block_out       = block + offset;
+    header          = (mem_header_t *)block_out - 1;
+    header->size    = new_size;
+
+    Frost_memStatsSub(stats, tag, old_size);
+    Frost_memStatsAdd(stats, tag, new_size);
+
+    /*< Function Output >*/
+end_of_function:
+    return block_out;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initMemStats
+  @package  Frost_MemStats
+
+  @brief    Creates an accounting allocator on top of another one.
+
+  @param    inner     [in]:   Allocator doing the actual work, or NULL for
+                              the current allocator of the calling thread.
+                              It is copied and must outlive the stats.
+  @param    flags     [in]:   Zero or MEM_STATS_GUARD_LEX.
+
+  @return   Pointer to the new stats on success.
+            NULL if memory allocation fails.
+ =========================================================================== **/
+mem_stats_t *Frost_initMemStats(const frost_allocator_t *inner, unsigned int flags)
+{
+    /*< Variable Declarations >*/
+    mem_stats_t *stats_out = NULL;
+
+    /*< Security Checks >*/
+    if (inner == NULL)
+    {
+        inner = Frost_allocatorGet();
+    }
+
+    /*< Allocate Memory >*/
+    stats_out = (mem_stats_t *)inner->alloc(inner->ctx, sizeof(mem_stats_t),
+                                            ARCH_ALIGNMENT, FROST_MEM_GENERAL);
+    if (stats_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for memory stats.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    memset(stats_out, 0, sizeof(mem_stats_t));
+    stats_out->inner = *inner;
+    stats_out->flags = flags;
+
+    /*< Function Output >*/
+end_of_function:
+    return stats_out;
+}
+
+/** ============================================================================
+  @fn       Frost_freeMemStats
+  @package  Frost_MemStats
+
+  @brief    Releases the stats.
+
+  @param    stats     [in]:   Pointer to the stats to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the stats are NULL.
+ =========================================================================== **/
+int Frost_freeMemStats(mem_stats_t *stats)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCESS;
+    frost_allocator_t inner = { 0 };
+
+    /*< Security Checks >*/
+    if (stats == NULL)
+    {
+        LOG_ERROR("Memory stats entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Free Memory >*/
+    inner = stats->inner;
+    inner.free(inner.ctx, stats, sizeof(mem_stats_t), FROST_MEM_GENERAL);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsAllocator
+  @package  Frost_MemStats
+
+  @brief    Returns the accounting allocator vtable.
+
+  @param    stats     [in]:   Pointer to the stats.
+
+  @return   Allocator vtable recording into the stats.
+ =========================================================================== **/
+frost_allocator_t Frost_memStatsAllocator(mem_stats_t *stats)
+{
+    /*< Variable Declarations >*/
+    frost_allocator_t allocator_out =
+    {
+        .alloc      = Frost_memStatsVtableAlloc,
+        .realloc    = Frost_memStatsVtableRealloc,
+        .free       = Frost_memStatsVtableFree,
+        .ctx        = stats,
+    };
+
+    /*< Function Output >*/
+    return allocator_out;
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsTag
+  @package  Frost_MemStats
+
+  @brief    Reads the counters of one memory tag.
+
+  @param    stats     [in]:   Pointer to the stats.
+  @param    tag       [in]:   Memory tag.
+  @param    out       [out]:  Snapshot of the counters.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            -EINVAL if the tag is out of range.
+ =========================================================================== **/
+int Frost_memStatsTag(const mem_stats_t *stats, frost_mem_tag_t tag, mem_tag_stats_t *out)
+{
+    /*< Variable Declarations >*/
+    int ret                             = FUNCTION_SUCESS;
+    const mem_tag_counters_t *counters  = NULL;
+
+    /*< Security Checks >*/
+    if ( (stats == NULL) || (out == NULL) )
+    {
+        LOG_ERROR("Memory stats entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if (tag >= FROST_MEM_TAG_COUNT)
+    {
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    counters    = &stats->tags[tag];
+    out->allocs = atomic_load_explicit(&counters->allocs, memory_order_relaxed);
+    out->frees  = atomic_load_explicit(&counters->frees, memory_order_relaxed);
+    out->bytes  = atomic_load_explicit(&counters->bytes, memory_order_relaxed);
+    out->live   = atomic_load_explicit(&counters->live, memory_order_relaxed);
+    out->peak   = atomic_load_explicit(&counters->peak, memory_order_relaxed);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsPhase
+  @package  Frost_MemStats
+
+  @brief    Reads the counters of one trace phase.
+
+  @param    stats     [in]:   Pointer to the stats.
+  @param    phase     [in]:   Trace phase.
+  @param    out       [out]:  Snapshot of the counters.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            -EINVAL if the phase is out of range.
+ =========================================================================== **/
+int Frost_memStatsPhase(const mem_stats_t *stats, trace_phase_t phase, mem_phase_stats_t *out)
+{
+    /*< Variable Declarations >*/
+    int ret                                 = FUNCTION_SUCESS;
+    const mem_phase_counters_t *counters    = NULL;
+
+    /*< Security Checks >*/
+    if ( (stats == NULL) || (out == NULL) )
+    {
+        LOG_ERROR("Memory stats entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if (phase >= TRACE_PHASE_COUNT)
+    {
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    counters    = &stats->phases[phase];
+    out->allocs = atomic_load_explicit(&counters->allocs, memory_order_relaxed);
+    out->bytes  = atomic_load_explicit(&counters->bytes, memory_order_relaxed);
+    out->peak   = atomic_load_explicit(&counters->peak, memory_order_relaxed);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsViolations
+  @package  Frost_MemStats
+
+  @brief    Returns how many allocations MEM_STATS_GUARD_LEX refused.
+
+  @param    stats     [in]:   Pointer to the stats.
+
+  @return   Number of refused allocations, 0 if stats is NULL.
+ =========================================================================== **/
+uint64_t Frost_memStatsViolations(const mem_stats_t *stats)
+{
+    return (stats != NULL) ? atomic_load_explicit(&stats->violations, memory_order_relaxed) : 0u;
+}
+
+/** ============================================================================
+  @fn       Frost_memStatsReport
+  @package  Frost_MemStats
+
+  @brief    Prints the per-tag and per-phase counters.
+
+  @param    stats     [in]:   Pointer to the stats.
+  @param    stream    [in]:   Output stream, e.g. stderr.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+ =========================================================================== **/
+int Frost_memStatsReport(const mem_stats_t *stats, FILE *stream)
+{
+    /*< Variable Declarations >*/
+    int ret                     = FUNCTION_SUCESS;
+    mem_tag_stats_t tag         = { 0u };
+    mem_phase_stats_t phase     = { 0u };
+    size_t index                = 0u;
+
+    /*< Security Checks >*/
+    if ( (stats == NULL) || (stream == NULL) )
+    {
+        LOG_ERROR("Memory stats entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    fprintf(stream, "===-----------------------------------------------------===\n");
+    fprintf(stream, "                   Frost memory report\n");
+    fprintf(stream, "===-----------------------------------------------------===\n");
+    fprintf(stream, "  Live: %.1f KiB, peak: %.1f KiB",
+            MEM_STATS_KIB(atomic_load_explicit(&stats->live, memory_order_relaxed)),
+            MEM_STATS_KIB(atomic_load_explicit(&stats->peak, memory_order_relaxed)));
+
+    if ((stats->flags & MEM_STATS_GUARD_LEX) != 0u)
+    {
+        fprintf(stream, ", lexing guard violations: %" PRIu64, Frost_memStatsViolations(stats));
+    }
+
+    fprintf(stream, "\n\n  %-12s %10s %10s %12s %12s %12s\n",
+            "Tag", "Allocs", "Frees", "Live (KiB)", "Peak (KiB)", "Total (KiB)");
+
+    for (index = 0u; index < FROST_MEM_TAG_COUNT; index++)
+    {
+        (void)Frost_memStatsTag(stats, (frost_mem_tag_t)index, &tag);
+        fprintf(stream, "  %-12s %10" PRIu64 " %10" PRIu64 " %12.1f %12.1f %12.1f\n",
+                Frost_memTagName((frost_mem_tag_t)index), tag.allocs, tag.frees,
+                MEM_STATS_KIB(tag.live), MEM_STATS_KIB(tag.peak), MEM_STATS_KIB(tag.bytes));
+    }
+
+    fprintf(stream, "\n  %-12s %10s %12s %12s\n", "Phase", "Allocs", "Total (KiB)", "Peak (KiB)");
+
+    for (index = 0u; index < TRACE_PHASE_COUNT; index++)
+    {
+        (void)Frost_memStatsPhase(stats, (trace_phase_t)index, &phase);
+        fprintf(stream, "  %-12s %10" PRIu64 " %12.1f %12.1f\n",
+                Frost_tracePhaseName((trace_phase_t)index), phase.allocs,
+                MEM_STATS_KIB(phase.bytes), MEM_STATS_KIB(phase.peak));
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
+/** @}*/
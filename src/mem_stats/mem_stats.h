@@ -0,0 +1,216 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_MemStats
+
+    @brief      This module accounts every allocation per memory tag and per
+                compiler phase, and reports counts, live bytes and peaks.
+
+    @file       mem_stats.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    A mem_stats_t wraps another allocator. Frost_memStatsAllocator
+                returns a frost_allocator_t that forwards to it and records,
+                for each frost_mem_tag_t, allocation and free counts, bytes
+                allocated, live bytes and their high-water mark. Allocations
+                are also charged to the current trace phase of the calling
+                thread (see Frost_tracePhaseCurrent), whose high-water mark is
+                the peak of total live memory reached while that phase was
+                allocating. Frost_memStatsReport prints everything at the end
+                of a run.
+
+                With MEM_STATS_GUARD_LEX, every allocation made while the
+                current phase is TRACE_PHASE_LEX is refused and counted as a
+                violation. Running the allocation-free lexing paths under it
+                proves steady-state lexing does not allocate.
+
+    @note       - Install the allocator before creating any Frost object, and
+                  keep the stats alive until every block was freed: blocks
+                  carry a small header that only this allocator understands.
+                - Counters are atomic; the allocator may be shared by every
+                  thread of a compilation.
+ =========================================================================== **/
+
+#ifndef MEM_STATS_H_
+#define MEM_STATS_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*< Implements >*/
+#include "../allocator/allocator.h"
+#include "../time_trace/time_trace.h"
+
+/* ========================================================================== *\
+ *                              PUBLIC DEFINITIONS                            *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       MEM_STATS_GUARD_LEX
+    @brief     Frost_initMemStats flag: refuse allocations made while lexing.
+============================================================================ **/
+#define MEM_STATS_GUARD_LEX         (1u << 0)
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostMemTagStats
+  @package  Frost_MemStats
+
+  @typedef  mem_tag_stats_t
+
+  @brief    Snapshot of the counters of one memory tag.
+============================================================================ **/
+typedef struct frostMemTagStats
+{
+    uint64_t            allocs;         /*< Blocks allocated, reallocations included >*/
+    uint64_t            frees;          /*< Blocks freed, reallocations included >*/
+    uint64_t            bytes;          /*< Bytes allocated over the whole run >*/
+    size_t              live;           /*< Bytes currently allocated >*/
+    size_t              peak;           /*< High-water mark of live >*/
+} mem_tag_stats_t;
+
+/** ============================================================================
+  @struct   frostMemPhaseStats
+  @package  Frost_MemStats
+
+  @typedef  mem_phase_stats_t
+
+  @brief    Snapshot of the counters of one trace phase.
+============================================================================ **/
+typedef struct frostMemPhaseStats
+{
+    uint64_t            allocs;         /*< Blocks allocated during the phase >*/
+    uint64_t            bytes;          /*< Bytes allocated during the phase >*/
+    size_t              peak;           /*< Highest total live bytes reached by
+                                            an allocation of the phase >*/
+} mem_phase_stats_t;
+
+/** ============================================================================
+  @struct   frostMemStats
+  @package  Frost_MemStats
+
+  @typedef  mem_stats_t
+
+  @brief    Opaque handle to an accounting allocator.
+============================================================================ **/
+typedef struct frostMemStats mem_stats_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initMemStats
+  @package  Frost_MemStats
+
+  @brief    Creates an accounting allocator on top of another one.
+
+  @param    inner     [in]:   Allocator doing the actual work, or NULL for
+                              the current allocator of the calling thread.
+                              It is copied and must outlive the stats.
+  @param    flags     [in]:   Zero or MEM_STATS_GUARD_LEX.
+
+  @return   Pointer to the new stats on success.
+            NULL if memory allocation fails.
+ =========================================================================== **/
+mem_stats_t *Frost_initMemStats(const frost_allocator_t *inner, unsigned int flags);
+
+/** ============================================================================
+  @fn       Frost_freeMemStats
+  @package  Frost_MemStats
+
+  @brief    Releases the stats.
+
+  @param    stats     [in]:   Pointer to the stats to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the stats are NULL.
+ =========================================================================== **/
+int Frost_freeMemStats(mem_stats_t *stats);
+
+/** ============================================================================
+  @fn       Frost_memStatsAllocator
+  @package  Frost_MemStats
+
+  @brief    Returns the accounting allocator vtable.
+
+  @details  The vtable holds the stats as its context; keep them alive while
+            it is installed.
+
+  @param    stats     [in]:   Pointer to the stats.
+
+  @return   Allocator vtable recording into the stats.
+ =========================================================================== **/
+frost_allocator_t Frost_memStatsAllocator(mem_stats_t *stats);
+
+/** ============================================================================
+  @fn       Frost_memStatsTag
+  @package  Frost_MemStats
+
+  @brief    Reads the counters of one memory tag.
+
+  @param    stats     [in]:   Pointer to the stats.
+  @param    tag       [in]:   Memory tag.
+  @param    out       [out]:  Snapshot of the counters.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            -EINVAL if the tag is out of range.
+ =========================================================================== **/
+int Frost_memStatsTag(const mem_stats_t *stats, frost_mem_tag_t tag, mem_tag_stats_t *out);
+
+/** ============================================================================
+  @fn       Frost_memStatsPhase
+  @package  Frost_MemStats
+
+  @brief    Reads the counters of one trace phase.
+
+  @param    stats     [in]:   Pointer to the stats.
+  @param    phase     [in]:   Trace phase.
+  @param    out       [out]:  Snapshot of the counters.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            -EINVAL if the phase is out of range.
+ =========================================================================== **/
+int Frost_memStatsPhase(const mem_stats_t *stats, trace_phase_t phase, mem_phase_stats_t *out);
+
+/** ============================================================================
+  @fn       Frost_memStatsViolations
+  @package  Frost_MemStats
+
+  @brief    Returns how many allocations MEM_STATS_GUARD_LEX refused.
+
+  @param    stats     [in]:   Pointer to the stats.
+
+  @return   Number of refused allocations, 0 if stats is NULL.
+ =========================================================================== **/
+uint64_t Frost_memStatsViolations(const mem_stats_t *stats);
+
+/** ============================================================================
+  @fn       Frost_memStatsReport
+  @package  Frost_MemStats
+
+  @brief    Prints the per-tag and per-phase counters.
+
+  @param    stats     [in]:   Pointer to the stats.
+  @param    stream    [in]:   Output stream, e.g. stderr.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+ =========================================================================== **/
+int Frost_memStatsReport(const mem_stats_t *stats, FILE *stream);
+
+#endif /* MEM_STATS_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,818 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_Scheduler
+
+    @package    Frost_Scheduler
+    @brief      This module provides a work-stealing task scheduler shared by
+                the stages of the Frost Compiler.
+
+    @file       scheduler.c
+    @headerfile scheduler.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Every worker owns a fixed-capacity Chase-Lev deque (Le et al.,
+                "Correct and Efficient Work-Stealing for Weak Memory Models").
+                The owner pushes and takes at the bottom without locks, and
+                thieves race on the top with a single compare-and-swap. Tasks
+                forked from threads outside the pool go through a small
+                mutex-protected injection queue. Idle workers sleep on a
+                condition variable and are only signalled when some thread
+                is actually sleeping.
+
+    @note       - The `top` and `bottom` indexes of each deque live on
+                  separate cache lines, and each worker is padded to
+                  `ARCH_CACHE_LINE_SIZE`, to avoid false sharing.
+                - A full deque never fails a fork: the task is run inline.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/*< Implements >*/
+#include "scheduler.h"
+#include "../allocator/allocator.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       SCHEDULER_DEQUE_CAPACITY
+    @brief     Number of task slots in each worker deque (power of two).
+============================================================================ **/
+#define SCHEDULER_DEQUE_CAPACITY    4096
+
+/** ============================================================================
+    @def       SCHEDULER_DEQUE_MASK
+    @brief     Mask used to wrap deque indexes into the slot array.
+============================================================================ **/
+#define SCHEDULER_DEQUE_MASK        (SCHEDULER_DEQUE_CAPACITY - 1)
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostDeque
+  @package  Frost_Scheduler
+
+  @typedef  deque_t
+
+  @brief    Fixed-capacity Chase-Lev work-stealing deque.
+
+  @details  `top` is advanced by thieves, `bottom` only by the owner. Both are
+            kept on their own cache line so that steals do not invalidate the
+            owner's line on every push and pop.
+============================================================================ **/
+typedef struct frostDeque
+{
+    __attribute__((aligned(ARCH_CACHE_LINE_SIZE)))
+    _Atomic int64_t     top;                                /*< Index of the oldest task >*/
+
+    __attribute__((aligned(ARCH_CACHE_LINE_SIZE)))
+    _Atomic int64_t     bottom;                             /*< Index past the newest task >*/
+    _Atomic(task_t *)   slots[SCHEDULER_DEQUE_CAPACITY];    /*< Circular task storage >*/
+} deque_t;
+
+/** ============================================================================
+  @struct   frostWorker
+  @package  Frost_Scheduler
+
+  @typedef  worker_t
+
+  @brief    Per-worker state, padded to a whole number of cache lines.
+============================================================================ **/
+typedef struct __attribute__((aligned(ARCH_CACHE_LINE_SIZE))) frostWorker
+{
+    deque_t             deque;      /*< Tasks owned by this worker >*/
+    pthread_t           thread;     /*< Thread running the worker loop >*/
+    scheduler_t         *scheduler; /*< Back pointer to the owning pool >*/
+    size_t              index;      /*< Position of the worker in the pool >*/
+} worker_t;
+
+/** ============================================================================
+  @struct   frostScheduler
+  @package  Frost_Scheduler
+
+  @brief    Pool of workers plus the shared injection queue and sleep state.
+============================================================================ **/
+struct frostScheduler
+{
+    worker_t            *workers;       /*< Array of per-worker state >*/
+    size_t              worker_count;   /*< Number of entries in workers >*/
+    size_t              started;        /*< Number of threads actually started >*/
+    const frost_allocator_t *allocator; /*< Allocator inherited by the workers >*/
+
+    pthread_mutex_t     inject_lock;    /*< Protects the injection queue >*/
+    task_t              *inject_head;   /*< Oldest task forked from outside >*/
+    task_t              *inject_tail;   /*< Newest task forked from outside >*/
+    atomic_size_t       injected;       /*< Number of tasks in the injection queue >*/
+
+    __attribute__((aligned(ARCH_CACHE_LINE_SIZE)))
+    atomic_size_t       queued;         /*< Tasks pushed and not yet taken >*/
+    atomic_size_t       sleepers;       /*< Workers waiting on wake_cond >*/
+    atomic_bool         shutdown;       /*< Set when the pool is stopping >*/
+    pthread_mutex_t     wake_lock;      /*< Protects the sleep handshake >*/
+    pthread_cond_t      wake_cond;      /*< Signalled when work is queued >*/
+};
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Worker bound to the calling thread, NULL outside of any pool >*/
+static _Thread_local worker_t *current_worker = NULL;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_dequePush
+  @package  Frost_Scheduler
+
+  @brief    Pushes a task at the bottom of a deque (owner only).
+
+  @param    deque     [in]:   Deque owned by the calling worker.
+  @param    task      [in]:   Task to be pushed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOSPC if the deque is full.
+ =========================================================================== **/
+static int Frost_dequePush(deque_t *deque, task_t *task)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    int64_t bottom  = 0;
+    int64_t top     = 0;
+
+    /*< Start Function Algorithm >*/
+    bottom  = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    top     = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+    if ((bottom - top) >= SCHEDULER_DEQUE_CAPACITY)
+    {
+        ret = -ENOSPC;
+        goto end_of_function;
+    }
+
+    /*< A release store rather than a fence: same ordering, visible to TSan >*/
+    atomic_store_explicit(&deque->slots[bottom & SCHEDULER_DEQUE_MASK], task,
+                          memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_dequeTake
+  @package  Frost_Scheduler
+
+  @brief    Pops the newest task from the bottom of a deque (owner only).
+
+  @param    deque     [in]:   Deque owned by the calling worker.
+
+  @return   Pointer to the task on success.
+            NULL if the deque is empty or the last task was stolen.
+ =========================================================================== **/
+static task_t *Frost_dequeTake(deque_t *deque)
+{
+    /*< Variable Declarations >*/
+    task_t *task_out    = NULL;
+    int64_t bottom      = 0;
+    int64_t top         = 0;
+
+    /*< Start Function Algorithm >*/
+    bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        goto end_of_function;
+    }
+
+    task_out = atomic_load_explicit(&deque->slots[bottom & SCHEDULER_DEQUE_MASK],
+                                    memory_order_relaxed);
+
+    if (top == bottom)
+    {
+        /*< Last element: race against thieves for it >*/
+        if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                     memory_order_seq_cst,
+                                                     memory_order_relaxed))
+        {
+            task_out = NULL;
+        }
+
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return task_out;
+}
+
+/** ============================================================================
+  @fn       Frost_dequeSteal
+  @package  Frost_Scheduler
+
+  @brief    Steals the oldest task from the top of a deque (any thread).
+
+  @param    deque     [in]:   Deque to steal from.
+
+  @return   Pointer to the task on success.
+            NULL if the deque is empty or another thread won the race.
+ =========================================================================== **/
+static task_t *Frost_dequeSteal(deque_t *deque)
+{
+    /*< Variable Declarations >*/
+    task_t *task_out    = NULL;
+    int64_t bottom      = 0;
+    int64_t top         = 0;
+
+    /*< Start Function Algorithm >*/
+    top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        goto end_of_function;
+    }
+
+    task_out = atomic_load_explicit(&deque->slots[top & SCHEDULER_DEQUE_MASK],
+                                    memory_order_relaxed);
+
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                 memory_order_seq_cst,
+                                                 memory_order_relaxed))
+    {
+        task_out = NULL;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return task_out;
+}
+
+/** ============================================================================
+  @fn       Frost_schedulerWake
+  @package  Frost_Scheduler
+
+  @brief    Records a newly queued task and wakes one sleeping worker.
+
+  @param    scheduler [in]:   Pointer to the scheduler.
+ =========================================================================== **/
+static void Frost_schedulerWake(scheduler_t *scheduler)
+{
+    /*< Start Function Algorithm >*/
+    atomic_fetch_add(&scheduler->queued, 1u);
+
+    if (atomic_load(&scheduler->sleepers) > 0u)
+    {
+        pthread_mutex_lock(&scheduler->wake_lock);
+        pthread_cond_signal(&scheduler->wake_cond);
+        pthread_mutex_unlock(&scheduler->wake_lock);
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_schedulerInjectPop
+  @package  Frost_Scheduler
+
+  @brief    Removes the oldest task from the injection queue.
+
+  @param    scheduler [in]:   Pointer to the scheduler.
+
+  @return   Pointer to the task, or NULL if the queue is empty.
+ =========================================================================== **/
+static task_t *Frost_schedulerInjectPop(scheduler_t *scheduler)
+{
+    /*< Variable Declarations >*/
+    task_t *task_out = NULL;
+
+    /*< Start Function Algorithm >*/
+    pthread_mutex_lock(&scheduler->inject_lock);
+
+    task_out = scheduler->inject_head;
+    if (task_out != NULL)
+    {
+        scheduler->inject_head = task_out->next;
+        atomic_fetch_sub_explicit(&scheduler->injected, 1u, memory_order_relaxed);
+
+        if (scheduler->inject_head == NULL)
+        {
+            scheduler->inject_tail = NULL;
+        }
+
+        task_out->next = NULL;
+    }
+
+    pthread_mutex_unlock(&scheduler->inject_lock);
+
+    /*< Function Output >*/
+    return task_out;
+}
+
+/** ============================================================================
+  @fn       Frost_schedulerFind
+  @package  Frost_Scheduler
+
+  @brief    Looks for a runnable task on behalf of the calling thread.
+
+  @details  A worker first drains its own deque (newest first, for locality),
+            then the injection queue, then steals from the other workers
+            starting right after itself. Threads outside the pool skip the
+            first step.
+
+  @param    scheduler [in]:   Pointer to the scheduler.
+  @param    self      [in]:   Calling worker, or NULL for a foreign thread.
+
+  @return   Pointer to a task, or NULL if no work was found.
+ =========================================================================== **/
+static task_t *Frost_schedulerFind(scheduler_t *scheduler, worker_t *self)
+{
+    /*< Variable Declarations >*/
+    task_t *task_out    = NULL;
+    size_t start        = 0u;
+    size_t step         = 0u;
+
+    /*< Start Function Algorithm >*/
+    if (self != NULL)
+    {
+        task_out = Frost_dequeTake(&self->deque);
+        if (task_out != NULL)
+        {
+            goto end_of_function;
+        }
+
+        start = self->index + 1u;
+    }
+
+    if (atomic_load_explicit(&scheduler->injected, memory_order_relaxed) > 0u)
+    {
+        task_out = Frost_schedulerInjectPop(scheduler);
+        if (task_out != NULL)
+        {
+            goto end_of_function;
+        }
+    }
+
+    for (step = 0u; step < scheduler->worker_count; step++)
+    {
+        worker_t *victim = &scheduler->workers[(start + step) % scheduler->worker_count];
+
+        if (victim == self)
+        {
+            continue;
+        }
+
+        task_out = Frost_dequeSteal(&victim->deque);
+        if (task_out != NULL)
+        {
+            goto end_of_function;
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    if (task_out != NULL)
+    {
+        atomic_fetch_sub(&scheduler->queued, 1u);
+    }
+
+    return task_out;
+}
+
+/** ============================================================================
+  @fn       Frost_schedulerRun
+  @package  Frost_Scheduler
+
+  @brief    Executes a task and signals its group.
+
+  @param    task      [in]:   Task to be executed.
+ =========================================================================== **/
+static void Frost_schedulerRun(task_t *task)
+{
+    /*< Variable Declarations >*/
+    task_group_t *group = task->group;
+
+    /*< Start Function Algorithm >*/
+    task->fn(task->arg);
+
+    /*< The task storage may be released as soon as the group is signalled >*/
+    atomic_fetch_sub_explicit(&group->pending, 1u, memory_order_release);
+}
+
+/** ============================================================================
+  @fn       Frost_schedulerWorkerMain
+  @package  Frost_Scheduler
+
+  @brief    Main loop of a worker thread.
+
+  @param    arg       [in]:   Pointer to the worker_t of this thread.
+
+  @return   Always NULL.
+ =========================================================================== **/
+static void *Frost_schedulerWorkerMain(void *arg)
+{
+    /*< Variable Declarations >*/
+    worker_t *self          = (worker_t *)arg;
+    scheduler_t *scheduler  = self->scheduler;
+    task_t *task            = NULL;
+
+    /*< Start Function Algorithm >*/
+    current_worker = self;
+    Frost_allocatorSet(scheduler->allocator);
+
+    for (;;)
+    {
+        task = Frost_schedulerFind(scheduler, self);
+        if (task != NULL)
+        {
+            Frost_schedulerRun(task);
+            continue;
+        }
+
+        pthread_mutex_lock(&scheduler->wake_lock);
+        atomic_fetch_add(&scheduler->sleepers, 1u);
+
+        while ( (atomic_load(&scheduler->queued) == 0u) &&
+                (!atomic_load(&scheduler->shutdown)) )
+        {
+            pthread_cond_wait(&scheduler->wake_cond, &scheduler->wake_lock);
+        }
+
+        atomic_fetch_sub(&scheduler->sleepers, 1u);
+        pthread_mutex_unlock(&scheduler->wake_lock);
+
+        if ( (atomic_load(&scheduler->shutdown)) &&
+             (atomic_load(&scheduler->queued) == 0u) )
+        {
+            break;
+        }
+    }
+
+    current_worker = NULL;
+
+    /*< Function Output >*/
+    return NULL;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initScheduler
+  @package  Frost_Scheduler
+
+  @brief    Creates a scheduler and starts its worker threads.
+
+  @details  Allocates the scheduler, its per-worker deques and starts one
+            thread per worker. When the requested count is zero, the number
+            of online processors is used.
+
+  @param    workers   [in]:   Number of worker threads, or 0 for one per core.
+
+  @return   Pointer to a newly created scheduler on success.
+            NULL if memory allocation or thread creation fails.
+ =========================================================================== **/
+scheduler_t *Frost_initScheduler(size_t workers)
+{
+    /*< Variable Declarations >*/
+    scheduler_t *scheduler_out  = NULL;
+    long online                 = 0;
+    size_t index                = 0u;
+
+    /*< Select Pool Size >*/
+    if (workers == 0u)
+    {
+        online  = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = (online > 0) ? (size_t)online : 1u;
+    }
+
+    /*< Allocate Memory >*/
+    scheduler_out = (scheduler_t *)Frost_memAlignedAlloc(ARCH_CACHE_LINE_SIZE,
+                        ALIGN_UP(sizeof(scheduler_t), ARCH_CACHE_LINE_SIZE), FROST_MEM_SCHEDULER);
+    if (scheduler_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for scheduler.");
+        goto end_of_function;
+    }
+
+    memset(scheduler_out, 0, sizeof(scheduler_t));
+
+    scheduler_out->workers = (worker_t *)Frost_memAlignedAlloc(ARCH_CACHE_LINE_SIZE,
+                                                               workers * sizeof(worker_t),
+                                                               FROST_MEM_SCHEDULER);
+    if (scheduler_out->workers == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for scheduler workers.");
+        Frost_memFree(scheduler_out, ALIGN_UP(sizeof(scheduler_t), ARCH_CACHE_LINE_SIZE),
+                      FROST_MEM_SCHEDULER);
+        scheduler_out = NULL;
+        goto end_of_function;
+    }
+
+    memset(scheduler_out->workers, 0, workers * sizeof(worker_t));
+    scheduler_out->allocator = Frost_allocatorGet();
+
+    /*< Start Function Algorithm >*/
+    scheduler_out->worker_count = workers;
+
+    atomic_init(&scheduler_out->injected, 0u);
+    atomic_init(&scheduler_out->queued, 0u);
+    atomic_init(&scheduler_out->sleepers, 0u);
+    atomic_init(&scheduler_out->shutdown, false);
+
+    pthread_mutex_init(&scheduler_out->inject_lock, NULL);
+    pthread_mutex_init(&scheduler_out->wake_lock, NULL);
+    pthread_cond_init(&scheduler_out->wake_cond, NULL);
+
+    for (index = 0u; index < workers; index++)
+    {
+        worker_t *worker = &scheduler_out->workers[index];
+
+        atomic_init(&worker->deque.top, 0);
+        atomic_init(&worker->deque.bottom, 0);
+        worker->scheduler   = scheduler_out;
+        worker->index       = index;
+    }
+
+    for (index = 0u; index < workers; index++)
+    {
+        if (pthread_create(&scheduler_out->workers[index].thread, NULL,
+                           Frost_schedulerWorkerMain,
+                           &scheduler_out->workers[index]) != 0)
+        {
+            LOG_ERROR("Failed to start scheduler worker thread.");
+            Frost_freeScheduler(scheduler_out);
+            scheduler_out = NULL;
+            goto end_of_function;
+        }
+
+        scheduler_out->started++;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return scheduler_out;
+}
+
+/** ============================================================================
+  @fn       Frost_freeScheduler
+  @package  Frost_Scheduler
+
+  @brief    Stops the worker threads and frees the scheduler.
+
+  @details  Signals every worker to exit, waits for them, and releases the
+            memory owned by the scheduler. All groups must have been joined
+            before calling this function.
+
+  @param    scheduler [in]:   Pointer to the scheduler to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the scheduler is NULL.
+ =========================================================================== **/
+int Frost_freeScheduler(scheduler_t *scheduler)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    size_t index    = 0u;
+
+    /*< Security Checks >*/
+    if (scheduler == NULL)
+    {
+        LOG_ERROR("Scheduler entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    pthread_mutex_lock(&scheduler->wake_lock);
+    atomic_store(&scheduler->shutdown, true);
+    pthread_cond_broadcast(&scheduler->wake_cond);
+    pthread_mutex_unlock(&scheduler->wake_lock);
+
+    for (index = 0u; index < scheduler->started; index++)
+    {
+        pthread_join(scheduler->workers[index].thread, NULL);
+    }
+
+    pthread_cond_destroy(&scheduler->wake_cond);
+    pthread_mutex_destroy(&scheduler->wake_lock);
+    pthread_mutex_destroy(&scheduler->inject_lock);
+
+    Frost_memFree(scheduler->workers, scheduler->worker_count * sizeof(worker_t),
+                  FROST_MEM_SCHEDULER);
+    Frost_memFree(scheduler, ALIGN_UP(sizeof(scheduler_t), ARCH_CACHE_LINE_SIZE),
+                  FROST_MEM_SCHEDULER);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_schedulerWorkerCount
+  @package  Frost_Scheduler
+
+  @brief    Returns the number of worker threads in the pool.
+
+  @param    scheduler [in]:   Pointer to the scheduler.
+
+  @return   The number of workers, or 0 if the scheduler is NULL.
+ =========================================================================== **/
+size_t Frost_schedulerWorkerCount(const scheduler_t *scheduler)
+{
+    return (scheduler != NULL) ? scheduler->worker_count : 0u;
+}
+
+/** ============================================================================
+  @fn       Frost_taskGroupInit
+  @package  Frost_Scheduler
+
+  @brief    Initializes an empty task group.
+
+  @param    group     [out]:  Pointer to the group to be initialized.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the group is NULL.
+ =========================================================================== **/
+int Frost_taskGroupInit(task_group_t *group)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (group == NULL)
+    {
+        LOG_ERROR("Task group entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    atomic_init(&group->pending, 0u);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_schedulerFork
+  @package  Frost_Scheduler
+
+  @brief    Schedules a task for asynchronous execution within a group.
+
+  @details  When called from a worker, the task is pushed to the bottom of the
+            worker's own deque. When called from any other thread, the task is
+            appended to the injection queue. If the worker deque is full, the
+            task is executed inline before returning.
+
+  @param    scheduler [in]:   Pointer to the scheduler.
+  @param    group     [in]:   Group the task belongs to.
+  @param    task      [out]:  Caller-owned storage for the task.
+  @param    fn        [in]:   Function to execute.
+  @param    arg       [in]:   Argument passed to fn.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if any pointer argument is NULL.
+ =========================================================================== **/
+int Frost_schedulerFork(scheduler_t *scheduler, task_group_t *group,
+                        task_t *task, task_fn_t fn, void *arg)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    worker_t *self  = current_worker;
+
+    /*< Security Checks >*/
+    if ( (scheduler == NULL) || (group == NULL) || (task == NULL) || (fn == NULL) )
+    {
+        LOG_ERROR("Scheduler fork entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    task->fn    = fn;
+    task->arg   = arg;
+    task->group = group;
+    task->next  = NULL;
+
+    atomic_fetch_add_explicit(&group->pending, 1u, memory_order_relaxed);
+
+    if ( (self != NULL) && (self->scheduler == scheduler) )
+    {
+        if (Frost_dequePush(&self->deque, task) != FUNCTION_SUCESS)
+        {
+            Frost_schedulerRun(task);
+            goto end_of_function;
+        }
+    }
+    else
+    {
+        pthread_mutex_lock(&scheduler->inject_lock);
+
+        if (scheduler->inject_tail != NULL)
+        {
+            scheduler->inject_tail->next = task;
+        }
+        else
+        {
+            scheduler->inject_head = task;
+        }
+
+        scheduler->inject_tail = task;
+        atomic_fetch_add_explicit(&scheduler->injected, 1u, memory_order_relaxed);
+
+        pthread_mutex_unlock(&scheduler->inject_lock);
+    }
+
+    Frost_schedulerWake(scheduler);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_schedulerJoin
+  @package  Frost_Scheduler
+
+  @brief    Waits until every task forked into a group has finished.
+
+  @details  The calling thread does not block idle: while the group is still
+            pending it pops its own tasks or steals work from the pool, so a
+            worker joining nested groups keeps making progress.
+
+  @param    scheduler [in]:   Pointer to the scheduler.
+  @param    group     [in]:   Group to wait for.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if any pointer argument is NULL.
+ =========================================================================== **/
+int Frost_schedulerJoin(scheduler_t *scheduler, task_group_t *group)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    worker_t *self  = current_worker;
+    task_t *task    = NULL;
+
+    /*< Security Checks >*/
+    if ( (scheduler == NULL) || (group == NULL) )
+    {
+        LOG_ERROR("Scheduler join entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if ( (self != NULL) && (self->scheduler != scheduler) )
+    {
+        self = NULL;
+    }
+
+    /*< Start Function Algorithm >*/
+    while (atomic_load_explicit(&group->pending, memory_order_acquire) != 0u)
+    {
+        task = Frost_schedulerFind(scheduler, self);
+        if (task != NULL)
+        {
+            Frost_schedulerRun(task);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
+/** @}*/
@@ -0,0 +1,204 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_Scheduler
+
+    @brief      This module provides a work-stealing task scheduler shared by
+                the stages of the Frost Compiler.
+
+    @file       scheduler.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The Frost Scheduler owns a fixed pool of worker threads sized
+                to the machine. Each worker keeps a Chase-Lev deque of tasks:
+                the owner pushes and pops at the bottom, while idle workers
+                steal from the top. Tasks are grouped with fork/join helpers,
+                so that lexing, parsing and code generation can all share one
+                pool without oversubscribing the cores.
+
+    @note       - Task storage is owned by the caller and must stay valid until
+                  the group it was forked into is joined.
+                - Tasks forked from a thread outside the pool are placed in a
+                  shared injection queue.
+ =========================================================================== **/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdatomic.h>
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @typedef  task_fn_t
+  @package  Frost_Scheduler
+
+  @brief    Signature of the function executed by a task.
+
+  @param    arg       [in]:   User argument given when the task was forked.
+============================================================================ **/
+typedef void (*task_fn_t)(void *arg);
+
+/** ============================================================================
+  @struct   frostTaskGroup
+  @package  Frost_Scheduler
+
+  @typedef  task_group_t
+
+  @brief    Counts the outstanding tasks forked under a common join point.
+
+  @details  A task group must be initialized with Frost_taskGroupInit before
+            any task is forked into it. Frost_schedulerJoin returns once the
+            counter drops back to zero.
+============================================================================ **/
+typedef struct frostTaskGroup
+{
+    atomic_size_t   pending;        /*< Number of forked tasks not yet finished >*/
+} task_group_t;
+
+/** ============================================================================
+  @struct   frostTask
+  @package  Frost_Scheduler
+
+  @typedef  task_t
+
+  @brief    Represents one unit of work handed to the scheduler.
+
+  @details  The structure is filled by Frost_schedulerFork. The `next` field
+            links the task in the injection queue when it is forked from a
+            thread that does not belong to the pool.
+============================================================================ **/
+typedef struct frostTask
+{
+    task_fn_t           fn;         /*< Function executed by the task >*/
+    void                *arg;       /*< User argument passed to fn >*/
+    task_group_t        *group;     /*< Group notified when the task finishes >*/
+    struct frostTask    *next;      /*< Link in the injection queue >*/
+} task_t;
+
+/** ============================================================================
+  @struct   frostScheduler
+  @package  Frost_Scheduler
+
+  @typedef  scheduler_t
+
+  @brief    Opaque handle to a pool of worker threads.
+============================================================================ **/
+typedef struct frostScheduler scheduler_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initScheduler
+  @package  Frost_Scheduler
+
+  @brief    Creates a scheduler and starts its worker threads.
+
+  @details  Allocates the scheduler, its per-worker deques and starts one
+            thread per worker. When the requested count is zero, the number
+            of online processors is used.
+
+  @param    workers   [in]:   Number of worker threads, or 0 for one per core.
+
+  @return   Pointer to a newly created scheduler on success.
+            NULL if memory allocation or thread creation fails.
+ =========================================================================== **/
+scheduler_t *Frost_initScheduler(size_t workers);
+
+/** ============================================================================
+  @fn       Frost_freeScheduler
+  @package  Frost_Scheduler
+
+  @brief    Stops the worker threads and frees the scheduler.
+
+  @details  Signals every worker to exit, waits for them, and releases the
+            memory owned by the scheduler. All groups must have been joined
+            before calling this function.
+
+  @param    scheduler [in]:   Pointer to the scheduler to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the scheduler is NULL.
+ =========================================================================== **/
+int Frost_freeScheduler(scheduler_t *scheduler);
+
+/** ============================================================================
+  @fn       Frost_schedulerWorkerCount
+  @package  Frost_Scheduler
+
+  @brief    Returns the number of worker threads in the pool.
+
+  @param    scheduler [in]:   Pointer to the scheduler.
+
+  @return   The number of workers, or 0 if the scheduler is NULL.
+ =========================================================================== **/
+size_t Frost_schedulerWorkerCount(const scheduler_t *scheduler);
+
+/** ============================================================================
+  @fn       Frost_taskGroupInit
+  @package  Frost_Scheduler
+
+  @brief    Initializes an empty task group.
+
+  @param    group     [out]:  Pointer to the group to be initialized.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the group is NULL.
+ =========================================================================== **/
+int Frost_taskGroupInit(task_group_t *group);
+
+/** ============================================================================
+  @fn       Frost_schedulerFork
+  @package  Frost_Scheduler
+
+  @brief    Schedules a task for asynchronous execution within a group.
+
+  @details  When called from a worker, the task is pushed to the bottom of the
+            worker's own deque. When called from any other thread, the task is
+            appended to the injection queue. If the worker deque is full, the
+            task is executed inline before returning.
+
+  @param    scheduler [in]:   Pointer to the scheduler.
+  @param    group     [in]:   Group the task belongs to.
+  @param    task      [out]:  Caller-owned storage for the task.
+  @param    fn        [in]:   Function to execute.
+  @param    arg       [in]:   Argument passed to fn.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if any pointer argument is NULL.
+ =========================================================================== **/
+int Frost_schedulerFork(scheduler_t *scheduler, task_group_t *group,
+                        task_t *task, task_fn_t fn, void *arg);
+
+/** ============================================================================
+  @fn       Frost_schedulerJoin
+  @package  Frost_Scheduler
+
+  @brief    Waits until every task forked into a group has finished.
+
+  @details  The calling thread does not block idle: while the group is still
+            pending it pops its own tasks or steals work from the pool, so a
+            worker joining nested groups keeps making progress.
+
+  @param    scheduler [in]:   Pointer to the scheduler.
+  @param    group     [in]:   Group to wait for.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if any pointer argument is NULL.
+ =========================================================================== **/
+int Frost_schedulerJoin(scheduler_t *scheduler, task_group_t *group);
+
+#endif /* SCHEDULER_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,1233 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_Server
+
+    @package    Frost_Server
+    @brief      This module provides a long-lived compile server and its thin
+                client, talking over a local Unix-domain socket.
+
+    @file       server.c
+    @headerfile server.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Wire protocol, all integers in host byte order (the socket is
+                local):
+                  - request header: magic, version, argc, length of cwd, sent
+                    with the client's stdout and stderr as SCM_RIGHTS;
+                  - cwd bytes, then for each argument its length and bytes;
+                  - response: the exit status as a 32-bit signed integer.
+                Strings are sent without their terminating NUL.
+
+    @note       - Oversized requests are rejected before any allocation, and
+                  a client silent for SERVER_RECV_TIMEOUT_S mid-request is
+                  dropped.
+                - The file cache is a fixed-size chained hash table guarded
+                  by one mutex; entries are reference counted, so a reload
+                  never frees contents that a handler is still reading.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Feature Macros >*/
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE     /*< accept4() and MSG_CMSG_CLOEXEC >*/
+#endif
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/*< Implements >*/
+#include "server.h"
+#include "../allocator/allocator.h"
+#include "../time_trace/time_trace.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       SERVER_MAGIC
+    @brief     First word of every request ("FRST" in little endian).
+============================================================================ **/
+#define SERVER_MAGIC                0x54535246u
+
+/** ============================================================================
+    @def       SERVER_VERSION
+    @brief     Version of the wire protocol.
+============================================================================ **/
+#define SERVER_VERSION              1u
+
+/** ============================================================================
+    @def       SERVER_MAX_ARGS
+    @brief     Largest argument count accepted from a client.
+============================================================================ **/
+#define SERVER_MAX_ARGS             65536u
+
+/** ============================================================================
+    @def       SERVER_MAX_STRING
+    @brief     Largest argument or directory length accepted from a client.
+============================================================================ **/
+#define SERVER_MAX_STRING           (1u << 20)
+
+/** ============================================================================
+    @def       SERVER_POLL_MS
+    @brief     Period at which the accept loop checks the stop flag.
+============================================================================ **/
+#define SERVER_POLL_MS              250
+
+/** ============================================================================
+    @def       SERVER_RECV_TIMEOUT_S
+    @brief     Longest a client may keep a connection silent mid-request.
+============================================================================ **/
+#define SERVER_RECV_TIMEOUT_S       30
+
+/** ============================================================================
+    @def       SERVER_CACHE_BUCKETS
+    @brief     Number of buckets of the file cache (power of two).
+============================================================================ **/
+#define SERVER_CACHE_BUCKETS        256u
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostServerHeader
+  @package  Frost_Server
+
+  @typedef  server_header_t
+
+  @brief    Fixed-size part of a request.
+============================================================================ **/
+typedef struct frostServerHeader
+{
+    uint32_t    magic;          /*< Must be SERVER_MAGIC >*/
+    uint32_t    version;        /*< Must be SERVER_VERSION >*/
+    uint32_t    argc;           /*< Number of arguments that follow >*/
+    uint32_t    cwd_length;     /*< Length of the working directory >*/
+} server_header_t;
+
+/** ============================================================================
+  @struct   frostServerConnection
+  @package  Frost_Server
+
+  @typedef  server_connection_t
+
+  @brief    Accepted connection handed over to a scheduler task.
+============================================================================ **/
+typedef struct frostServerConnection
+{
+    task_t      task;           /*< Scheduler storage >*/
+    server_t    *server;        /*< Server owning the connection >*/
+    int         fd;             /*< Connected socket >*/
+} server_connection_t;
+
+/** ============================================================================
+  @struct   frostServer
+  @package  Frost_Server
+
+  @brief    Listening socket, handler and warm caches.
+============================================================================ **/
+struct frostServer
+{
+    int                 listen_fd;                      /*< Listening socket >*/
+    char                *socket_path;                   /*< Path to unlink on exit >*/
+    dev_t               socket_dev;                     /*< Device of the bound socket file >*/
+    ino_t               socket_ino;                     /*< Inode of the bound socket file >*/
+    server_handler_t    handler;                        /*< Request handler >*/
+    void                *ctx;                           /*< Handler context >*/
+    atomic_bool         stop;                           /*< Set by Frost_serverStop >*/
+
+    pthread_mutex_t     cache_lock;                     /*< Protects cache buckets >*/
+    server_file_t       *cache[SERVER_CACHE_BUCKETS];   /*< Cached source files >*/
+};
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_serverReadFull
+  @package  Frost_Server
+
+  @brief    Reads exactly size bytes from a descriptor.
+
+  @param    fd        [in]:   Descriptor to read from.
+  @param    buffer    [out]:  Destination buffer.
+  @param    size      [in]:   Number of bytes to read.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EPIPE on premature end of stream, or a negative errno value.
+ =========================================================================== **/
+static int Frost_serverReadFull(int fd, void *buffer, size_t size)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    size_t done     = 0u;
+    ssize_t count   = 0;
+
+    /*< Start Function Algorithm >*/
+    while (done < size)
+    {
+        count = read(fd, (char *)buffer + done, size - done);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            ret = -errno;
+            goto end_of_function;
+        }
+
+        if (count == 0)
+        {
+            ret = -EPIPE;
+            goto end_of_function;
+        }
+
+        done += (size_t)count;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_serverWriteFull
+  @package  Frost_Server
+
+  @brief    Writes exactly size bytes to a descriptor.
+
+  @param    fd        [in]:   Descriptor to write to.
+  @param    buffer    [in]:   Source buffer.
+  @param    size      [in]:   Number of bytes to write.
+
+  @return   FUNCTION_SUCCESS on success.
+            Negative errno value on failure.
+ =========================================================================== **/
+static int Frost_serverWriteFull(int fd, const void *buffer, size_t size)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    size_t done     = 0u;
+    ssize_t count   = 0;
+
+    /*< Start Function Algorithm >*/
+    while (done < size)
+    {
+        count = send(fd, (const char *)buffer + done, size - done, MSG_NOSIGNAL);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            ret = -errno;
+            goto end_of_function;
+        }
+
+        done += (size_t)count;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_serverReadString
+  @package  Frost_Server
+
+  @brief    Reads a string of known length and NUL-terminates it.
+
+  @param    fd        [in]:   Descriptor to read from.
+  @param    length    [in]:   Number of bytes to read.
+
+  @return   Pointer to a newly allocated string on success.
+            NULL if the length is too large, allocation fails or the read
+            fails.
+ =========================================================================== **/
+static char *Frost_serverReadString(int fd, uint32_t length)
+{
+    /*< Variable Declarations >*/
+    char *string_out = NULL;
+
+    /*< Security Checks >*/
+    if (length > SERVER_MAX_STRING)
+    {
+        LOG_ERROR("Compile request string is too long.");
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    string_out = (char *)Frost_memAlloc((size_t)length + 1u, FROST_MEM_SERVER);
+    if (string_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for request string.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (Frost_serverReadFull(fd, string_out, length) != FUNCTION_SUCESS)
+    {
+        Frost_memFree(string_out, (size_t)length + 1u, FROST_MEM_SERVER);
+        string_out = NULL;
+        goto end_of_function;
+    }
+
+    string_out[length] = '\0';
+
+    /*< Function Output >*/
+end_of_function:
+    return string_out;
+}
+
+/** ============================================================================
+  @fn       Frost_serverCloseRights
+  @package  Frost_Server
+
+  @brief    Closes every descriptor carried by an SCM_RIGHTS message.
+
+  @param    cmsg      [in]:   Control message holding the descriptors.
+ =========================================================================== **/
+static void Frost_serverCloseRights(const struct cmsghdr *cmsg)
+{
+    /*< Variable Declarations >*/
+    const unsigned char *data   = CMSG_DATA(cmsg);
+    size_t count                = 0u;
+    size_t index                = 0u;
+    int fd                      = -1;
+
+    /*< Start Function Algorithm >*/
+    count = (cmsg->cmsg_len - CMSG_LEN(0u)) / sizeof(int);
+
+    for (index = 0u; index < count; index++)
+    {
+        memcpy(&fd, data + (index * sizeof(int)), sizeof(fd));
+        close(fd);
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_serverServe
+  @package  Frost_Server
+
+  @brief    Reads one request from a connection, runs the handler and replies.
+
+  @param    server    [in]:   Pointer to the server.
+  @param    fd        [in]:   Connected socket, closed before returning.
+ =========================================================================== **/
+static void Frost_serverServe(server_t *server, int fd)
+{
+    /*< Variable Declarations >*/
+    server_header_t header                          = { 0u };
+    server_request_t request                        = { 0 };
+    char control[CMSG_SPACE(2u * sizeof(int))]      = { 0 };
+    struct iovec iov                                = { 0 };
+    struct msghdr message                           = { 0 };
+    struct cmsghdr *cmsg                            = NULL;
+    char *cwd                                       = NULL;
+    uint32_t length                                 = 0u;
+    int32_t status                                  = -1;
+    int fds[2]                                      = { -1, -1 };
+    int index                                       = 0;
+
+    /*< Receive Header and Descriptors >*/
+    iov.iov_base            = &header;
+    iov.iov_len             = sizeof(header);
+    message.msg_iov         = &iov;
+    message.msg_iovlen      = 1u;
+    message.msg_control     = control;
+    message.msg_controllen  = sizeof(control);
+
+    if (recvmsg(fd, &message, MSG_CMSG_CLOEXEC | MSG_WAITALL) != (ssize_t)sizeof(header))
+    {
+        LOG_ERROR("Failed to receive compile request header.");
+        goto close_connection;
+    }
+
+    for (cmsg = CMSG_FIRSTHDR(&message); cmsg != NULL; cmsg = CMSG_NXTHDR(&message, cmsg))
+    {
+        if ( (cmsg->cmsg_level != SOL_SOCKET) || (cmsg->cmsg_type != SCM_RIGHTS) )
+        {
+            continue;
+        }
+
+        if ( (cmsg->cmsg_len == CMSG_LEN(2u * sizeof(int))) && (fds[0] < 0) )
+        {
+            memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+            continue;
+        }
+
+        /*< Descriptors were installed by the kernel: close those we refuse >*/
+        Frost_serverCloseRights(cmsg);
+    }
+
+    /*< MSG_CTRUNC: more descriptors were sent than the request carries >*/
+    if ( (header.magic != SERVER_MAGIC) || (header.version != SERVER_VERSION) ||
+         (header.argc > SERVER_MAX_ARGS) || (fds[0] < 0) || (fds[1] < 0) ||
+         ((message.msg_flags & MSG_CTRUNC) != 0) )
+    {
+        LOG_ERROR("Malformed compile request.");
+        goto close_fds;
+    }
+
+    /*< Receive Directory and Arguments >*/
+    cwd = Frost_serverReadString(fd, header.cwd_length);
+    if (cwd == NULL)
+    {
+        goto close_fds;
+    }
+
+    request.argv = (char **)Frost_memCalloc((size_t)header.argc + 1u, sizeof(char *), FROST_MEM_SERVER);
+    if (request.argv == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for request arguments.");
+        goto free_request;
+    }
+
+    for (request.argc = 0; (uint32_t)request.argc < header.argc; request.argc++)
+    {
+        if (Frost_serverReadFull(fd, &length, sizeof(length)) != FUNCTION_SUCESS)
+        {
+            goto free_request;
+        }
+
+        request.argv[request.argc] = Frost_serverReadString(fd, length);
+        if (request.argv[request.argc] == NULL)
+        {
+            goto free_request;
+        }
+    }
+
+    /*< Run the Compile >*/
+    request.cwd     = cwd;
+    request.out_fd  = fds[0];
+    request.err_fd  = fds[1];
+
+    status = (int32_t)server->handler(server, &request, server->ctx);
+
+    Frost_serverWriteFull(fd, &status, sizeof(status));
+
+free_request:
+    if (request.argv != NULL)
+    {
+        for (index = 0; index < request.argc; index++)
+        {
+            Frost_memFree(request.argv[index], strlen(request.argv[index]) + 1u, FROST_MEM_SERVER);
+        }
+
+        Frost_memFree(request.argv, ((size_t)header.argc + 1u) * sizeof(char *), FROST_MEM_SERVER);
+    }
+
+    Frost_memFree(cwd, strlen(cwd) + 1u, FROST_MEM_SERVER);
+
+close_fds:
+    for (index = 0; index < 2; index++)
+    {
+        if (fds[index] >= 0)
+        {
+            close(fds[index]);
+        }
+    }
+
+close_connection:
+    close(fd);
+}
+
+/** ============================================================================
+  @fn       Frost_serverServeTask
+  @package  Frost_Server
+
+  @brief    Scheduler entry point serving one accepted connection.
+
+  @param    arg       [in]:   Pointer to a server_connection_t, freed here.
+ =========================================================================== **/
+static void Frost_serverServeTask(void *arg)
+{
+    /*< Variable Declarations >*/
+    server_connection_t *connection = (server_connection_t *)arg;
+
+    /*< Start Function Algorithm >*/
+    Frost_serverServe(connection->server, connection->fd);
+    Frost_memFree(connection, sizeof(server_connection_t), FROST_MEM_SERVER);
+}
+
+/** ============================================================================
+  @fn       Frost_serverHashPath
+  @package  Frost_Server
+
+  @brief    Hashes a path into a cache bucket (FNV-1a).
+
+  @param    path      [in]:   NUL-terminated path.
+
+  @return   Bucket index.
+ =========================================================================== **/
+static size_t Frost_serverHashPath(const char *path)
+{
+    /*< Variable Declarations >*/
+    uint64_t hash = 0xcbf29ce484222325u;
+
+    /*< Start Function Algorithm >*/
+    for (; *path != '\0'; path++)
+    {
+        hash ^= (uint8_t)*path;
+        hash *= 0x100000001b3u;
+    }
+
+    /*< Function Output >*/
+    return (size_t)(hash & (SERVER_CACHE_BUCKETS - 1u));
+}
+
+/** ============================================================================
+  @fn       Frost_serverDropFile
+  @package  Frost_Server
+
+  @brief    Drops one reference to a cached file, freeing it on the last one.
+
+  @param    file      [in]:   File to be released.
+ =========================================================================== **/
+static void Frost_serverDropFile(server_file_t *file)
+{
+    /*< Start Function Algorithm >*/
+    if (atomic_fetch_sub_explicit(&file->refs, 1u, memory_order_acq_rel) == 1u)
+    {
+        Frost_memFree(file->data, file->size + 1u, FROST_MEM_SERVER);
+        Frost_memFree(file->path, strlen(file->path) + 1u, FROST_MEM_SERVER);
+        Frost_memFree(file, sizeof(server_file_t), FROST_MEM_SERVER);
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_serverLoadFile
+  @package  Frost_Server
+
+  @brief    Reads a whole file into a new cache entry.
+
+  @param    path      [in]:   Absolute path of the file.
+
+  @return   Pointer to a new entry holding one reference on success.
+            NULL if the file cannot be opened, read, or allocation fails.
+ =========================================================================== **/
+static server_file_t *Frost_serverLoadFile(const char *path)
+{
+    /*< Variable Declarations >*/
+    server_file_t *file_out = NULL;
+    struct stat info        = { 0 };
+    int fd                  = -1;
+    trace_span_t span       = { 0 };
+
+    /*< Open and Describe the File >*/
+    Frost_traceBegin(&span, TRACE_PHASE_READ, path);
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        goto end_of_function;
+    }
+
+    if ( (fstat(fd, &info) != 0) || (!S_ISREG(info.st_mode)) )
+    {
+        goto close_file;
+    }
+
+    /*< Allocate Memory >*/
+    file_out = (server_file_t *)Frost_memCalloc(1u, sizeof(server_file_t), FROST_MEM_SERVER);
+    if (file_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for cached file.");
+        goto close_file;
+    }
+
+    file_out->path = Frost_memStrdup(path, FROST_MEM_SERVER);
+    file_out->data = (char *)Frost_memAlloc((size_t)info.st_size + 1u, FROST_MEM_SERVER);
+    if ( (file_out->path == NULL) || (file_out->data == NULL) )
+    {
+        LOG_ERROR("Memory allocation failed for cached file contents.");
+        goto free_file;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (Frost_serverReadFull(fd, file_out->data, (size_t)info.st_size) != FUNCTION_SUCESS)
+    {
+        goto free_file;
+    }
+
+    file_out->data[info.st_size]    = '\0';
+    file_out->size                  = (size_t)info.st_size;
+    file_out->dev                   = info.st_dev;
+    file_out->ino                   = info.st_ino;
+    file_out->st_size               = info.st_size;
+    file_out->mtime                 = info.st_mtim;
+    atomic_init(&file_out->refs, 1u);
+    goto close_file;
+
+free_file:
+    Frost_memFree(file_out->data, (size_t)info.st_size + 1u, FROST_MEM_SERVER);
+    Frost_memFree(file_out->path, strlen(path) + 1u, FROST_MEM_SERVER);
+    Frost_memFree(file_out, sizeof(server_file_t), FROST_MEM_SERVER);
+    file_out = NULL;
+
+close_file:
+    close(fd);
+
+    /*< Function Output >*/
+end_of_function:
+    Frost_traceEnd(&span);
+    return file_out;
+}
+
+/** ============================================================================
+  @fn       Frost_serverClaimPath
+  @package  Frost_Server
+
+  @brief    Makes a socket path free for bind, removing it only if it is a
+            dead server socket.
+
+  @details  A socket file nobody listens on is left behind by a server that
+            crashed; connecting to it is refused, and only then is it
+            unlinked. A live server, or a path that is not a socket, is left
+            alone.
+
+  @param    address   [in]:   Address holding the socket path.
+
+  @return   FUNCTION_SUCCESS if the path is free.
+            -EADDRINUSE if a server answers on it.
+            -EEXIST if the path exists and is not a socket.
+            Another negative errno value if it cannot be checked or removed.
+ =========================================================================== **/
+static int Frost_serverClaimPath(const struct sockaddr_un *address)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCESS;
+    struct stat info    = { 0 };
+    int probe           = -1;
+
+    /*< Security Checks >*/
+    if (lstat(address->sun_path, &info) != 0)
+    {
+        ret = (errno == ENOENT) ? (int)FUNCTION_SUCESS : -errno;
+        goto end_of_function;
+    }
+
+    if (!S_ISSOCK(info.st_mode))
+    {
+        ret = -EEXIST;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (probe < 0)
+    {
+        ret = -errno;
+        goto end_of_function;
+    }
+
+    if (connect(probe, (const struct sockaddr *)address, sizeof(*address)) == 0)
+    {
+        ret = -EADDRINUSE;
+    }
+    else if (errno != ECONNREFUSED)
+    {
+        ret = -errno;
+    }
+    else if ( (unlink(address->sun_path) != 0) && (errno != ENOENT) )
+    {
+        ret = -errno;
+    }
+
+    close(probe);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initServer
+  @package  Frost_Server
+
+  @brief    Creates a server listening on a Unix-domain socket.
+
+  @details  A socket file left at the same path by a server that is no
+            longer running is removed first; a live server, or any file that
+            is not a socket, makes the call fail with errno set to EADDRINUSE
+            or EEXIST. The socket is only accessible by its owner.
+
+  @param    socket_path [in]: Filesystem path of the socket.
+  @param    handler   [in]:   Function compiling each request.
+  @param    ctx       [in]:   User context passed to the handler.
+
+  @return   Pointer to a newly created server on success.
+            NULL if an argument is NULL, the path is too long or taken, or
+            the socket cannot be created; errno then tells why.
+ =========================================================================== **/
+server_t *Frost_initServer(const char *socket_path, server_handler_t handler, void *ctx)
+{
+    /*< Variable Declarations >*/
+    server_t *server_out        = NULL;
+    struct sockaddr_un address  = { 0 };
+    struct stat info            = { 0 };
+    int result                  = 0;
+
+    /*< Security Checks >*/
+    if ( (socket_path == NULL) || (handler == NULL) )
+    {
+        LOG_ERROR("Server entry point is NULL.");
+        goto end_of_function;
+    }
+
+    if (strlen(socket_path) >= sizeof(address.sun_path))
+    {
+        LOG_ERROR("Server socket path is too long.");
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    server_out = (server_t *)Frost_memCalloc(1u, sizeof(server_t), FROST_MEM_SERVER);
+    if (server_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for server.");
+        goto end_of_function;
+    }
+
+    server_out->socket_path = Frost_memStrdup(socket_path, FROST_MEM_SERVER);
+    if (server_out->socket_path == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for server socket path.");
+        goto free_server;
+    }
+
+    /*< Start Function Algorithm >*/
+    server_out->handler = handler;
+    server_out->ctx     = ctx;
+    atomic_init(&server_out->stop, false);
+    pthread_mutex_init(&server_out->cache_lock, NULL);
+
+    server_out->listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (server_out->listen_fd < 0)
+    {
+        result = -errno;
+        LOG_ERROR("Failed to create server socket.");
+        goto destroy_lock;
+    }
+
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socket_path);
+
+    result = Frost_serverClaimPath(&address);
+    if (result != FUNCTION_SUCESS)
+    {
+        LOG_ERROR("Server socket path is in use or cannot be claimed.");
+        goto close_socket;
+    }
+
+    if (bind(server_out->listen_fd, (struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        result = -errno;
+        LOG_ERROR("Failed to bind server socket.");
+        goto close_socket;
+    }
+
+    /*< Nobody can connect before listen(), so restricting it here is safe >*/
+    if (chmod(socket_path, S_IRUSR | S_IWUSR) != 0)
+    {
+        result = -errno;
+        LOG_ERROR("Failed to restrict server socket permissions.");
+        unlink(socket_path);
+        goto close_socket;
+    }
+
+    /*< Remember which file is ours, so that only it is removed on exit >*/
+    if (lstat(socket_path, &info) == 0)
+    {
+        server_out->socket_dev = info.st_dev;
+        server_out->socket_ino = info.st_ino;
+    }
+
+    if (listen(server_out->listen_fd, SOMAXCONN) != 0)
+    {
+        result = -errno;
+        LOG_ERROR("Failed to listen on server socket.");
+        unlink(socket_path);
+        goto close_socket;
+    }
+
+    goto end_of_function;
+
+close_socket:
+    close(server_out->listen_fd);
+
+destroy_lock:
+    pthread_mutex_destroy(&server_out->cache_lock);
+
+free_server:
+    Frost_memFree(server_out->socket_path, strlen(socket_path) + 1u, FROST_MEM_SERVER);
+    Frost_memFree(server_out, sizeof(server_t), FROST_MEM_SERVER);
+    server_out = NULL;
+    errno = (result != 0) ? -result : ENOMEM;
+
+    /*< Function Output >*/
+end_of_function:
+    return server_out;
+}
+
+/** ============================================================================
+  @fn       Frost_freeServer
+  @package  Frost_Server
+
+  @brief    Closes the socket, removes it and frees the file cache.
+
+  @details  The socket file is only removed if it is still the one this
+            server bound, not one a later server put at the same path.
+
+  @param    server    [in]:   Pointer to the server to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the server is NULL.
+ =========================================================================== **/
+int Frost_freeServer(server_t *server)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCESS;
+    server_file_t *file     = NULL;
+    server_file_t *next     = NULL;
+    struct stat info        = { 0 };
+    size_t bucket           = 0u;
+
+    /*< Security Checks >*/
+    if (server == NULL)
+    {
+        LOG_ERROR("Server entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    close(server->listen_fd);
+
+    /*< Another server may have replaced the file since >*/
+    if ( (lstat(server->socket_path, &info) == 0) && (S_ISSOCK(info.st_mode)) &&
+         (info.st_dev == server->socket_dev) && (info.st_ino == server->socket_ino) )
+    {
+        unlink(server->socket_path);
+    }
+
+    for (bucket = 0u; bucket < SERVER_CACHE_BUCKETS; bucket++)
+    {
+        for (file = server->cache[bucket]; file != NULL; file = next)
+        {
+            next = file->next;
+            Frost_serverDropFile(file);
+        }
+    }
+
+    pthread_mutex_destroy(&server->cache_lock);
+    Frost_memFree(server->socket_path, strlen(server->socket_path) + 1u, FROST_MEM_SERVER);
+    Frost_memFree(server, sizeof(server_t), FROST_MEM_SERVER);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_serverRun
+  @package  Frost_Server
+
+  @brief    Accepts and serves requests until Frost_serverStop is called.
+
+  @details  Without a scheduler, requests are served one after the other on
+            the calling thread. With a scheduler, each connection is forked
+            onto the pool, and the call joins every pending request before
+            returning.
+
+  @param    server    [in]:   Pointer to the server.
+  @param    scheduler [in]:   Pool used to serve requests, or NULL.
+
+  @return   FUNCTION_SUCCESS when stopped.
+            -ENOMEM if the server is NULL.
+            Negative errno value if accepting connections fails.
+ =========================================================================== **/
+int Frost_serverRun(server_t *server, scheduler_t *scheduler)
+{
+    /*< Variable Declarations >*/
+    int ret                             = FUNCTION_SUCESS;
+    task_group_t group                  = { 0 };
+    server_connection_t *connection     = NULL;
+    struct pollfd poll_fd               = { 0 };
+    struct timeval timeout              = { SERVER_RECV_TIMEOUT_S, 0 };
+    int fd                              = -1;
+
+    /*< Security Checks >*/
+    if (server == NULL)
+    {
+        LOG_ERROR("Server entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_taskGroupInit(&group);
+
+    poll_fd.fd      = server->listen_fd;
+    poll_fd.events  = POLLIN;
+
+    while (!atomic_load(&server->stop))
+    {
+        if (poll(&poll_fd, 1u, SERVER_POLL_MS) <= 0)
+        {
+            continue;
+        }
+
+        fd = accept4(server->listen_fd, NULL, NULL, SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if ( (errno == EINTR) || (errno == ECONNABORTED) || (errno == EAGAIN) )
+            {
+                continue;
+            }
+
+            LOG_ERROR("Failed to accept compile request.");
+            ret = -errno;
+            break;
+        }
+
+        /*< A stalled client must not hold a worker forever >*/
+        if (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0)
+        {
+            LOG_WARNING("Failed to set a receive timeout on compile request.");
+        }
+
+        if (scheduler == NULL)
+        {
+            Frost_serverServe(server, fd);
+            continue;
+        }
+
+        connection = (server_connection_t *)Frost_memCalloc(1u, sizeof(server_connection_t), FROST_MEM_SERVER);
+        if (connection == NULL)
+        {
+            LOG_ERROR("Memory allocation failed for server connection.");
+            Frost_serverServe(server, fd);
+            continue;
+        }
+
+        connection->server  = server;
+        connection->fd      = fd;
+        Frost_schedulerFork(scheduler, &group, &connection->task,
+                            Frost_serverServeTask, connection);
+    }
+
+    if (scheduler != NULL)
+    {
+        Frost_schedulerJoin(scheduler, &group);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_serverStop
+  @package  Frost_Server
+
+  @brief    Asks Frost_serverRun to return. Safe to call from a handler or a
+            signal handler.
+
+  @param    server    [in]:   Pointer to the server.
+ =========================================================================== **/
+void Frost_serverStop(server_t *server)
+{
+    if (server != NULL)
+    {
+        atomic_store(&server->stop, true);
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_serverAcquireFile
+  @package  Frost_Server
+
+  @brief    Returns the cached contents of a file, loading it if needed.
+
+  @details  The cache is keyed by absolute path. A cached entry is reused
+            only if device, inode, size and modification time still match;
+            otherwise the file is read again and the entry replaced.
+
+  @param    server    [in]:   Pointer to the server.
+  @param    path      [in]:   Absolute path of the file.
+
+  @return   Pointer to the cached file on success.
+            NULL if an argument is NULL, or the file cannot be read.
+ =========================================================================== **/
+server_file_t *Frost_serverAcquireFile(server_t *server, const char *path)
+{
+    /*< Variable Declarations >*/
+    server_file_t *file_out = NULL;
+    server_file_t **link    = NULL;
+    struct stat info        = { 0 };
+    size_t bucket           = 0u;
+
+    /*< Security Checks >*/
+    if ( (server == NULL) || (path == NULL) )
+    {
+        LOG_ERROR("Server entry point is NULL.");
+        goto end_of_function;
+    }
+
+    if (stat(path, &info) != 0)
+    {
+        goto end_of_function;
+    }
+
+    /*< Look for a Fresh Entry >*/
+    bucket = Frost_serverHashPath(path);
+
+    pthread_mutex_lock(&server->cache_lock);
+
+    for (file_out = server->cache[bucket]; file_out != NULL; file_out = file_out->next)
+    {
+        if (strcmp(file_out->path, path) == 0)
+        {
+            break;
+        }
+    }
+
+    if ( (file_out != NULL) && (file_out->dev == info.st_dev) &&
+         (file_out->ino == info.st_ino) && (file_out->st_size == info.st_size) &&
+         (file_out->mtime.tv_sec == info.st_mtim.tv_sec) &&
+         (file_out->mtime.tv_nsec == info.st_mtim.tv_nsec) )
+    {
+        atomic_fetch_add_explicit(&file_out->refs, 1u, memory_order_relaxed);
+        pthread_mutex_unlock(&server->cache_lock);
+        goto end_of_function;
+    }
+
+    pthread_mutex_unlock(&server->cache_lock);
+
+    /*< Load Outside the Lock, then Replace any Stale Entry >*/
+    file_out = Frost_serverLoadFile(path);
+    if (file_out == NULL)
+    {
+        goto end_of_function;
+    }
+
+    atomic_store_explicit(&file_out->refs, 2u, memory_order_relaxed);
+
+    pthread_mutex_lock(&server->cache_lock);
+
+    for (link = &server->cache[bucket]; *link != NULL; link = &(*link)->next)
+    {
+        if (strcmp((*link)->path, path) == 0)
+        {
+            server_file_t *stale = *link;
+
+            *link = stale->next;
+            Frost_serverDropFile(stale);
+            break;
+        }
+    }
+
+    file_out->next          = server->cache[bucket];
+    server->cache[bucket]   = file_out;
+
+    pthread_mutex_unlock(&server->cache_lock);
+
+    /*< Function Output >*/
+end_of_function:
+    return file_out;
+}
+
+/** ============================================================================
+  @fn       Frost_serverReleaseFile
+  @package  Frost_Server
+
+  @brief    Releases a file obtained from Frost_serverAcquireFile.
+
+  @param    server    [in]:   Pointer to the server.
+  @param    file      [in]:   File to be released.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if an argument is NULL.
+ =========================================================================== **/
+int Frost_serverReleaseFile(server_t *server, server_file_t *file)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if ( (server == NULL) || (file == NULL) )
+    {
+        LOG_ERROR("Server entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_serverDropFile(file);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_serverForward
+  @package  Frost_Server
+
+  @brief    Client side: runs a compile on the server and waits for it.
+
+  @details  Sends argv and the current working directory, along with the
+            caller's stdout and stderr descriptors, then blocks until the
+            server returns the exit status. A negative return means the
+            server could not be reached, and the caller should compile
+            in-process instead.
+
+  @param    socket_path [in]: Filesystem path of the server socket.
+  @param    argc      [in]:   Number of arguments.
+  @param    argv      [in]:   Argument vector.
+
+  @return   Exit status of the remote compile (zero or positive).
+            Negative errno value if the request could not be completed.
+ =========================================================================== **/
+int Frost_serverForward(const char *socket_path, int argc, char **argv)
+{
+    /*< Variable Declarations >*/
+    int ret                                         = FUNCTION_SUCESS;
+    struct sockaddr_un address                      = { 0 };
+    server_header_t header                          = { 0u };
+    char control[CMSG_SPACE(2u * sizeof(int))]      = { 0 };
+    char cwd[PATH_MAX]                              = { 0 };
+    struct iovec iov                                = { 0 };
+    struct msghdr message                           = { 0 };
+    struct cmsghdr *cmsg                            = NULL;
+    const int fds[2]                                = { STDOUT_FILENO, STDERR_FILENO };
+    uint32_t length                                 = 0u;
+    int32_t status                                  = 0;
+    int fd                                          = -1;
+    int index                                       = 0;
+
+    /*< Security Checks >*/
+    if ( (socket_path == NULL) || (argv == NULL) || (argc < 0) )
+    {
+        LOG_ERROR("Server client entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if ( (strlen(socket_path) >= sizeof(address.sun_path)) ||
+         (getcwd(cwd, sizeof(cwd)) == NULL) )
+    {
+        ret = -ENAMETOOLONG;
+        goto end_of_function;
+    }
+
+    /*< Connect >*/
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        ret = -errno;
+        goto end_of_function;
+    }
+
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socket_path);
+
+    if (connect(fd, (struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        ret = -errno;
+        goto close_socket;
+    }
+
+    /*< Send Header and Descriptors >*/
+    header.magic        = SERVER_MAGIC;
+    header.version      = SERVER_VERSION;
+    header.argc         = (uint32_t)argc;
+    header.cwd_length   = (uint32_t)strlen(cwd);
+
+    iov.iov_base            = &header;
+    iov.iov_len             = sizeof(header);
+    message.msg_iov         = &iov;
+    message.msg_iovlen      = 1u;
+    message.msg_control     = control;
+    message.msg_controllen  = sizeof(control);
+
+    cmsg                = CMSG_FIRSTHDR(&message);
+    cmsg->cmsg_level    = SOL_SOCKET;
+    cmsg->cmsg_type     = SCM_RIGHTS;
+    cmsg->cmsg_len      = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    if (sendmsg(fd, &message, MSG_NOSIGNAL) != (ssize_t)sizeof(header))
+    {
+        ret = -EPIPE;
+        goto close_socket;
+    }
+
+    /*< Send Directory and Arguments >*/
+    ret = Frost_serverWriteFull(fd, cwd, header.cwd_length);
+
+    for (index = 0; (index < argc) && (ret == FUNCTION_SUCESS); index++)
+    {
+        length  = (uint32_t)strlen(argv[index]);
+        ret     = Frost_serverWriteFull(fd, &length, sizeof(length));
+
+        if (ret == FUNCTION_SUCESS)
+        {
+            ret = Frost_serverWriteFull(fd, argv[index], length);
+        }
+    }
+
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto close_socket;
+    }
+
+    /*< Wait for the Exit Status >*/
+    ret = Frost_serverReadFull(fd, &status, sizeof(status));
+    if (ret == FUNCTION_SUCESS)
+    {
+        ret = (status < 0) ? 1 : (int)status;
+    }
+
+close_socket:
+    close(fd);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
+/** @}*/
@@ -0,0 +1,248 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_Server
+
+    @brief      This module provides a long-lived compile server and its thin
+                client, talking over a local Unix-domain socket.
+
+    @file       server.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    A cold `frost` invocation pays for process start-up, empty
+                caches and fresh allocators on every compile. In server mode a
+                single process stays alive and keeps its state warm: the
+                request handler owns whatever long-lived tables the driver
+                builds, and the server offers a shared cache of source files
+                that is revalidated against the file metadata on each use. The
+                client forwards its argv, its working directory and its
+                stdout/stderr descriptors over the socket, then waits for the
+                exit status, so output goes straight to the caller's terminal.
+
+    @note       - The socket is created with owner-only permissions.
+                - Requests may be served concurrently on a Frost Scheduler;
+                  the handler must then be thread-safe.
+                - The server never changes its own working directory; the
+                  handler must resolve relative paths against request->cwd.
+ =========================================================================== **/
+
+#ifndef SERVER_H_
+#define SERVER_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <sys/types.h>
+#include <time.h>
+
+/*< Implements >*/
+#include "../scheduler/scheduler.h"
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostServerRequest
+  @package  Frost_Server
+
+  @typedef  server_request_t
+
+  @brief    One compile request received from a client.
+
+  @details  The descriptors are duplicates of the client's stdout and stderr;
+            the server closes them once the handler returns.
+============================================================================ **/
+typedef struct frostServerRequest
+{
+    int         argc;           /*< Number of arguments >*/
+    char        **argv;         /*< NULL-terminated argument vector >*/
+    const char  *cwd;           /*< Working directory of the client >*/
+    int         out_fd;         /*< Client standard output >*/
+    int         err_fd;         /*< Client standard error >*/
+} server_request_t;
+
+/** ============================================================================
+  @struct   frostServerFile
+  @package  Frost_Server
+
+  @typedef  server_file_t
+
+  @brief    Read-only cached copy of a source file.
+
+  @details  Obtained with Frost_serverAcquireFile and released with
+            Frost_serverReleaseFile. The contents are NUL-terminated and stay
+            valid until released, even if the file changes meanwhile.
+============================================================================ **/
+typedef struct frostServerFile
+{
+    char                    *path;      /*< Absolute path of the file >*/
+    char                    *data;      /*< File contents, NUL-terminated >*/
+    size_t                  size;       /*< Size of the contents in bytes >*/
+
+    dev_t                   dev;        /*< Device at load time >*/
+    ino_t                   ino;        /*< Inode at load time >*/
+    off_t                   st_size;    /*< Size reported by stat at load time >*/
+    struct timespec         mtime;      /*< Modification time at load time >*/
+    atomic_size_t           refs;       /*< Holders, including the cache itself >*/
+    struct frostServerFile  *next;      /*< Next entry in the cache bucket >*/
+} server_file_t;
+
+/** ============================================================================
+  @struct   frostServer
+  @package  Frost_Server
+
+  @typedef  server_t
+
+  @brief    Opaque handle to a running compile server.
+============================================================================ **/
+typedef struct frostServer server_t;
+
+/** ============================================================================
+  @typedef  server_handler_t
+  @package  Frost_Server
+
+  @brief    Signature of the function that compiles one request.
+
+  @param    server    [in]:   Server receiving the request.
+  @param    request   [in]:   Arguments, directory and output descriptors.
+  @param    ctx       [in]:   User context given to Frost_initServer.
+
+  @return   Exit status reported back to the client.
+============================================================================ **/
+typedef int (*server_handler_t)(server_t *server, const server_request_t *request, void *ctx);
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initServer
+  @package  Frost_Server
+
+  @brief    Creates a server listening on a Unix-domain socket.
+
+  @details  A socket file left at the same path by a server that is no
+            longer running is removed first; a live server, or any file that
+            is not a socket, makes the call fail with errno set to EADDRINUSE
+            or EEXIST. The socket is only accessible by its owner.
+
+  @param    socket_path [in]: Filesystem path of the socket.
+  @param    handler   [in]:   Function compiling each request.
+  @param    ctx       [in]:   User context passed to the handler.
+
+  @return   Pointer to a newly created server on success.
+            NULL if an argument is NULL, the path is too long or taken, or
+            the socket cannot be created; errno then tells why.
+ =========================================================================== **/
+server_t *Frost_initServer(const char *socket_path, server_handler_t handler, void *ctx);
+
+/** ============================================================================
+  @fn       Frost_freeServer
+  @package  Frost_Server
+
+  @brief    Closes the socket, removes it and frees the file cache.
+
+  @details  The socket file is only removed if it is still the one this
+            server bound, not one a later server put at the same path.
+
+  @param    server    [in]:   Pointer to the server to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the server is NULL.
+ =========================================================================== **/
+int Frost_freeServer(server_t *server);
+
+/** ============================================================================
+  @fn       Frost_serverRun
+  @package  Frost_Server
+
+  @brief    Accepts and serves requests until Frost_serverStop is called.
+
+  @details  Without a scheduler, requests are served one after the other on
+            the calling thread. With a scheduler, each connection is forked
+            onto the pool, and the call joins every pending request before
+            returning.
+
+  @param    server    [in]:   Pointer to the server.
+  @param    scheduler [in]:   Pool used to serve requests, or NULL.
+
+  @return   FUNCTION_SUCCESS when stopped.
+            -ENOMEM if the server is NULL.
+            Negative errno value if accepting connections fails.
+ =========================================================================== **/
+int Frost_serverRun(server_t *server, scheduler_t *scheduler);
+
+/** ============================================================================
+  @fn       Frost_serverStop
+  @package  Frost_Server
+
+  @brief    Asks Frost_serverRun to return. Safe to call from a handler or a
+            signal handler.
+
+  @param    server    [in]:   Pointer to the server.
+ =========================================================================== **/
+void Frost_serverStop(server_t *server);
+
+/** ============================================================================
+  @fn       Frost_serverAcquireFile
+  @package  Frost_Server
+
+  @brief    Returns the cached contents of a file, loading it if needed.
+
+  @details  The cache is keyed by absolute path. A cached entry is reused
+            only if device, inode, size and modification time still match;
+            otherwise the file is read again and the entry replaced.
+
+  @param    server    [in]:   Pointer to the server.
+  @param    path      [in]:   Absolute path of the file.
+
+  @return   Pointer to the cached file on success.
+            NULL if an argument is NULL, or the file cannot be read.
+ =========================================================================== **/
+server_file_t *Frost_serverAcquireFile(server_t *server, const char *path);
+
+/** ============================================================================
+  @fn       Frost_serverReleaseFile
+  @package  Frost_Server
+
+  @brief    Releases a file obtained from Frost_serverAcquireFile.
+
+  @param    server    [in]:   Pointer to the server.
+  @param    file      [in]:   File to be released.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if an argument is NULL.
+ =========================================================================== **/
+int Frost_serverReleaseFile(server_t *server, server_file_t *file);
+
+/** ============================================================================
+  @fn       Frost_serverForward
+  @package  Frost_Server
+
+  @brief    Client side: runs a compile on the server and waits for it.
+
+  @details  Sends argv and the current working directory, along with the
+            caller's stdout and stderr descriptors, then blocks until the
+            server returns the exit status. A negative return means the
+            server could not be reached, and the caller should compile
+            in-process instead.
+
+  @param    socket_path [in]: Filesystem path of the server socket.
+  @param    argc      [in]:   Number of arguments.
+  @param    argv      [in]:   Argument vector.
+
+  @return   Exit status of the remote compile (zero or positive).
+            Negative errno value if the request could not be completed.
+ =========================================================================== **/
+int Frost_serverForward(const char *socket_path, int argc, char **argv);
+
+#endif /* SERVER_H_ */
+
+/*< end of header file >*/
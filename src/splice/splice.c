@@ -0,0 +1,790 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_Splice
+
+    @package    Frost_Splice
+    @brief      This module finds line splices (backslash-newline and its
+                `??/` trigraph spelling) and lexes sources that contain them
+                without slowing down sources that do not.
+
+    @file       splice.c
+    @headerfile splice.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Lexing alternates two kinds of ranges, both handed to
+                Frost_lexStructural through a private lexer re-targeted with
+                Frost_lexerResetView:
+
+                - In place, from the current position up to the next splice.
+                  The engine sees the range end as the end of the source, so
+                  only tokens that end strictly before it, with room for
+                  SPLICE_LOOKAHEAD, are kept: their extent never depended on
+                  a byte at or past the splice.
+                - Stitched, from the end of the last kept token through the
+                  end of the logical line holding the splice, copied into a
+                  scratch buffer without its splices. Kept tokens get their
+                  offsets mapped back to physical ones. If no token fits in
+                  the window, as with a long block comment, the window is
+                  doubled until one does.
+
+                Lexing resumes in place after the last token kept from the
+                window, so the copies stay as short as the lines involved.
+
+                The scan, each stitch and each range run in their own
+                TRACE_PHASE_LEX span. Growing the splice map and the scratch
+                buffer, and the user callback, happen outside of them, so the
+                lex memory guard holds here too.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+/*< Implements >*/
+#include "splice.h"
+#include "../allocator/allocator.h"
+#include "../time_trace/time_trace.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       SPLICE_BLOCK_SIZE
+    @brief     Number of source bytes searched at once for splice candidates,
+               one bit per byte.
+============================================================================ **/
+#define SPLICE_BLOCK_SIZE           64u
+
+/** ============================================================================
+    @def       SPLICE_LOOKAHEAD
+    @brief     Bytes the scanner reads past the end of a token to find that
+               end.
+============================================================================ **/
+#define SPLICE_LOOKAHEAD            1u
+
+/** ============================================================================
+    @def       SPLICE_STOP
+    @brief     Value returned by the internal token callback to end a range.
+============================================================================ **/
+#define SPLICE_STOP                 1
+
+/** ============================================================================
+    @def       SPLICE_INITIAL_ENTRIES
+    @brief     Initial capacity of a splice map.
+============================================================================ **/
+#define SPLICE_INITIAL_ENTRIES      16u
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostSpliceLex
+  @package  Frost_Splice
+
+  @typedef  splice_lex_t
+
+  @brief    Context of the token callback for one range.
+============================================================================ **/
+typedef struct frostSpliceLex
+{
+    lexer_callback_t    callback;       /*< User callback >*/
+    void                *ctx;           /*< User context >*/
+    const splice_t      *splices;       /*< Splices removed from the range >*/
+    size_t              splice_count;   /*< Entries in splices >*/
+    size_t              cursor;         /*< Splices already mapped >*/
+    size_t              shift;          /*< Bytes of the mapped splices >*/
+    size_t              start;          /*< Physical start of the range >*/
+    size_t              origin;         /*< Offset of the text in the lexer source >*/
+    size_t              limit;          /*< Tokens must end before this, minus look-ahead >*/
+    size_t              end;            /*< Physical end of the last kept token >*/
+    bool                accepted;       /*< At least one token was kept >*/
+    bool                stopped;        /*< A token was refused >*/
+    bool                user_stopped;   /*< The user callback asked to stop >*/
+} splice_lex_t;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_spliceLengthAt
+  @package  Frost_Splice
+
+  @brief    Measures the splice starting at a position, if any.
+
+  @param    source    [in]:   Buffer containing the source code.
+  @param    size      [in]:   Number of bytes of source.
+  @param    pos       [in]:   Position of a backslash or question mark.
+
+  @return   Bytes of the splice, or 0 if none starts at pos.
+ =========================================================================== **/
+static size_t Frost_spliceLengthAt(const char *source, size_t size, size_t pos)
+{
+    /*< Variable Declarations >*/
+    size_t next = pos;
+
+    /*< Start Function Algorithm >*/
+    if (source[pos] == '\\')
+    {
+        next = pos + 1u;
+    }
+    else if ( ((pos + 2u) < size) && (source[pos] == '?') && (source[pos + 1u] == '?') &&
+              (source[pos + 2u] == '/') )
+    {
+        next = pos + 3u;
+    }
+    else
+    {
+        return 0u;
+    }
+
+    if ( (next < size) && (source[next] == '\n') )
+    {
+        return (next + 1u) - pos;
+    }
+
+    if ( ((next + 1u) < size) && (source[next] == '\r') && (source[next + 1u] == '\n') )
+    {
+        return (next + 2u) - pos;
+    }
+
+    /*< Function Output >*/
+    return 0u;
+}
+
+/** ============================================================================
+  @fn       Frost_spliceCandidates
+  @package  Frost_Splice
+
+  @brief    Marks the backslashes and question marks of one source block.
+
+  @details  16 bytes per SSE2 compare when available. The last partial block
+            is copied into a zeroed buffer, so the source is never read past
+            its size.
+
+  @param    source    [in]:   Buffer containing the source code.
+  @param    size      [in]:   Number of bytes of source.
+  @param    base      [in]:   Offset of the block.
+
+  @return   One bit per candidate byte of the block.
+ =========================================================================== **/
+static uint64_t Frost_spliceCandidates(const char *source, size_t size, size_t base)
+{
+    /*< Variable Declarations >*/
+    unsigned char bytes[SPLICE_BLOCK_SIZE]  = { 0u };
+    const unsigned char *data               = NULL;
+    uint64_t mask_out                       = 0u;
+    size_t lane                             = 0u;
+
+    /*< Start Function Algorithm >*/
+    if ((size - base) >= SPLICE_BLOCK_SIZE)
+    {
+        data = (const unsigned char *)source + base;
+    }
+    else
+    {
+        memcpy(bytes, source + base, size - base);
+        data = bytes;
+    }
+
+#if defined(__SSE2__)
+    for (lane = 0u; lane < SPLICE_BLOCK_SIZE; lane += 16u)
+    {
+        const __m128i chunk = _mm_loadu_si128((const __m128i *)(const void *)(data + lane));
+        const __m128i found = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')),
+                                           _mm_cmpeq_epi8(chunk, _mm_set1_epi8('?')));
+
+        mask_out |= (uint64_t)(uint16_t)_mm_movemask_epi8(found) << lane;
+    }
+#else
+    for (lane = 0u; lane < SPLICE_BLOCK_SIZE; lane++)
+    {
+        mask_out |= (uint64_t)((data[lane] == '\\') || (data[lane] == '?')) << lane;
+    }
+#endif
+
+    /*< Function Output >*/
+    return mask_out;
+}
+
+/** ============================================================================
+  @fn       Frost_spliceGrow
+  @package  Frost_Splice
+
+  @brief    Makes room for one more splice in a map.
+
+  @param    map       [in]:   Map to grow.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if allocation fails.
+ =========================================================================== **/
+static int Frost_spliceGrow(splice_map_t *map)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    splice_t *grown = NULL;
+    size_t target   = 0u;
+
+    /*< Security Checks >*/
+    if (map->count < map->capacity)
+    {
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    target = MAX(map->capacity * 2u, (size_t)SPLICE_INITIAL_ENTRIES);
+
+    grown = (splice_t *)Frost_memRealloc(map->items, map->capacity * sizeof(splice_t),
+                                         target * sizeof(splice_t), FROST_MEM_SPLICE);
+    if (grown == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for splice map.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    map->items      = grown;
+    map->capacity   = target;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_spliceLineEnd
+  @package  Frost_Splice
+
+  @brief    Finds the end of the logical line holding a position.
+
+  @param    text      [in]:   Buffer containing the source code.
+  @param    size      [in]:   Number of bytes of text.
+  @param    map       [in]:   Splices of text.
+  @param    index     [in]:   First splice at or after pos.
+  @param    pos       [in]:   Position in the line.
+
+  @return   Offset just past the first newline that is not part of a
+            splice, or size.
+ =========================================================================== **/
+static size_t Frost_spliceLineEnd(const char *text, size_t size, const splice_map_t *map,
+                                  size_t index, size_t pos)
+{
+    /*< Variable Declarations >*/
+    const char *newline = NULL;
+    size_t end          = 0u;
+
+    /*< Start Function Algorithm >*/
+    while (pos < size)
+    {
+        newline = (const char *)memchr(text + pos, '\n', size - pos);
+        if (newline == NULL)
+        {
+            break;
+        }
+
+        end = (size_t)(newline - text) + 1u;
+
+        while ( (index < map->count) && ((map->items[index].offset + map->items[index].length) < end) )
+        {
+            index++;
+        }
+
+        if ( (index == map->count) || ((map->items[index].offset + map->items[index].length) != end) )
+        {
+            return end;
+        }
+
+        pos = end;
+        index++;
+    }
+
+    /*< Function Output >*/
+    return size;
+}
+
+/** ============================================================================
+  @fn       Frost_spliceMapOffset
+  @package  Frost_Splice
+
+  @brief    Converts an offset in a stitched range back to a physical one.
+
+  @details  Offsets must be asked in increasing order. A start offset lands
+            after a splice sitting exactly there, an end offset before it.
+
+  @param    lex       [in]:   Range context.
+  @param    logical   [in]:   Offset in the range, splices removed.
+  @param    start     [in]:   The offset starts a token.
+
+  @return   Physical offset in the text.
+ =========================================================================== **/
+static size_t Frost_spliceMapOffset(splice_lex_t *lex, size_t logical, bool start)
+{
+    /*< Variable Declarations >*/
+    const splice_t *splice  = NULL;
+    size_t position         = 0u;
+
+    /*< Start Function Algorithm >*/
+    while (lex->cursor < lex->splice_count)
+    {
+        splice      = &lex->splices[lex->cursor];
+        position    = splice->offset - lex->start - lex->shift;
+
+        if ( (position > logical) || ((!start) && (position == logical)) )
+        {
+            break;
+        }
+
+        lex->shift += splice->length;
+        lex->cursor++;
+    }
+
+    /*< Function Output >*/
+    return lex->start + logical + lex->shift;
+}
+
+/** ============================================================================
+  @fn       Frost_spliceOnToken
+  @package  Frost_Splice
+
+  @brief    Token callback of a range: keeps tokens that end safely before
+            the range limit and forwards them with physical offsets.
+
+  @return   The value returned by the user callback.
+            SPLICE_STOP once a token is refused.
+ =========================================================================== **/
+static int Frost_spliceOnToken(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    /*< Variable Declarations >*/
+    splice_lex_t *lex   = (splice_lex_t *)ctx;
+    size_t first        = 0u;
+    size_t last         = 0u;
+    int ret             = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (type == TOKEN_EOF)
+    {
+        goto end_of_function;
+    }
+
+    if ((offset + length + SPLICE_LOOKAHEAD) > lex->limit)
+    {
+        lex->stopped = true;
+        ret = SPLICE_STOP;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    first   = Frost_spliceMapOffset(lex, offset, true);
+    last    = Frost_spliceMapOffset(lex, offset + length, false);
+
+    lex->end        = last;
+    lex->accepted   = true;
+
+    ret = lex->callback(type, lex->origin + first, last - first, lex->ctx);
+    if (ret != FUNCTION_SUCESS)
+    {
+        lex->user_stopped = true;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_spliceLexRange
+  @package  Frost_Splice
+
+  @brief    Lexes one range with the structural engine.
+
+  @param    lexer     [in]:   Private lexer, re-targeted to the range.
+  @param    lex       [in]:   Range context.
+  @param    buffer    [in]:   Bytes of the range.
+  @param    size      [in]:   Number of bytes.
+
+  @return   FUNCTION_SUCCESS unless the user callback stopped lexing, in
+            which case its value is returned.
+ =========================================================================== **/
+static int Frost_spliceLexRange(lexer_t *lexer, splice_lex_t *lex, const char *buffer, size_t size)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Start Function Algorithm >*/
+    (void)Frost_lexerResetView(lexer, buffer, size);
+
+    ret = Frost_lexStructural(lexer, Frost_spliceOnToken, lex);
+    if (!lex->user_stopped)
+    {
+        ret = FUNCTION_SUCESS;
+    }
+
+    /*< Function Output >*/
+    return ret;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_spliceScan
+  @package  Frost_Splice
+
+  @brief    Finds every line splice of a source.
+
+  @param    source    [in]:   Buffer containing the source code.
+  @param    size      [in]:   Number of bytes of source.
+  @param    map       [out]:  Zero-initialized map receiving the splices,
+                              released with Frost_spliceRelease.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+ =========================================================================== **/
+int Frost_spliceScan(const char *source, size_t size, splice_map_t *map)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCESS;
+    uint64_t candidates = 0u;
+    size_t base         = 0u;
+    size_t pos          = 0u;
+    size_t length       = 0u;
+    size_t resume       = 0u;
+    trace_span_t span   = { 0 };
+
+    /*< Security Checks >*/
+    if ( (source == NULL) || (map == NULL) )
+    {
+        LOG_ERROR("Splice scan entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_traceBegin(&span, TRACE_PHASE_LEX, NULL);
+
+    for (base = 0u; base < size; base += SPLICE_BLOCK_SIZE)
+    {
+        candidates = Frost_spliceCandidates(source, size, base);
+
+        while (candidates != 0u)
+        {
+            pos         = base + (size_t)__builtin_ctzll(candidates);
+            candidates &= candidates - 1u;
+
+            /*< Skip the second `?` of a trigraph already taken >*/
+            if (pos < resume)
+            {
+                continue;
+            }
+
+            length = Frost_spliceLengthAt(source, size, pos);
+            if (length == 0u)
+            {
+                continue;
+            }
+
+            /*< Growing the map is not lexing >*/
+            if (map->count == map->capacity)
+            {
+                Frost_traceSuspend(&span);
+                ret = Frost_spliceGrow(map);
+                Frost_traceResume(&span);
+
+                if (ret != FUNCTION_SUCESS)
+                {
+                    goto end_trace;
+                }
+            }
+
+            map->items[map->count].offset   = pos;
+            map->items[map->count].length   = length;
+            map->count++;
+            resume = pos + length;
+        }
+    }
+
+end_trace:
+    Frost_traceEnd(&span);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_spliceRelease
+  @package  Frost_Splice
+
+  @brief    Frees the splices of a map and empties it.
+
+  @param    map       [in]:   Map filled by Frost_spliceScan.
+ =========================================================================== **/
+void Frost_spliceRelease(splice_map_t *map)
+{
+    if (map != NULL)
+    {
+        Frost_memFree(map->items, map->capacity * sizeof(splice_t), FROST_MEM_SPLICE);
+        map->items      = NULL;
+        map->count      = 0u;
+        map->capacity   = 0u;
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_spliceCopy
+  @package  Frost_Splice
+
+  @brief    Copies a lexeme without its line splices.
+
+  @param    lexeme    [in]:   Physical bytes of the lexeme.
+  @param    length    [in]:   Number of physical bytes.
+  @param    out       [out]:  Buffer of at least length bytes.
+
+  @return   Number of bytes written to out.
+ =========================================================================== **/
+size_t Frost_spliceCopy(const char *lexeme, size_t length, char *out)
+{
+    /*< Variable Declarations >*/
+    size_t read     = 0u;
+    size_t written  = 0u;
+    size_t splice   = 0u;
+
+    /*< Start Function Algorithm >*/
+    while (read < length)
+    {
+        splice = Frost_spliceLengthAt(lexeme, length, read);
+        if (splice != 0u)
+        {
+            read += splice;
+            continue;
+        }
+
+        out[written++] = lexeme[read++];
+    }
+
+    /*< Function Output >*/
+    return written;
+}
+
+/** ============================================================================
+  @fn       Frost_lexSpliced
+  @package  Frost_Splice
+
+  @brief    Streams every remaining token of the source to a callback, with
+            line splices removed.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+  @param    callback  [in]:   Function receiving each token.
+  @param    ctx       [in]:   User context passed to the callback.
+
+  @return   FUNCTION_SUCCESS once the end of the source was delivered.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            The value returned by the callback, if it stopped early.
+ =========================================================================== **/
+int Frost_lexSpliced(lexer_t *lexer, lexer_callback_t callback, void *ctx)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCESS;
+    splice_map_t map                = { NULL, 0u, 0u };
+    splice_lex_t lex                = { 0 };
+    lexer_checkpoint_t checkpoint   = { NULL, 0u };
+    lexer_t *inner                  = NULL;
+    char *scratch                   = NULL;
+    char *grown                     = NULL;
+    const char *text                = NULL;
+    size_t scratch_size             = 0u;
+    size_t base                     = 0u;
+    size_t size                     = 0u;
+    size_t pos                      = 0u;
+    size_t next                     = 0u;
+    size_t index                    = 0u;
+    size_t last                     = 0u;
+    size_t window_end               = 0u;
+    size_t target                   = 0u;
+    size_t logical                  = 0u;
+    size_t copied                   = 0u;
+    trace_span_t span               = { 0 };
+
+    /*< Security Checks >*/
+    if ( (lexer == NULL) || (callback == NULL) )
+    {
+        LOG_ERROR("Lexer entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    base    = lexer->index;
+    size    = lexer->source_size - base;
+    text    = lexer->source + base;
+
+    ret = Frost_spliceScan(text, size, &map);
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto release_map;
+    }
+
+    /*< Fast Path: No Splice, Nothing Copied >*/
+    if (map.count == 0u)
+    {
+        ret = Frost_lexStructural(lexer, callback, ctx);
+        goto release_map;
+    }
+
+    /*< Allocate Memory >*/
+    inner = Frost_initLexerView("", 0u);
+    if (inner == NULL)
+    {
+        ret = -ENOMEM;
+        goto release_map;
+    }
+
+    /*< Start Function Algorithm >*/
+    while (true)
+    {
+        while ( (index < map.count) && (map.items[index].offset < pos) )
+        {
+            index++;
+        }
+
+        next = (index < map.count) ? map.items[index].offset : size;
+
+        /*< In Place, up to the Next Splice >*/
+        if (next > pos)
+        {
+            lex = (splice_lex_t)
+            {
+                .callback   = callback,
+                .ctx        = ctx,
+                .start      = pos,
+                .origin     = base,
+                .limit      = (index < map.count) ? (next - pos) : SIZE_MAX,
+            };
+
+            ret = Frost_spliceLexRange(inner, &lex, text + pos, next - pos);
+            if (ret != FUNCTION_SUCESS)
+            {
+                goto free_inner;
+            }
+
+            pos = lex.accepted ? lex.end : (lex.stopped ? pos : next);
+        }
+
+        if (index == map.count)
+        {
+            break;
+        }
+
+        /*< Stitched, through the End of the Logical Line >*/
+        window_end = Frost_spliceLineEnd(text, size, &map, index, next);
+
+        while (true)
+        {
+            if ((window_end - pos) > scratch_size)
+            {
+                grown = (char *)Frost_memRealloc(scratch, scratch_size, window_end - pos, FROST_MEM_SPLICE);
+                if (grown == NULL)
+                {
+                    LOG_ERROR("Memory allocation failed for splice window.");
+                    ret = -ENOMEM;
+                    goto free_inner;
+                }
+
+                scratch         = grown;
+                scratch_size    = window_end - pos;
+            }
+
+            /*< Stitching is lexing; growing the scratch above is not >*/
+            Frost_traceBegin(&span, TRACE_PHASE_LEX, NULL);
+
+            logical = 0u;
+            copied  = pos;
+
+            for (last = index; (last < map.count) && (map.items[last].offset < window_end); last++)
+            {
+                memcpy(scratch + logical, text + copied, map.items[last].offset - copied);
+                logical += map.items[last].offset - copied;
+                copied   = map.items[last].offset + map.items[last].length;
+            }
+
+            memcpy(scratch + logical, text + copied, window_end - copied);
+            logical += window_end - copied;
+
+            Frost_traceEnd(&span);
+
+            lex = (splice_lex_t)
+            {
+                .callback       = callback,
+                .ctx            = ctx,
+                .splices        = &map.items[index],
+                .splice_count   = last - index,
+                .start          = pos,
+                .origin         = base,
+                .limit          = (window_end < size) ? logical : SIZE_MAX,
+            };
+
+            ret = Frost_spliceLexRange(inner, &lex, scratch, logical);
+            if (ret != FUNCTION_SUCESS)
+            {
+                goto free_inner;
+            }
+
+            if ( (lex.accepted) || (!lex.stopped) )
+            {
+                pos = lex.accepted ? lex.end : window_end;
+                break;
+            }
+
+            /*< No Token Fits: Double the Window >*/
+            target = window_end + (window_end - pos);
+            while ( (window_end < size) && (window_end < target) )
+            {
+                while ( (last < map.count) && (map.items[last].offset < window_end) )
+                {
+                    last++;
+                }
+
+                window_end = Frost_spliceLineEnd(text, size, &map, last, window_end);
+            }
+        }
+    }
+
+    ret = callback(TOKEN_EOF, base + size, 0u, ctx);
+
+    checkpoint.source   = lexer->source;
+    checkpoint.index    = lexer->source_size;
+    (void)Frost_lexerRestore(lexer, checkpoint);
+
+    /*< Free Memory >*/
+free_inner:
+    Frost_memFree(scratch, scratch_size, FROST_MEM_SPLICE);
+    (void)Frost_freeLexer(inner);
+
+release_map:
+    Frost_spliceRelease(&map);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
+/** @}*/
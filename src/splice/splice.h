@@ -0,0 +1,148 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_Splice
+
+    @brief      This module finds line splices (backslash-newline and its
+                `??/` trigraph spelling) and lexes sources that contain them
+                without slowing down sources that do not.
+
+    @file       splice.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    A splice joins two physical lines into one logical line and
+                may fall anywhere, even inside an identifier or an operator.
+                Rather than testing for it on every byte of the scanner,
+                Frost_spliceScan sweeps the source 64 bytes at a time for
+                backslashes and question marks, 16 bytes per SSE2 compare when
+                available, and verifies only those candidates.
+
+                Frost_lexSpliced then runs the unmodified structural engine on
+                the source in place up to each splice. Only the stretch around
+                a splice, from the last token boundary before it to the end of
+                its logical line, is copied with the splices removed and lexed
+                from that copy. Sources without splices are lexed in place with
+                no copy at all.
+
+    @note       - Only `??/` followed by a newline is recognized among the
+                  trigraphs, since it is the only one that affects lexing
+                  across lines.
+                - A token containing a splice is reported with its physical
+                  extent, splice included; Frost_spliceCopy gives its
+                  spelling.
+ =========================================================================== **/
+
+#ifndef SPLICE_H_
+#define SPLICE_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+#include "../lexer/lexer.h"
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostSplice
+  @package  Frost_Splice
+
+  @typedef  splice_t
+
+  @brief    One line splice in a source.
+============================================================================ **/
+typedef struct frostSplice
+{
+    size_t              offset;         /*< Offset of the backslash or of `??/` >*/
+    size_t              length;         /*< Bytes removed, newline included: 2 to 5 >*/
+} splice_t;
+
+/** ============================================================================
+  @struct   frostSpliceMap
+  @package  Frost_Splice
+
+  @typedef  splice_map_t
+
+  @brief    Splices of a source, in increasing offset order.
+============================================================================ **/
+typedef struct frostSpliceMap
+{
+    splice_t            *items;         /*< Splices found >*/
+    size_t              count;          /*< Entries used in items >*/
+    size_t              capacity;       /*< Entries allocated in items >*/
+} splice_map_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_spliceScan
+  @package  Frost_Splice
+
+  @brief    Finds every line splice of a source.
+
+  @param    source    [in]:   Buffer containing the source code.
+  @param    size      [in]:   Number of bytes of source.
+  @param    map       [out]:  Zero-initialized map receiving the splices,
+                              released with Frost_spliceRelease.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+ =========================================================================== **/
+int Frost_spliceScan(const char *source, size_t size, splice_map_t *map);
+
+/** ============================================================================
+  @fn       Frost_spliceRelease
+  @package  Frost_Splice
+
+  @brief    Frees the splices of a map and empties it.
+
+  @param    map       [in]:   Map filled by Frost_spliceScan.
+ =========================================================================== **/
+void Frost_spliceRelease(splice_map_t *map);
+
+/** ============================================================================
+  @fn       Frost_spliceCopy
+  @package  Frost_Splice
+
+  @brief    Copies a lexeme without its line splices.
+
+  @param    lexeme    [in]:   Physical bytes of the lexeme.
+  @param    length    [in]:   Number of physical bytes.
+  @param    out       [out]:  Buffer of at least length bytes.
+
+  @return   Number of bytes written to out.
+ =========================================================================== **/
+size_t Frost_spliceCopy(const char *lexeme, size_t length, char *out);
+
+/** ============================================================================
+  @fn       Frost_lexSpliced
+  @package  Frost_Splice
+
+  @brief    Streams every remaining token of the source to a callback, with
+            line splices removed.
+
+  @details  Drop-in alternative to Frost_lexStructural. Offsets and lengths
+            given to the callback are physical: they refer to the lexer
+            source, and a token spanning a splice includes it.
+
+  @param    lexer     [in]:   Pointer to the lexer.
+  @param    callback  [in]:   Function receiving each token.
+  @param    ctx       [in]:   User context passed to the callback.
+
+  @return   FUNCTION_SUCCESS once the end of the source was delivered.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            The value returned by the callback, if it stopped early.
+ =========================================================================== **/
+int Frost_lexSpliced(lexer_t *lexer, lexer_callback_t callback, void *ctx);
+
+#endif /* SPLICE_H_ */
+
+/*< end of header file >*/
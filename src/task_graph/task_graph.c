@@ -0,0 +1,914 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_TaskGraph
+
+    @package    Frost_TaskGraph
+    @brief      This module provides a dependency graph executor that models a
+                multi-file build as per-file phases scheduled on the shared
+                thread pool.
+
+    @file       task_graph.c
+    @headerfile task_graph.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Each node keeps an atomic counter of unfinished dependencies.
+                Roots are forked when the run starts; afterwards scheduling is
+                fully decentralized: the worker that finishes a node decrements
+                the counters of its successors and forks the ones that reach
+                zero, which puts them on its own deque for locality. The whole
+                run shares a single task group, joined by the calling thread.
+
+    @note       - Node storage is allocated individually so that the task_t
+                  embedded in each node never moves while the graph grows.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <stdatomic.h>
+
+/*< Implements >*/
+#include "task_graph.h"
+#include "../allocator/allocator.h"
+#include "../time_trace/time_trace.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostGraphNode
+  @package  Frost_TaskGraph
+
+  @typedef  graph_node_t
+
+  @brief    One schedulable unit of the build graph.
+============================================================================ **/
+typedef struct frostGraphNode
+{
+    task_t              task;           /*< Scheduler storage for this node >*/
+    struct frostTaskGraph *graph;       /*< Back pointer to the owning graph >*/
+    char                *name;          /*< Label used in reports >*/
+    build_phase_t       phase;          /*< Build phase of the node >*/
+    graph_node_fn_t     fn;             /*< Function to execute, may be NULL >*/
+    void                *arg;           /*< Argument passed to fn >*/
+
+    size_t              *succ;          /*< Identifiers of dependent nodes >*/
+    size_t              succ_count;     /*< Number of entries in succ >*/
+    size_t              succ_capacity;  /*< Allocated entries in succ >*/
+    size_t              dep_count;      /*< Number of dependencies >*/
+
+    atomic_size_t       pending;        /*< Dependencies not yet finished >*/
+    atomic_bool         skip;           /*< A dependency failed or was skipped >*/
+    int                 result;         /*< Value returned by fn >*/
+    uint64_t            start_ns;       /*< Monotonic start time >*/
+    uint64_t            end_ns;         /*< Monotonic end time >*/
+} graph_node_t;
+
+/** ============================================================================
+  @struct   frostTaskGraph
+  @package  Frost_TaskGraph
+
+  @brief    Node storage plus the state of the current run.
+============================================================================ **/
+struct frostTaskGraph
+{
+    graph_node_t        **nodes;        /*< Array of node pointers >*/
+    size_t              node_count;     /*< Number of nodes >*/
+    size_t              node_capacity;  /*< Allocated entries in nodes >*/
+
+    bool                running;        /*< A run is in progress >*/
+    scheduler_t         *scheduler;     /*< Pool used by the current run >*/
+    task_group_t        group;          /*< Group of every forked node >*/
+    atomic_int          first_error;    /*< First failure of the run >*/
+    uint64_t            run_start_ns;   /*< Monotonic start of the last run >*/
+    uint64_t            run_end_ns;     /*< Monotonic end of the last run >*/
+};
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Printable name of each build phase >*/
+static const char *const build_phase_names[BUILD_PHASE_COUNT] =
+{
+    [BUILD_PHASE_LEX]           = "lex",
+    [BUILD_PHASE_PREPROCESS]    = "preprocess",
+    [BUILD_PHASE_PARSE]         = "parse",
+    [BUILD_PHASE_CHECK]         = "check",
+    [BUILD_PHASE_CODEGEN]       = "codegen",
+    [BUILD_PHASE_OTHER]         = "other",
+};
+
+/*< Time report phase of each build phase >*/
+static const trace_phase_t build_phase_traces[BUILD_PHASE_COUNT] =
+{
+    [BUILD_PHASE_LEX]           = TRACE_PHASE_LEX,
+    [BUILD_PHASE_PREPROCESS]    = TRACE_PHASE_PREPROCESS,
+    [BUILD_PHASE_PARSE]         = TRACE_PHASE_PARSE,
+    [BUILD_PHASE_CHECK]         = TRACE_PHASE_CHECK,
+    [BUILD_PHASE_CODEGEN]       = TRACE_PHASE_CODEGEN,
+    [BUILD_PHASE_OTHER]         = TRACE_PHASE_OTHER,
+};
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_taskGraphNow
+  @package  Frost_TaskGraph
+
+  @brief    Reads the monotonic clock.
+
+  @return   Current monotonic time in nanoseconds.
+ =========================================================================== **/
+static uint64_t Frost_taskGraphNow(void)
+{
+    /*< Variable Declarations >*/
+    struct timespec now = { 0 };
+
+    /*< Start Function Algorithm >*/
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    /*< Function Output >*/
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/** ============================================================================
+  @fn       Frost_taskGraphTopoOrder
+  @package  Frost_TaskGraph
+
+  @brief    Computes a topological order of the graph (Kahn's algorithm).
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    order     [out]:  Array of node_count entries receiving the order.
+  @param    count     [out]:  Number of nodes placed in order. It is lower
+                              than node_count when the graph contains a
+                              cycle, whose nodes are left out.
+
+  @return   FUNCTION_SUCCESS if every node was placed in order.
+            -ENOMEM if memory allocation fails; count is then 0.
+            -ELOOP if the graph contains a cycle.
+ =========================================================================== **/
+static int Frost_taskGraphTopoOrder(const task_graph_t *graph, size_t *order, size_t *count)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCESS;
+    size_t *indegree    = NULL;
+    size_t head         = 0u;
+    size_t tail         = 0u;
+    size_t index        = 0u;
+    size_t edge         = 0u;
+
+    /*< Allocate Memory >*/
+    indegree = (size_t *)Frost_memCalloc(graph->node_count + 1u, sizeof(size_t), FROST_MEM_GRAPH);
+    if (indegree == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for task graph indegrees.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < graph->node_count; index++)
+    {
+        indegree[index] = graph->nodes[index]->dep_count;
+
+        if (indegree[index] == 0u)
+        {
+            order[tail++] = index;
+        }
+    }
+
+    while (head < tail)
+    {
+        const graph_node_t *node = graph->nodes[order[head++]];
+
+        for (edge = 0u; edge < node->succ_count; edge++)
+        {
+            if (--indegree[node->succ[edge]] == 0u)
+            {
+                order[tail++] = node->succ[edge];
+            }
+        }
+    }
+
+    Frost_memFree(indegree, (graph->node_count + 1u) * sizeof(size_t), FROST_MEM_GRAPH);
+
+    if (tail != graph->node_count)
+    {
+        ret = -ELOOP;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    *count = tail;
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_taskGraphExecute
+  @package  Frost_TaskGraph
+
+  @brief    Scheduler entry point of a node: runs it and releases successors.
+
+  @param    arg       [in]:   Pointer to the graph_node_t to execute.
+ =========================================================================== **/
+static void Frost_taskGraphExecute(void *arg)
+{
+    /*< Variable Declarations >*/
+    graph_node_t *node      = (graph_node_t *)arg;
+    task_graph_t *graph     = node->graph;
+    bool failed             = false;
+    int expected            = FUNCTION_SUCESS;
+    size_t edge             = 0u;
+    trace_span_t span       = { 0 };
+
+    /*< Start Function Algorithm >*/
+    Frost_traceBegin(&span, build_phase_traces[node->phase], node->name);
+
+    node->start_ns  = Frost_taskGraphNow();
+    node->result    = FUNCTION_SUCESS;
+
+    if (atomic_load_explicit(&node->skip, memory_order_relaxed))
+    {
+        failed = true;
+    }
+    else if (node->fn != NULL)
+    {
+        node->result = node->fn(node->arg);
+
+        if (node->result < 0)
+        {
+            failed = true;
+            atomic_compare_exchange_strong(&graph->first_error, &expected, node->result);
+        }
+    }
+
+    node->end_ns = Frost_taskGraphNow();
+
+    Frost_traceEnd(&span);
+
+    for (edge = 0u; edge < node->succ_count; edge++)
+    {
+        graph_node_t *succ = graph->nodes[node->succ[edge]];
+
+        if (failed)
+        {
+            atomic_store_explicit(&succ->skip, true, memory_order_relaxed);
+        }
+
+        if (atomic_fetch_sub_explicit(&succ->pending, 1u, memory_order_acq_rel) == 1u)
+        {
+            Frost_schedulerFork(graph->scheduler, &graph->group, &succ->task,
+                                Frost_taskGraphExecute, succ);
+        }
+    }
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initTaskGraph
+  @package  Frost_TaskGraph
+
+  @brief    Creates an empty task graph.
+
+  @return   Pointer to a newly created task graph on success.
+            NULL if memory allocation fails.
+ =========================================================================== **/
+task_graph_t *Frost_initTaskGraph(void)
+{
+    /*< Variable Declarations >*/
+    task_graph_t *graph_out = NULL;
+
+    /*< Allocate Memory >*/
+    graph_out = (task_graph_t *)Frost_memCalloc(1u, sizeof(task_graph_t), FROST_MEM_GRAPH);
+    if (graph_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for task graph.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    atomic_init(&graph_out->first_error, FUNCTION_SUCESS);
+    Frost_taskGroupInit(&graph_out->group);
+
+    /*< Function Output >*/
+end_of_function:
+    return graph_out;
+}
+
+/** ============================================================================
+  @fn       Frost_freeTaskGraph
+  @package  Frost_TaskGraph
+
+  @brief    Frees a task graph and all of its nodes.
+
+  @param    graph     [in]:   Pointer to the task graph to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the graph is NULL.
+ =========================================================================== **/
+int Frost_freeTaskGraph(task_graph_t *graph)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    size_t index    = 0u;
+
+    /*< Security Checks >*/
+    if (graph == NULL)
+    {
+        LOG_ERROR("Task graph entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < graph->node_count; index++)
+    {
+        Frost_memFree(graph->nodes[index]->succ,
+                      graph->nodes[index]->succ_capacity * sizeof(size_t), FROST_MEM_GRAPH);
+        Frost_memFree(graph->nodes[index]->name, strlen(graph->nodes[index]->name) + 1u, FROST_MEM_GRAPH);
+        Frost_memFree(graph->nodes[index], sizeof(graph_node_t), FROST_MEM_GRAPH);
+    }
+
+    Frost_memFree(graph->nodes, graph->node_capacity * sizeof(graph_node_t *), FROST_MEM_GRAPH);
+    Frost_memFree(graph, sizeof(task_graph_t), FROST_MEM_GRAPH);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_taskGraphAddNode
+  @package  Frost_TaskGraph
+
+  @brief    Adds a node to the graph.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    name      [in]:   Label used in reports (copied).
+  @param    phase     [in]:   Build phase the node belongs to.
+  @param    fn        [in]:   Function to execute, or NULL for an empty node.
+  @param    arg       [in]:   Argument passed to fn.
+  @param    node_out  [out]:  Identifier of the new node.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            -EBUSY if the graph is running.
+ =========================================================================== **/
+int Frost_taskGraphAddNode(task_graph_t *graph, const char *name, build_phase_t phase,
+                           graph_node_fn_t fn, void *arg, size_t *node_out)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCESS;
+    graph_node_t *node      = NULL;
+    graph_node_t **nodes    = NULL;
+    size_t capacity         = 0u;
+
+    /*< Security Checks >*/
+    if ( (graph == NULL) || (name == NULL) || (node_out == NULL) )
+    {
+        LOG_ERROR("Task graph entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if (graph->running)
+    {
+        LOG_ERROR("Task graph cannot be modified while running.");
+        ret = -EBUSY;
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    if (graph->node_count == graph->node_capacity)
+    {
+        capacity    = MAX(graph->node_capacity * 2u, 16u);
+        nodes       = (graph_node_t **)Frost_memRealloc(graph->nodes,
+                                    graph->node_capacity * sizeof(graph_node_t *),
+                                    capacity * sizeof(graph_node_t *), FROST_MEM_GRAPH);
+        if (nodes == NULL)
+        {
+            LOG_ERROR("Memory allocation failed for task graph nodes.");
+            ret = -ENOMEM;
+            goto end_of_function;
+        }
+
+        graph->nodes            = nodes;
+        graph->node_capacity    = capacity;
+    }
+
+    node = (graph_node_t *)Frost_memCalloc(1u, sizeof(graph_node_t), FROST_MEM_GRAPH);
+    if (node == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for task graph node.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    node->name = Frost_memStrdup(name, FROST_MEM_GRAPH);
+    if (node->name == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for task graph node name.");
+        Frost_memFree(node, sizeof(graph_node_t), FROST_MEM_GRAPH);
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    node->graph = graph;
+    node->phase = (phase < BUILD_PHASE_COUNT) ? phase : BUILD_PHASE_OTHER;
+    node->fn    = fn;
+    node->arg   = arg;
+    atomic_init(&node->pending, 0u);
+    atomic_init(&node->skip, false);
+
+    *node_out = graph->node_count;
+    graph->nodes[graph->node_count++] = node;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_taskGraphAddEdge
+  @package  Frost_TaskGraph
+
+  @brief    Declares that a node must finish before another one starts.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    before    [in]:   Identifier of the dependency.
+  @param    after     [in]:   Identifier of the dependent node.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the graph is NULL or allocation fails.
+            -EINVAL if a node identifier is out of range.
+            -EBUSY if the graph is running.
+ =========================================================================== **/
+int Frost_taskGraphAddEdge(task_graph_t *graph, size_t before, size_t after)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCESS;
+    graph_node_t *node  = NULL;
+    size_t *succ        = NULL;
+    size_t capacity     = 0u;
+
+    /*< Security Checks >*/
+    if (graph == NULL)
+    {
+        LOG_ERROR("Task graph entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if ( (before >= graph->node_count) || (after >= graph->node_count) )
+    {
+        LOG_ERROR("Task graph node identifier is out of range.");
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    if (graph->running)
+    {
+        LOG_ERROR("Task graph cannot be modified while running.");
+        ret = -EBUSY;
+        goto end_of_function;
+    }
+
+    node = graph->nodes[before];
+
+    /*< Allocate Memory >*/
+    if (node->succ_count == node->succ_capacity)
+    {
+        capacity    = MAX(node->succ_capacity * 2u, 4u);
+        succ        = (size_t *)Frost_memRealloc(node->succ, node->succ_capacity * sizeof(size_t),
+                                             capacity * sizeof(size_t), FROST_MEM_GRAPH);
+        if (succ == NULL)
+        {
+            LOG_ERROR("Memory allocation failed for task graph edges.");
+            ret = -ENOMEM;
+            goto end_of_function;
+        }
+
+        node->succ          = succ;
+        node->succ_capacity = capacity;
+    }
+
+    /*< Start Function Algorithm >*/
+    node->succ[node->succ_count++] = after;
+    graph->nodes[after]->dep_count++;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_taskGraphAddFile
+  @package  Frost_TaskGraph
+
+  @brief    Adds the lex → preprocess → parse → check → codegen chain of one
+            file.
+
+  @details  Creates one node per phase, named "<file>:<phase>", and chains
+            them with edges. The identifiers of the created nodes are written
+            to nodes_out, indexed by build_phase_t, so that cross-file edges
+            (e.g. a header's parse before a user's check) can be added.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    file      [in]:   Path of the file, used for node names.
+  @param    phases    [in]:   Phase functions of the file.
+  @param    arg       [in]:   Argument passed to every phase function.
+  @param    nodes_out [out]:  Node identifiers, BUILD_PHASE_OTHER entries.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            -EBUSY if the graph is running.
+ =========================================================================== **/
+int Frost_taskGraphAddFile(task_graph_t *graph, const char *file,
+                           const file_phases_t *phases, void *arg,
+                           size_t nodes_out[BUILD_PHASE_OTHER])
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    char *name      = NULL;
+    size_t length   = 0u;
+    size_t phase    = 0u;
+
+    /*< Security Checks >*/
+    if ( (graph == NULL) || (file == NULL) || (phases == NULL) || (nodes_out == NULL) )
+    {
+        LOG_ERROR("Task graph entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    length  = strlen(file) + sizeof(":preprocess");
+    name    = (char *)Frost_memAlloc(length, FROST_MEM_GRAPH);
+    if (name == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for task graph node name.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (phase = BUILD_PHASE_LEX; phase < BUILD_PHASE_OTHER; phase++)
+    {
+        snprintf(name, length, "%s:%s", file, build_phase_names[phase]);
+
+        ret = Frost_taskGraphAddNode(graph, name, (build_phase_t)phase,
+                                     phases->fn[phase], arg, &nodes_out[phase]);
+        if (ret != FUNCTION_SUCESS)
+        {
+            goto free_name;
+        }
+
+        if (phase != BUILD_PHASE_LEX)
+        {
+            ret = Frost_taskGraphAddEdge(graph, nodes_out[phase - 1u], nodes_out[phase]);
+            if (ret != FUNCTION_SUCESS)
+            {
+                goto free_name;
+            }
+        }
+    }
+
+free_name:
+    Frost_memFree(name, length, FROST_MEM_GRAPH);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_taskGraphRun
+  @package  Frost_TaskGraph
+
+  @brief    Executes every node of the graph on the given scheduler.
+
+  @details  Nodes without dependencies are forked first. Each finishing node
+            releases its successors, which are forked as soon as their last
+            dependency completes. The call returns when every node has either
+            run or been skipped. A graph can be run again after it finished.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    scheduler [in]:   Pool on which nodes are executed.
+
+  @return   FUNCTION_SUCCESS if every node succeeded.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            -ELOOP if the graph contains a cycle.
+            The first negative value returned by a failing node otherwise.
+ =========================================================================== **/
+int Frost_taskGraphRun(task_graph_t *graph, scheduler_t *scheduler)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    size_t *order   = NULL;
+    size_t count    = 0u;
+    size_t index    = 0u;
+
+    /*< Security Checks >*/
+    if ( (graph == NULL) || (scheduler == NULL) )
+    {
+        LOG_ERROR("Task graph entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    order = (size_t *)Frost_memAlloc((graph->node_count + 1u) * sizeof(size_t), FROST_MEM_GRAPH);
+    if (order == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for task graph order.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Frost_taskGraphTopoOrder(graph, order, &count);
+    if (ret == -ELOOP)
+    {
+        LOG_ERROR("Task graph contains a dependency cycle.");
+        goto free_order;
+    }
+
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto free_order;
+    }
+
+    graph->running      = true;
+    graph->scheduler    = scheduler;
+    atomic_store(&graph->first_error, FUNCTION_SUCESS);
+
+    for (index = 0u; index < graph->node_count; index++)
+    {
+        graph_node_t *node = graph->nodes[index];
+
+        atomic_store_explicit(&node->pending, node->dep_count, memory_order_relaxed);
+        atomic_store_explicit(&node->skip, false, memory_order_relaxed);
+        node->start_ns  = 0u;
+        node->end_ns    = 0u;
+    }
+
+    graph->run_start_ns = Frost_taskGraphNow();
+
+    for (index = 0u; index < graph->node_count; index++)
+    {
+        if (graph->nodes[index]->dep_count == 0u)
+        {
+            Frost_schedulerFork(scheduler, &graph->group, &graph->nodes[index]->task,
+                                Frost_taskGraphExecute, graph->nodes[index]);
+        }
+    }
+
+    Frost_schedulerJoin(scheduler, &graph->group);
+
+    graph->run_end_ns   = Frost_taskGraphNow();
+    graph->running      = false;
+    graph->scheduler    = NULL;
+
+    ret = atomic_load(&graph->first_error);
+
+free_order:
+    Frost_memFree(order, (graph->node_count + 1u) * sizeof(size_t), FROST_MEM_GRAPH);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_taskGraphCriticalPath
+  @package  Frost_TaskGraph
+
+  @brief    Computes the longest chain of dependent nodes of the last run.
+
+  @details  The weight of a node is its measured execution time. The path is
+            written from its first to its last node; if nodes_out is too small
+            only the first entries are written.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    nodes_out [out]:  Node identifiers along the path, may be NULL.
+  @param    capacity  [in]:   Number of entries available in nodes_out.
+  @param    length    [out]:  Number of nodes on the full path.
+  @param    total_ns  [out]:  Sum of the node durations along the path.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the graph, length or total_ns is NULL, or allocation
+            fails.
+ =========================================================================== **/
+int Frost_taskGraphCriticalPath(const task_graph_t *graph, size_t *nodes_out,
+                                size_t capacity, size_t *length, uint64_t *total_ns)
+{
+    /*< Variable Declarations >*/
+    int ret             = FUNCTION_SUCESS;
+    size_t *order       = NULL;
+    size_t *prev        = NULL;
+    uint64_t *dist      = NULL;
+    size_t count        = 0u;
+    size_t index        = 0u;
+    size_t edge         = 0u;
+    size_t last         = SIZE_MAX;
+    size_t node_id      = 0u;
+
+    /*< Security Checks >*/
+    if ( (graph == NULL) || (length == NULL) || (total_ns == NULL) )
+    {
+        LOG_ERROR("Task graph entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    *length     = 0u;
+    *total_ns   = 0u;
+
+    /*< Allocate Memory >*/
+    order   = (size_t *)Frost_memAlloc((graph->node_count + 1u) * sizeof(size_t), FROST_MEM_GRAPH);
+    prev    = (size_t *)Frost_memAlloc((graph->node_count + 1u) * sizeof(size_t), FROST_MEM_GRAPH);
+    dist    = (uint64_t *)Frost_memCalloc(graph->node_count + 1u, sizeof(uint64_t), FROST_MEM_GRAPH);
+    if ( (order == NULL) || (prev == NULL) || (dist == NULL) )
+    {
+        LOG_ERROR("Memory allocation failed for critical path.");
+        ret = -ENOMEM;
+        goto free_buffers;
+    }
+
+    /*< Start Function Algorithm >*/
+    /*< A cycle never ran: its nodes are left out of the path >*/
+    ret = Frost_taskGraphTopoOrder(graph, order, &count);
+    if (ret == -ENOMEM)
+    {
+        goto free_buffers;
+    }
+
+    ret = FUNCTION_SUCESS;
+
+    for (index = 0u; index < graph->node_count; index++)
+    {
+        prev[index] = SIZE_MAX;
+    }
+
+    /*< dist[] holds the best predecessor chain, then the node is added >*/
+    for (index = 0u; index < count; index++)
+    {
+        const graph_node_t *node = graph->nodes[order[index]];
+
+        dist[order[index]] += (node->end_ns - node->start_ns);
+
+        if ( (last == SIZE_MAX) || (dist[order[index]] > dist[last]) )
+        {
+            last = order[index];
+        }
+
+        for (edge = 0u; edge < node->succ_count; edge++)
+        {
+            if (dist[order[index]] > dist[node->succ[edge]])
+            {
+                dist[node->succ[edge]] = dist[order[index]];
+                prev[node->succ[edge]] = order[index];
+            }
+        }
+    }
+
+    if (last == SIZE_MAX)
+    {
+        goto free_buffers;
+    }
+
+    *total_ns = dist[last];
+
+    for (node_id = last; node_id != SIZE_MAX; node_id = prev[node_id])
+    {
+        (*length)++;
+    }
+
+    /*< Walk back from the last node, filling the output from the end >*/
+    index = *length;
+    for (node_id = last; node_id != SIZE_MAX; node_id = prev[node_id])
+    {
+        index--;
+
+        if ( (nodes_out != NULL) && (index < capacity) )
+        {
+            nodes_out[index] = node_id;
+        }
+    }
+
+free_buffers:
+    Frost_memFree(dist, (graph->node_count + 1u) * sizeof(uint64_t), FROST_MEM_GRAPH);
+    Frost_memFree(prev, (graph->node_count + 1u) * sizeof(size_t), FROST_MEM_GRAPH);
+    Frost_memFree(order, (graph->node_count + 1u) * sizeof(size_t), FROST_MEM_GRAPH);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_taskGraphReport
+  @package  Frost_TaskGraph
+
+  @brief    Prints the wall time of the last run and its critical path.
+
+  @details  Reports the total wall time, the time spent per build phase summed
+            over all nodes, and every node on the critical path with its
+            duration.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    stream    [in]:   Output stream, e.g. stderr.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+ =========================================================================== **/
+int Frost_taskGraphReport(const task_graph_t *graph, FILE *stream)
+{
+    /*< Variable Declarations >*/
+    int ret                                 = FUNCTION_SUCESS;
+    uint64_t phase_ns[BUILD_PHASE_COUNT]    = { 0u };
+    size_t *path                            = NULL;
+    size_t length                           = 0u;
+    uint64_t path_ns                        = 0u;
+    size_t index                            = 0u;
+
+    /*< Security Checks >*/
+    if ( (graph == NULL) || (stream == NULL) )
+    {
+        LOG_ERROR("Task graph entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    path = (size_t *)Frost_memAlloc((graph->node_count + 1u) * sizeof(size_t), FROST_MEM_GRAPH);
+    if (path == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for critical path.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    ret = Frost_taskGraphCriticalPath(graph, path, graph->node_count, &length, &path_ns);
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto free_path;
+    }
+
+    for (index = 0u; index < graph->node_count; index++)
+    {
+        phase_ns[graph->nodes[index]->phase] +=
+            (graph->nodes[index]->end_ns - graph->nodes[index]->start_ns);
+    }
+
+    fprintf(stream, "Build wall time: %.3f ms (%zu nodes)\n",
+            (double)(graph->run_end_ns - graph->run_start_ns) / 1e6, graph->node_count);
+
+    fprintf(stream, "Time per phase (summed over nodes):\n");
+    for (index = 0u; index < BUILD_PHASE_COUNT; index++)
+    {
+        fprintf(stream, "  %-12s %12.3f ms\n", build_phase_names[index],
+                (double)phase_ns[index] / 1e6);
+    }
+
+    fprintf(stream, "Critical path: %.3f ms over %zu nodes\n",
+            (double)path_ns / 1e6, length);
+    for (index = 0u; index < length; index++)
+    {
+        const graph_node_t *node = graph->nodes[path[index]];
+
+        fprintf(stream, "  %12.3f ms  %s\n",
+                (double)(node->end_ns - node->start_ns) / 1e6, node->name);
+    }
+
+free_path:
+    Frost_memFree(path, (graph->node_count + 1u) * sizeof(size_t), FROST_MEM_GRAPH);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
+/** @}*/
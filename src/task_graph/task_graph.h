@@ -0,0 +1,269 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_TaskGraph
+
+    @brief      This module provides a dependency graph executor that models a
+                multi-file build as per-file phases scheduled on the shared
+                thread pool.
+
+    @file       task_graph.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Every node of the graph is one phase of one file (lex,
+                preprocess, parse, check or codegen) or any other unit of work
+                registered by the driver. Edges express "must finish before".
+                When a node finishes, the successors whose last dependency it
+                was are forked onto the Frost Scheduler, so independent files
+                and phases run in parallel as soon as they become ready. Each
+                node is timed, and the critical path through the graph is
+                reported at the end, showing what bounds the wall time of the
+                build.
+
+    @note       - Nodes and edges can only be added while the graph is not
+                  running.
+                - If a node fails, its transitive successors are skipped and
+                  the first error is returned by Frost_taskGraphRun.
+ =========================================================================== **/
+
+#ifndef TASK_GRAPH_H_
+#define TASK_GRAPH_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*< Implements >*/
+#include "../scheduler/scheduler.h"
+
+/* ========================================================================== *\
+ *                                PUBLIC ENUMS                                *
+\* ========================================================================== */
+
+/** ============================================================================
+    @enum       frostBuildPhase
+    @package    Frost_TaskGraph
+
+    @typedef    build_phase_t
+
+    @brief      Enumerates the per-file phases of a build.
+
+    @details    BUILD_PHASE_OTHER is used for nodes that do not belong to the
+                per-file pipeline, such as linking or writing outputs.
+============================================================================ **/
+typedef enum frostBuildPhase
+{
+    BUILD_PHASE_LEX         = 0u,   /**< Tokenization of the file */
+    BUILD_PHASE_PREPROCESS  = 1u,   /**< Directive and macro processing */
+    BUILD_PHASE_PARSE       = 2u,   /**< Syntax tree construction */
+    BUILD_PHASE_CHECK       = 3u,   /**< Semantic analysis */
+    BUILD_PHASE_CODEGEN     = 4u,   /**< Code generation */
+    BUILD_PHASE_OTHER       = 5u,   /**< Any node outside the per-file chain */
+    BUILD_PHASE_COUNT       = 6u,   /**< Number of build phases */
+} build_phase_t;
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @typedef  graph_node_fn_t
+  @package  Frost_TaskGraph
+
+  @brief    Signature of the function executed by a graph node.
+
+  @param    arg       [in]:   User argument given when the node was added.
+
+  @return   FUNCTION_SUCCESS on success, or a negative errno value on failure.
+============================================================================ **/
+typedef int (*graph_node_fn_t)(void *arg);
+
+/** ============================================================================
+  @struct   frostFilePhases
+  @package  Frost_TaskGraph
+
+  @typedef  file_phases_t
+
+  @brief    Phase functions used by Frost_taskGraphAddFile.
+
+  @details  One entry per phase from BUILD_PHASE_LEX to BUILD_PHASE_CODEGEN.
+            A NULL entry still creates a node, which completes immediately,
+            so that edges to it remain valid.
+============================================================================ **/
+typedef struct frostFilePhases
+{
+    graph_node_fn_t     fn[BUILD_PHASE_OTHER];  /*< Function of each per-file phase >*/
+} file_phases_t;
+
+/** ============================================================================
+  @struct   frostTaskGraph
+  @package  Frost_TaskGraph
+
+  @typedef  task_graph_t
+
+  @brief    Opaque handle to a build task graph.
+============================================================================ **/
+typedef struct frostTaskGraph task_graph_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initTaskGraph
+  @package  Frost_TaskGraph
+
+  @brief    Creates an empty task graph.
+
+  @return   Pointer to a newly created task graph on success.
+            NULL if memory allocation fails.
+ =========================================================================== **/
+task_graph_t *Frost_initTaskGraph(void);
+
+/** ============================================================================
+  @fn       Frost_freeTaskGraph
+  @package  Frost_TaskGraph
+
+  @brief    Frees a task graph and all of its nodes.
+
+  @param    graph     [in]:   Pointer to the task graph to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the graph is NULL.
+ =========================================================================== **/
+int Frost_freeTaskGraph(task_graph_t *graph);
+
+/** ============================================================================
+  @fn       Frost_taskGraphAddNode
+  @package  Frost_TaskGraph
+
+  @brief    Adds a node to the graph.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    name      [in]:   Label used in reports (copied).
+  @param    phase     [in]:   Build phase the node belongs to.
+  @param    fn        [in]:   Function to execute, or NULL for an empty node.
+  @param    arg       [in]:   Argument passed to fn.
+  @param    node_out  [out]:  Identifier of the new node.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            -EBUSY if the graph is running.
+ =========================================================================== **/
+int Frost_taskGraphAddNode(task_graph_t *graph, const char *name, build_phase_t phase,
+                           graph_node_fn_t fn, void *arg, size_t *node_out);
+
+/** ============================================================================
+  @fn       Frost_taskGraphAddEdge
+  @package  Frost_TaskGraph
+
+  @brief    Declares that a node must finish before another one starts.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    before    [in]:   Identifier of the dependency.
+  @param    after     [in]:   Identifier of the dependent node.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the graph is NULL or allocation fails.
+            -EINVAL if a node identifier is out of range.
+            -EBUSY if the graph is running.
+ =========================================================================== **/
+int Frost_taskGraphAddEdge(task_graph_t *graph, size_t before, size_t after);
+
+/** ============================================================================
+  @fn       Frost_taskGraphAddFile
+  @package  Frost_TaskGraph
+
+  @brief    Adds the lex → preprocess → parse → check → codegen chain of one
+            file.
+
+  @details  Creates one node per phase, named "<file>:<phase>", and chains
+            them with edges. The identifiers of the created nodes are written
+            to nodes_out, indexed by build_phase_t, so that cross-file edges
+            (e.g. a header's parse before a user's check) can be added.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    file      [in]:   Path of the file, used for node names.
+  @param    phases    [in]:   Phase functions of the file.
+  @param    arg       [in]:   Argument passed to every phase function.
+  @param    nodes_out [out]:  Node identifiers, BUILD_PHASE_OTHER entries.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            -EBUSY if the graph is running.
+ =========================================================================== **/
+int Frost_taskGraphAddFile(task_graph_t *graph, const char *file,
+                           const file_phases_t *phases, void *arg,
+                           size_t nodes_out[BUILD_PHASE_OTHER]);
+
+/** ============================================================================
+  @fn       Frost_taskGraphRun
+  @package  Frost_TaskGraph
+
+  @brief    Executes every node of the graph on the given scheduler.
+
+  @details  Nodes without dependencies are forked first. Each finishing node
+            releases its successors, which are forked as soon as their last
+            dependency completes. The call returns when every node has either
+            run or been skipped. A graph can be run again after it finished.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    scheduler [in]:   Pool on which nodes are executed.
+
+  @return   FUNCTION_SUCCESS if every node succeeded.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            -ELOOP if the graph contains a cycle.
+            The first negative value returned by a failing node otherwise.
+ =========================================================================== **/
+int Frost_taskGraphRun(task_graph_t *graph, scheduler_t *scheduler);
+
+/** ============================================================================
+  @fn       Frost_taskGraphCriticalPath
+  @package  Frost_TaskGraph
+
+  @brief    Computes the longest chain of dependent nodes of the last run.
+
+  @details  The weight of a node is its measured execution time. The path is
+            written from its first to its last node; if nodes_out is too small
+            only the first entries are written.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    nodes_out [out]:  Node identifiers along the path, may be NULL.
+  @param    capacity  [in]:   Number of entries available in nodes_out.
+  @param    length    [out]:  Number of nodes on the full path.
+  @param    total_ns  [out]:  Sum of the node durations along the path.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the graph, length or total_ns is NULL, or allocation
+            fails.
+ =========================================================================== **/
+int Frost_taskGraphCriticalPath(const task_graph_t *graph, size_t *nodes_out,
+                                size_t capacity, size_t *length, uint64_t *total_ns);
+
+/** ============================================================================
+  @fn       Frost_taskGraphReport
+  @package  Frost_TaskGraph
+
+  @brief    Prints the wall time of the last run and its critical path.
+
+  @details  Reports the total wall time, the time spent per build phase summed
+            over all nodes, and every node on the critical path with its
+            duration.
+
+  @param    graph     [in]:   Pointer to the task graph.
+  @param    stream    [in]:   Output stream, e.g. stderr.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+ =========================================================================== **/
+int Frost_taskGraphReport(const task_graph_t *graph, FILE *stream);
+
+#endif /* TASK_GRAPH_H_ */
+
+/*< end of header file >*/
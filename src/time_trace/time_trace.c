@@ -0,0 +1,1068 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_TimeTrace
+
+    @package    Frost_TimeTrace
+    @brief      This module measures where compile time goes: a per-phase
+                wall/CPU time report and a Chrome trace-event export.
+
+    @file       time_trace.c
+    @headerfile time_trace.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Each recording thread owns a trace_thread_t, created on its
+                first span and pushed once onto a global lock-free list. It
+                holds the per-phase totals and a chain of fixed-size event
+                chunks that only the owner writes, so recording a span is two
+                clock reads, a few stores and, once every TRACE_CHUNK_EVENTS
+                spans, a chunk allocation. The list is only walked by the
+                report and the writer, after the recording threads are done.
+
+    @note       - Buffers come from the default allocator, not the current
+                  one: they outlive any per-compilation arena and must not be
+                  counted as memory of the phase being measured.
+                - Frost_timeTraceFinish bumps a generation counter, so threads
+                  that recorded before it register a fresh buffer on their
+                  next span.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <stdatomic.h>
+
+/*< Implements >*/
+#include "time_trace.h"
+#include "../allocator/allocator.h"
+#include "../flight_recorder/flight_recorder.h"
+#include "../../inc/utils.h"
+#include "../../inc/probes.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TRACE_CHUNK_EVENTS
+    @brief     Number of events stored in one buffer chunk.
+============================================================================ **/
+#define TRACE_CHUNK_EVENTS          1024u
+
+/** ============================================================================
+    @def       TRACE_DETAIL_SIZE
+    @brief     Bytes kept of a span detail, including the terminator.
+============================================================================ **/
+#define TRACE_DETAIL_SIZE           64u
+
+/** ============================================================================
+    @def       TRACE_NS_PER_US
+    @brief     Nanoseconds per microsecond, the time unit of trace events.
+============================================================================ **/
+#define TRACE_NS_PER_US             UINT64_C(1000)
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostTraceEvent
+  @package  Frost_TimeTrace
+
+  @typedef  trace_event_t
+
+  @brief    One finished span.
+============================================================================ **/
+typedef struct frostTraceEvent
+{
+    uint64_t            start_ns;                   /*< Monotonic begin time >*/
+    uint64_t            wall_ns;                    /*< Wall duration >*/
+    uint64_t            cpu_ns;                     /*< Thread CPU duration >*/
+    trace_phase_t       phase;                      /*< Phase of the span >*/
+    char                detail[TRACE_DETAIL_SIZE];  /*< Copy of the span detail >*/
+} trace_event_t;
+
+/** ============================================================================
+  @struct   frostTraceChunk
+  @package  Frost_TimeTrace
+
+  @typedef  trace_chunk_t
+
+  @brief    Fixed-size block of events in a thread buffer.
+============================================================================ **/
+typedef struct frostTraceChunk
+{
+    struct frostTraceChunk  *next;                          /*< Next chunk >*/
+    size_t                  count;                          /*< Events in use >*/
+    trace_event_t           events[TRACE_CHUNK_EVENTS];     /*< Event storage >*/
+} trace_chunk_t;
+
+/** ============================================================================
+  @struct   frostTraceTotal
+  @package  Frost_TimeTrace
+
+  @typedef  trace_total_t
+
+  @brief    Accumulated time of one phase.
+============================================================================ **/
+typedef struct frostTraceTotal
+{
+    uint64_t            wall_ns;        /*< Summed wall time >*/
+    uint64_t            cpu_ns;         /*< Summed thread CPU time >*/
+    uint64_t            count;          /*< Number of outermost spans >*/
+} trace_total_t;
+
+/** ============================================================================
+  @struct   frostTraceThread
+  @package  Frost_TimeTrace
+
+  @typedef  trace_thread_t
+
+  @brief    Recording state owned by one thread.
+============================================================================ **/
+typedef struct frostTraceThread
+{
+    struct frostTraceThread *next;                          /*< Next registered thread >*/
+    uint32_t                tid;                            /*< Track number in the trace >*/
+    trace_chunk_t           *head;                          /*< First event chunk >*/
+    trace_chunk_t           *tail;                          /*< Chunk being filled >*/
+    trace_total_t           totals[TRACE_PHASE_COUNT];      /*< Per-phase totals >*/
+    uint32_t                depth[TRACE_PHASE_COUNT];       /*< Open spans per phase >*/
+} trace_thread_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Printable name of each trace phase >*/
+static const char *const trace_phase_names[TRACE_PHASE_COUNT] =
+{
+    [TRACE_PHASE_READ]          = "read",
+    [TRACE_PHASE_LEX]           = "lex",
+    [TRACE_PHASE_PREPROCESS]    = "preprocess",
+    [TRACE_PHASE_PARSE]         = "parse",
+    [TRACE_PHASE_CHECK]         = "check",
+    [TRACE_PHASE_IR]            = "ir",
+    [TRACE_PHASE_CODEGEN]       = "codegen",
+    [TRACE_PHASE_WRITE]         = "write",
+    [TRACE_PHASE_OTHER]         = "other",
+};
+
+/*< Enabled TIME_TRACE_* flags, zero when recording is off >*/
+static atomic_uint trace_flags = 0u;
+
+/*< Buffers of every thread that recorded since the last finish >*/
+static _Atomic(trace_thread_t *) trace_threads = NULL;
+
+/*< Last track number handed out >*/
+static atomic_uint trace_next_tid = 0u;
+
+/*< Incremented by each finish to invalidate thread buffers >*/
+static atomic_uint trace_generation = 0u;
+
+/*< Monotonic time at which recording was enabled >*/
+static uint64_t trace_origin_ns = 0u;
+
+/*< Trace file for TIME_TRACE_EVENTS, NULL for the default one >*/
+static char *trace_path = NULL;
+
+/*< Buffer of the calling thread, and the generation it belongs to >*/
+static _Thread_local trace_thread_t *trace_self = NULL;
+static _Thread_local unsigned int trace_self_generation = 0u;
+
+/*< Phase of the innermost span or phase scope of the calling thread >*/
+static _Thread_local trace_phase_t trace_current_phase = TRACE_PHASE_OTHER;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_traceNow
+  @package  Frost_TimeTrace
+
+  @brief    Reads a clock.
+
+  @param    clock     [in]:   CLOCK_MONOTONIC or CLOCK_THREAD_CPUTIME_ID.
+
+  @return   Current time of the clock in nanoseconds.
+ =========================================================================== **/
+static uint64_t Frost_traceNow(clockid_t clock)
+{
+    /*< Variable Declarations >*/
+    struct timespec now = { 0 };
+
+    /*< Start Function Algorithm >*/
+    clock_gettime(clock, &now);
+
+    /*< Function Output >*/
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/** ============================================================================
+  @fn       Frost_traceAlloc
+  @package  Frost_TimeTrace
+
+  @brief    Allocates zeroed trace memory from the default allocator.
+
+  @param    size      [in]:   Number of bytes.
+
+  @return   Pointer to the memory on success.
+            NULL if the allocation fails.
+ =========================================================================== **/
+static void *Frost_traceAlloc(size_t size)
+{
+    /*< Variable Declarations >*/
+    const frost_allocator_t *allocator  = Frost_allocatorDefault();
+    void *memory_out                    = NULL;
+
+    /*< Start Function Algorithm >*/
+    memory_out = allocator->alloc(allocator->ctx, size, ARCH_ALIGNMENT, FROST_MEM_TRACE);
+    if (memory_out != NULL)
+    {
+        memset(memory_out, 0, size);
+    }
+
+    /*< Function Output >*/
+    return memory_out;
+}
+
+/** ============================================================================
+  @fn       Frost_traceFree
+  @package  Frost_TimeTrace
+
+  @brief    Returns trace memory to the default allocator.
+
+  @param    ptr       [in]:   Block to free, or NULL.
+  @param    size      [in]:   Size of the block.
+ =========================================================================== **/
+static void Frost_traceFree(void *ptr, size_t size)
+{
+    /*< Variable Declarations >*/
+    const frost_allocator_t *allocator = Frost_allocatorDefault();
+
+    /*< Start Function Algorithm >*/
+    if (ptr != NULL)
+    {
+        allocator->free(allocator->ctx, ptr, size, FROST_MEM_TRACE);
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_traceThread
+  @package  Frost_TimeTrace
+
+  @brief    Returns the buffer of the calling thread, registering one on the
+            first span after start-up or after a finish.
+
+  @return   Pointer to the thread buffer on success.
+            NULL if memory allocation fails.
+ =========================================================================== **/
+static trace_thread_t *Frost_traceThread(void)
+{
+    /*< Variable Declarations >*/
+    unsigned int generation     = atomic_load_explicit(&trace_generation, memory_order_relaxed);
+    trace_thread_t *thread_out  = trace_self;
+    trace_thread_t *head        = NULL;
+
+    /*< Security Checks >*/
+    if ( (thread_out != NULL) && (trace_self_generation == generation) )
+    {
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    thread_out = (trace_thread_t *)Frost_traceAlloc(sizeof(trace_thread_t));
+    if (thread_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for trace buffer.");
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    thread_out->tid = atomic_fetch_add_explicit(&trace_next_tid, 1u, memory_order_relaxed) + 1u;
+
+    head = atomic_load_explicit(&trace_threads, memory_order_relaxed);
+    do
+    {
+        thread_out->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&trace_threads, &head, thread_out,
+                                                    memory_order_release, memory_order_relaxed));
+
+    trace_self              = thread_out;
+    trace_self_generation   = generation;
+
+    /*< Function Output >*/
+end_of_function:
+    return thread_out;
+}
+
+/** ============================================================================
+  @fn       Frost_traceRecord
+  @package  Frost_TimeTrace
+
+  @brief    Appends a finished span to the buffer of the calling thread.
+
+  @param    thread    [in]:   Buffer of the calling thread.
+  @param    span      [in]:   Span being closed.
+  @param    wall_ns   [in]:   Wall duration.
+  @param    cpu_ns    [in]:   Thread CPU duration.
+ =========================================================================== **/
+static void Frost_traceRecord(trace_thread_t *thread, const trace_span_t *span,
+                              uint64_t wall_ns, uint64_t cpu_ns)
+{
+    /*< Variable Declarations >*/
+    trace_chunk_t *chunk    = thread->tail;
+    trace_event_t *event    = NULL;
+    size_t length           = 0u;
+
+    /*< Security Checks >*/
+    if ( (chunk == NULL) || (chunk->count == TRACE_CHUNK_EVENTS) )
+    {
+        chunk = (trace_chunk_t *)Frost_traceAlloc(sizeof(trace_chunk_t));
+        if (chunk == NULL)
+        {
+            LOG_ERROR("Memory allocation failed for trace events.");
+            goto end_of_function;
+        }
+
+        if (thread->tail != NULL)
+        {
+            thread->tail->next = chunk;
+        }
+        else
+        {
+            thread->head = chunk;
+        }
+
+        thread->tail = chunk;
+    }
+
+    /*< Start Function Algorithm >*/
+    event           = &chunk->events[chunk->count];
+    event->start_ns = span->wall_ns;
+    event->wall_ns  = wall_ns;
+    event->cpu_ns   = cpu_ns;
+    event->phase    = span->phase;
+
+    if (span->detail != NULL)
+    {
+        length = strnlen(span->detail, TRACE_DETAIL_SIZE - 1u);
+        memcpy(event->detail, span->detail, length);
+    }
+
+    event->detail[length] = '\0';
+    chunk->count++;
+
+    /*< Function Output >*/
+end_of_function:
+    return;
+}
+
+/** ============================================================================
+  @fn       Frost_traceWriteString
+  @package  Frost_TimeTrace
+
+  @brief    Writes a string as a quoted, escaped JSON string.
+
+  @param    stream    [in]:   Output stream.
+  @param    string    [in]:   NUL-terminated string.
+ =========================================================================== **/
+static void Frost_traceWriteString(FILE *stream, const char *string)
+{
+    /*< Variable Declarations >*/
+    const unsigned char *cursor = (const unsigned char *)string;
+
+    /*< Start Function Algorithm >*/
+    fputc('"', stream);
+
+    for (; *cursor != '\0'; cursor++)
+    {
+        if ( (*cursor == '"') || (*cursor == '\\') )
+        {
+            fputc('\\', stream);
+            fputc(*cursor, stream);
+        }
+        else if (*cursor < 0x20u)
+        {
+            fprintf(stream, "\\u%04x", *cursor);
+        }
+        else
+        {
+            fputc(*cursor, stream);
+        }
+    }
+
+    fputc('"', stream);
+}
+
+/** ============================================================================
+  @fn       Frost_traceWriteMicros
+  @package  Frost_TimeTrace
+
+  @brief    Writes a nanosecond amount as microseconds with three decimals.
+
+  @param    stream    [in]:   Output stream.
+  @param    ns        [in]:   Amount in nanoseconds.
+ =========================================================================== **/
+static void Frost_traceWriteMicros(FILE *stream, uint64_t ns)
+{
+    fprintf(stream, "%" PRIu64 ".%03" PRIu64, ns / TRACE_NS_PER_US, ns % TRACE_NS_PER_US);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_timeTraceParseArg
+  @package  Frost_TimeTrace
+
+  @brief    Consumes a command-line argument if it is a time-trace flag.
+
+  @details  Recognizes `--time-report`, `--time-trace` and
+            `--time-trace=<path>`, and enables the matching recording.
+
+  @param    arg       [in]:   Command-line argument.
+
+  @return   1 if the argument was a time-trace flag and was applied.
+            0 if the argument is not a time-trace flag.
+            -EINVAL if the argument is NULL or `--time-trace=` has no path.
+            -ENOMEM if the path cannot be stored.
+ =========================================================================== **/
+int Frost_timeTraceParseArg(const char *arg)
+{
+    /*< Variable Declarations >*/
+    static const char trace_prefix[] = "--time-trace=";
+    int ret                          = 0;
+
+    /*< Security Checks >*/
+    if (arg == NULL)
+    {
+        LOG_ERROR("Time trace argument is NULL.");
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (strcmp(arg, "--time-report") == 0)
+    {
+        ret = Frost_timeTraceEnable(TIME_TRACE_REPORT, NULL);
+    }
+    else if (strcmp(arg, "--time-trace") == 0)
+    {
+        ret = Frost_timeTraceEnable(TIME_TRACE_EVENTS, NULL);
+    }
+    else if (strncmp(arg, trace_prefix, sizeof(trace_prefix) - 1u) == 0)
+    {
+        if (arg[sizeof(trace_prefix) - 1u] == '\0')
+        {
+            LOG_ERROR("--time-trace= requires a file name.");
+            ret = -EINVAL;
+            goto end_of_function;
+        }
+
+        ret = Frost_timeTraceEnable(TIME_TRACE_EVENTS, &arg[sizeof(trace_prefix) - 1u]);
+    }
+    else
+    {
+        goto end_of_function;
+    }
+
+    if (ret == FUNCTION_SUCESS)
+    {
+        ret = 1;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_timeTraceEnable
+  @package  Frost_TimeTrace
+
+  @brief    Turns recording on.
+
+  @details  Sets the time origin of the trace on the first call. Flags add up
+            across calls.
+
+  @param    flags     [in]:   TIME_TRACE_REPORT and/or TIME_TRACE_EVENTS.
+  @param    path      [in]:   Trace file for TIME_TRACE_EVENTS, or NULL for
+                              TIME_TRACE_DEFAULT_PATH.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EINVAL if flags is zero or has unknown bits.
+            -ENOMEM if the path cannot be stored.
+ =========================================================================== **/
+int Frost_timeTraceEnable(unsigned int flags, const char *path)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    char *copy      = NULL;
+    size_t size     = 0u;
+
+    /*< Security Checks >*/
+    if ( (flags == 0u) || ((flags & ~(TIME_TRACE_REPORT | TIME_TRACE_EVENTS)) != 0u) )
+    {
+        LOG_ERROR("Invalid time trace flags.");
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (path != NULL)
+    {
+        size = strlen(path) + 1u;
+        copy = (char *)Frost_traceAlloc(size);
+        if (copy == NULL)
+        {
+            LOG_ERROR("Memory allocation failed for trace file name.");
+            ret = -ENOMEM;
+            goto end_of_function;
+        }
+
+        memcpy(copy, path, size);
+
+        if (trace_path != NULL)
+        {
+            Frost_traceFree(trace_path, strlen(trace_path) + 1u);
+        }
+
+        trace_path = copy;
+    }
+
+    if (atomic_load_explicit(&trace_flags, memory_order_relaxed) == 0u)
+    {
+        trace_origin_ns = Frost_traceNow(CLOCK_MONOTONIC);
+    }
+
+    atomic_fetch_or_explicit(&trace_flags, flags, memory_order_release);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_timeTraceEnabled
+  @package  Frost_TimeTrace
+
+  @brief    Tells whether any recording is on.
+
+  @return   true if Frost_timeTraceEnable was called since the last finish.
+ =========================================================================== **/
+bool Frost_timeTraceEnabled(void)
+{
+    return (atomic_load_explicit(&trace_flags, memory_order_relaxed) != 0u);
+}
+
+/** ============================================================================
+  @fn       Frost_tracePhaseName
+  @package  Frost_TimeTrace
+
+  @brief    Returns the printable name of a phase.
+
+  @param    phase     [in]:   Trace phase.
+
+  @return   Lower-case phase name, or "other" for an unknown phase.
+ =========================================================================== **/
+const char *Frost_tracePhaseName(trace_phase_t phase)
+{
+    return trace_phase_names[(phase < TRACE_PHASE_COUNT) ? phase : TRACE_PHASE_OTHER];
+}
+
+/** ============================================================================
+  @fn       Frost_tracePhaseEnter
+  @package  Frost_TimeTrace
+
+  @brief    Sets the current phase of the calling thread, without timing.
+
+  @param    phase     [in]:   New current phase.
+
+  @return   The previous phase, to be given back to Frost_tracePhaseLeave.
+ =========================================================================== **/
+trace_phase_t Frost_tracePhaseEnter(trace_phase_t phase)
+{
+    /*< Variable Declarations >*/
+    trace_phase_t previous = trace_current_phase;
+
+    /*< Start Function Algorithm >*/
+    trace_current_phase = phase;
+
+    /*< Function Output >*/
+    return previous;
+}
+
+/** ============================================================================
+  @fn       Frost_tracePhaseLeave
+  @package  Frost_TimeTrace
+
+  @brief    Restores the phase returned by Frost_tracePhaseEnter.
+
+  @param    previous  [in]:   Phase to restore.
+ =========================================================================== **/
+void Frost_tracePhaseLeave(trace_phase_t previous)
+{
+    trace_current_phase = previous;
+}
+
+/** ============================================================================
+  @fn       Frost_tracePhaseCurrent
+  @package  Frost_TimeTrace
+
+  @brief    Returns the current phase of the calling thread.
+
+  @return   Phase of the innermost open span or phase scope, or
+            TRACE_PHASE_OTHER outside of any.
+ =========================================================================== **/
+trace_phase_t Frost_tracePhaseCurrent(void)
+{
+    return trace_current_phase;
+}
+
+/** ============================================================================
+  @fn       Frost_traceBegin
+  @package  Frost_TimeTrace
+
+  @brief    Opens a span on the calling thread and makes its phase the
+            current one.
+
+  @param    span      [out]:  Span storage, usually a local variable.
+  @param    phase     [in]:   Phase the span is accounted to.
+  @param    detail    [in]:   File or function name shown in the trace, or
+                              NULL. Copied when the span ends.
+ =========================================================================== **/
+void Frost_traceBegin(trace_span_t *span, trace_phase_t phase, const char *detail)
+{
+    /*< Variable Declarations >*/
+    trace_thread_t *thread = NULL;
+
+    /*< Security Checks >*/
+    if (span == NULL)
+    {
+        goto end_of_function;
+    }
+
+    span->previous          = trace_current_phase;
+    span->phase             = phase;
+    span->active            = false;
+    span->paused_wall_ns    = 0u;
+    span->paused_cpu_ns     = 0u;
+
+    if (phase >= TRACE_PHASE_COUNT)
+    {
+        goto end_of_function;
+    }
+
+    trace_current_phase = phase;
+    FROST_PROBE2(phase__begin, phase, detail);
+    Frost_flightRecord(FLIGHT_EVENT_PHASE_BEGIN, (uint32_t)phase, 0u);
+    Frost_flightRecordFile(detail);
+
+    if (atomic_load_explicit(&trace_flags, memory_order_relaxed) == 0u)
+    {
+        goto end_of_function;
+    }
+
+    thread = Frost_traceThread();
+    if (thread == NULL)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    thread->depth[phase]++;
+
+    span->detail    = detail;
+    span->active    = true;
+    span->wall_ns   = Frost_traceNow(CLOCK_MONOTONIC);
+    span->cpu_ns    = Frost_traceNow(CLOCK_THREAD_CPUTIME_ID);
+
+    /*< Function Output >*/
+end_of_function:
+    return;
+}
+
+/** ============================================================================
+  @fn       Frost_traceEnd
+  @package  Frost_TimeTrace
+
+  @brief    Closes a span on the thread that opened it and restores the
+            previous current phase.
+
+  @details  Spans of the same phase nested on one thread are only counted
+            once in the report; the trace keeps all of them.
+
+  @param    span      [in]:   Span filled by Frost_traceBegin.
+ =========================================================================== **/
+void Frost_traceEnd(trace_span_t *span)
+{
+    /*< Variable Declarations >*/
+    trace_thread_t *thread  = NULL;
+    unsigned int flags      = 0u;
+    uint64_t wall_ns        = 0u;
+    uint64_t cpu_ns         = 0u;
+
+    /*< Security Checks >*/
+    if (span == NULL)
+    {
+        goto end_of_function;
+    }
+
+    Frost_tracePhaseLeave(span->previous);
+
+    if (span->phase < TRACE_PHASE_COUNT)
+    {
+        Frost_flightRecord(FLIGHT_EVENT_PHASE_END, (uint32_t)span->phase, 0u);
+    }
+
+    if (!span->active)
+    {
+        if (span->phase < TRACE_PHASE_COUNT)
+        {
+            FROST_PROBE2(phase__end, span->phase, 0u);
+        }
+
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    cpu_ns  = Frost_traceNow(CLOCK_THREAD_CPUTIME_ID) - span->cpu_ns - span->paused_cpu_ns;
+    wall_ns = Frost_traceNow(CLOCK_MONOTONIC) - span->wall_ns - span->paused_wall_ns;
+    flags   = atomic_load_explicit(&trace_flags, memory_order_relaxed);
+
+    span->active = false;
+    FROST_PROBE2(phase__end, span->phase, wall_ns);
+
+    thread = Frost_traceThread();
+    if (thread == NULL)
+    {
+        goto end_of_function;
+    }
+
+    /*< A finish between begin and end leaves a fresh buffer at depth zero >*/
+    if (thread->depth[span->phase] > 0u)
+    {
+        thread->depth[span->phase]--;
+    }
+
+    if ( ((flags & TIME_TRACE_REPORT) != 0u) && (thread->depth[span->phase] == 0u) )
+    {
+        thread->totals[span->phase].wall_ns += wall_ns;
+        thread->totals[span->phase].cpu_ns  += cpu_ns;
+        thread->totals[span->phase].count++;
+    }
+
+    if ((flags & TIME_TRACE_EVENTS) != 0u)
+    {
+        Frost_traceRecord(thread, span, wall_ns, cpu_ns);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return;
+}
+
+/** ============================================================================
+  @fn       Frost_traceSuspend
+  @package  Frost_TimeTrace
+
+  @brief    Steps out of an open span until Frost_traceResume.
+
+  @details  The paused durations are accumulated by subtracting the clocks
+            here and adding them back on resume, so a suspended span needs no
+            extra state.
+
+  @param    span      [in]:   Span filled by Frost_traceBegin.
+ =========================================================================== **/
+void Frost_traceSuspend(trace_span_t *span)
+{
+    /*< Security Checks >*/
+    if (span == NULL)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    Frost_tracePhaseLeave(span->previous);
+
+    if (span->active)
+    {
+        span->paused_wall_ns    -= Frost_traceNow(CLOCK_MONOTONIC);
+        span->paused_cpu_ns     -= Frost_traceNow(CLOCK_THREAD_CPUTIME_ID);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return;
+}
+
+/** ============================================================================
+  @fn       Frost_traceResume
+  @package  Frost_TimeTrace
+
+  @brief    Steps back into a span left with Frost_traceSuspend.
+
+  @param    span      [in]:   Span given to Frost_traceSuspend.
+ =========================================================================== **/
+void Frost_traceResume(trace_span_t *span)
+{
+    /*< Security Checks >*/
+    if ( (span == NULL) || (span->phase >= TRACE_PHASE_COUNT) )
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (span->active)
+    {
+        span->paused_cpu_ns     += Frost_traceNow(CLOCK_THREAD_CPUTIME_ID);
+        span->paused_wall_ns    += Frost_traceNow(CLOCK_MONOTONIC);
+    }
+
+    trace_current_phase = span->phase;
+
+    /*< Function Output >*/
+end_of_function:
+    return;
+}
+
+/** ============================================================================
+  @fn       Frost_timeTraceReport
+  @package  Frost_TimeTrace
+
+  @brief    Prints wall and CPU time per phase, summed over every thread.
+
+  @param    stream    [in]:   Output stream, e.g. stderr.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EINVAL if stream is NULL.
+ =========================================================================== **/
+int Frost_timeTraceReport(FILE *stream)
+{
+    /*< Variable Declarations >*/
+    int ret                                 = FUNCTION_SUCESS;
+    trace_total_t totals[TRACE_PHASE_COUNT] = { { 0u } };
+    const trace_thread_t *thread            = NULL;
+    uint64_t elapsed_ns                     = 0u;
+    size_t threads                          = 0u;
+    size_t phase                            = 0u;
+
+    /*< Security Checks >*/
+    if (stream == NULL)
+    {
+        LOG_ERROR("Time report stream is NULL.");
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    thread = atomic_load_explicit(&trace_threads, memory_order_acquire);
+    for (; thread != NULL; thread = thread->next)
+    {
+        for (phase = 0u; phase < TRACE_PHASE_COUNT; phase++)
+        {
+            totals[phase].wall_ns   += thread->totals[phase].wall_ns;
+            totals[phase].cpu_ns    += thread->totals[phase].cpu_ns;
+            totals[phase].count     += thread->totals[phase].count;
+        }
+
+        threads++;
+    }
+
+    elapsed_ns = Frost_traceNow(CLOCK_MONOTONIC) - trace_origin_ns;
+
+    fprintf(stream, "===-----------------------------------------------------===\n");
+    fprintf(stream, "                    Frost time report\n");
+    fprintf(stream, "===-----------------------------------------------------===\n");
+    fprintf(stream, "  Elapsed: %.3f ms on %zu thread(s)\n\n",
+            (double)elapsed_ns / 1e6, threads);
+    fprintf(stream, "  %-12s %14s %14s %10s\n", "Phase", "Wall (ms)", "CPU (ms)", "Spans");
+
+    for (phase = 0u; phase < TRACE_PHASE_COUNT; phase++)
+    {
+        fprintf(stream, "  %-12s %14.3f %14.3f %10" PRIu64 "\n",
+                trace_phase_names[phase],
+                (double)totals[phase].wall_ns / 1e6,
+                (double)totals[phase].cpu_ns / 1e6,
+                totals[phase].count);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_timeTraceWrite
+  @package  Frost_TimeTrace
+
+  @brief    Writes every recorded span as Chrome trace-event JSON.
+
+  @param    path      [in]:   Output file.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EINVAL if path is NULL.
+            -EIO if the file cannot be written.
+ =========================================================================== **/
+int Frost_timeTraceWrite(const char *path)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCESS;
+    FILE *stream                    = NULL;
+    const trace_thread_t *thread    = NULL;
+    const trace_chunk_t *chunk      = NULL;
+    const trace_event_t *event      = NULL;
+    const char *separator           = "";
+    size_t index                    = 0u;
+
+    /*< Security Checks >*/
+    if (path == NULL)
+    {
+        LOG_ERROR("Time trace path is NULL.");
+        ret = -EINVAL;
+        goto end_of_function;
+    }
+
+    stream = fopen(path, "w");
+    if (stream == NULL)
+    {
+        LOG_ERROR("Cannot open time trace file.");
+        ret = -EIO;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    fprintf(stream, "{\"traceEvents\":[");
+
+    thread = atomic_load_explicit(&trace_threads, memory_order_acquire);
+    for (; thread != NULL; thread = thread->next)
+    {
+        fprintf(stream, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%" PRIu32
+                ",\"args\":{\"name\":\"thread %" PRIu32 "\"}}", separator, thread->tid, thread->tid);
+        separator = ",";
+
+        for (chunk = thread->head; chunk != NULL; chunk = chunk->next)
+        {
+            for (index = 0u; index < chunk->count; index++)
+            {
+                event = &chunk->events[index];
+
+                fprintf(stream, ",\n{\"name\":");
+                Frost_traceWriteString(stream, (event->detail[0] != '\0') ?
+                                               event->detail : trace_phase_names[event->phase]);
+                fprintf(stream, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":", trace_phase_names[event->phase]);
+                Frost_traceWriteMicros(stream, (event->start_ns > trace_origin_ns) ?
+                                               (event->start_ns - trace_origin_ns) : 0u);
+                fprintf(stream, ",\"dur\":");
+                Frost_traceWriteMicros(stream, event->wall_ns);
+                fprintf(stream, ",\"pid\":1,\"tid\":%" PRIu32 ",\"args\":{\"cpu_us\":", thread->tid);
+                Frost_traceWriteMicros(stream, event->cpu_ns);
+                fprintf(stream, "}}");
+            }
+        }
+    }
+
+    fprintf(stream, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    if (ferror(stream) != 0)
+    {
+        ret = -EIO;
+    }
+
+    if ( (fclose(stream) != 0) || (ret != FUNCTION_SUCESS) )
+    {
+        LOG_ERROR("Failed to write time trace file.");
+        ret = -EIO;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_timeTraceFinish
+  @package  Frost_TimeTrace
+
+  @brief    Emits the outputs requested by the flags, then turns recording
+            off and releases every buffer.
+
+  @details  Prints the report to stderr with TIME_TRACE_REPORT and writes the
+            trace file with TIME_TRACE_EVENTS.
+
+  @return   FUNCTION_SUCCESS on success, or when recording was off.
+            -EIO if the trace file cannot be written.
+ =========================================================================== **/
+int Frost_timeTraceFinish(void)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCESS;
+    unsigned int flags      = 0u;
+    trace_thread_t *thread  = NULL;
+    trace_thread_t *next    = NULL;
+    trace_chunk_t *chunk    = NULL;
+    trace_chunk_t *after    = NULL;
+
+    /*< Security Checks >*/
+    flags = atomic_exchange_explicit(&trace_flags, 0u, memory_order_acq_rel);
+    if (flags == 0u)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if ((flags & TIME_TRACE_REPORT) != 0u)
+    {
+        (void)Frost_timeTraceReport(stderr);
+    }
+
+    if ((flags & TIME_TRACE_EVENTS) != 0u)
+    {
+        ret = Frost_timeTraceWrite((trace_path != NULL) ? trace_path : TIME_TRACE_DEFAULT_PATH);
+    }
+
+    /*< Free Memory >*/
+    thread = atomic_exchange_explicit(&trace_threads, NULL, memory_order_acquire);
+    for (; thread != NULL; thread = next)
+    {
+        next = thread->next;
+
+        for (chunk = thread->head; chunk != NULL; chunk = after)
+        {
+            after = chunk->next;
+            Frost_traceFree(chunk, sizeof(trace_chunk_t));
+        }
+
+        Frost_traceFree(thread, sizeof(trace_thread_t));
+    }
+
+    if (trace_path != NULL)
+    {
+        Frost_traceFree(trace_path, strlen(trace_path) + 1u);
+        trace_path = NULL;
+    }
+
+    atomic_fetch_add_explicit(&trace_generation, 1u, memory_order_relaxed);
+    atomic_store_explicit(&trace_next_tid, 0u, memory_order_relaxed);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
+/** @}*/
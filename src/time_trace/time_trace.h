@@ -0,0 +1,318 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_TimeTrace
+
+    @brief      This module measures where compile time goes: a per-phase
+                wall/CPU time report and a Chrome trace-event export.
+
+    @file       time_trace.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Code under measurement opens a span with Frost_traceBegin and
+                closes it with Frost_traceEnd. Each span names a phase and,
+                optionally, a detail such as the file or function being
+                processed. When `--time-report` is given, wall and CPU time
+                are summed per phase and printed by Frost_timeTraceFinish.
+                When `--time-trace=out.json` is given, every span is also kept
+                as a complete event and written as Chrome trace-event JSON,
+                loadable in chrome://tracing or Perfetto, with one track per
+                thread.
+
+                Spans also set the current phase of the calling thread, which
+                other modules read with Frost_tracePhaseCurrent, e.g. to
+                account memory per phase. Frost_tracePhaseEnter sets it
+                without measuring time, for code too fine-grained for spans.
+
+    @note       - With both flags off a span costs one relaxed atomic load
+                  and two thread-local stores.
+                - Spans are recorded into per-thread buffers; no lock is taken
+                  while recording.
+                - Frost_timeTraceFinish must only be called once every thread
+                  that recorded spans has finished, e.g. after the scheduler
+                  or task graph run was joined.
+ =========================================================================== **/
+
+#ifndef TIME_TRACE_H_
+#define TIME_TRACE_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ========================================================================== *\
+ *                              PUBLIC DEFINITIONS                            *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TIME_TRACE_REPORT
+    @brief     Flag: accumulate and print the per-phase time report.
+============================================================================ **/
+#define TIME_TRACE_REPORT           (1u << 0)
+
+/** ============================================================================
+    @def       TIME_TRACE_EVENTS
+    @brief     Flag: record every span and write the Chrome trace file.
+============================================================================ **/
+#define TIME_TRACE_EVENTS           (1u << 1)
+
+/** ============================================================================
+    @def       TIME_TRACE_DEFAULT_PATH
+    @brief     Trace file written when `--time-trace` is given without a path.
+============================================================================ **/
+#define TIME_TRACE_DEFAULT_PATH     "frost-trace.json"
+
+/* ========================================================================== *\
+ *                                PUBLIC ENUMS                                *
+\* ========================================================================== */
+
+/** ============================================================================
+    @enum       frostTracePhase
+    @package    Frost_TimeTrace
+
+    @typedef    trace_phase_t
+
+    @brief      Enumerates the compiler phases shown in the time report.
+============================================================================ **/
+typedef enum frostTracePhase
+{
+    TRACE_PHASE_READ        = 0u,   /**< Reading sources from disk */
+    TRACE_PHASE_LEX         = 1u,   /**< Tokenization */
+    TRACE_PHASE_PREPROCESS  = 2u,   /**< Directive and macro processing */
+    TRACE_PHASE_PARSE       = 3u,   /**< Syntax tree construction */
+    TRACE_PHASE_CHECK       = 4u,   /**< Semantic analysis */
+    TRACE_PHASE_IR          = 5u,   /**< Intermediate representation */
+    TRACE_PHASE_CODEGEN     = 6u,   /**< Code generation */
+    TRACE_PHASE_WRITE       = 7u,   /**< Writing outputs */
+    TRACE_PHASE_OTHER       = 8u,   /**< Anything outside the phases above */
+    TRACE_PHASE_COUNT       = 9u,   /**< Number of trace phases */
+} trace_phase_t;
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostTraceSpan
+  @package  Frost_TimeTrace
+
+  @typedef  trace_span_t
+
+  @brief    An open span, kept on the stack of the measured code.
+
+  @details  Filled by Frost_traceBegin and consumed by Frost_traceEnd; the
+            fields are private to the module.
+============================================================================ **/
+typedef struct frostTraceSpan
+{
+    const char          *detail;        /*< File or function name, may be NULL >*/
+    uint64_t            wall_ns;        /*< Monotonic time at begin >*/
+    uint64_t            cpu_ns;         /*< Thread CPU time at begin >*/
+    uint64_t            paused_wall_ns; /*< Monotonic time spent suspended >*/
+    uint64_t            paused_cpu_ns;  /*< Thread CPU time spent suspended >*/
+    trace_phase_t       phase;          /*< Phase being measured >*/
+    trace_phase_t       previous;       /*< Current phase before the span >*/
+    bool                active;         /*< Tracing was on at begin >*/
+} trace_span_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_timeTraceParseArg
+  @package  Frost_TimeTrace
+
+  @brief    Consumes a command-line argument if it is a time-trace flag.
+
+  @details  Recognizes `--time-report`, `--time-trace` and
+            `--time-trace=<path>`, and enables the matching recording.
+
+  @param    arg       [in]:   Command-line argument.
+
+  @return   1 if the argument was a time-trace flag and was applied.
+            0 if the argument is not a time-trace flag.
+            -EINVAL if the argument is NULL or `--time-trace=` has no path.
+            -ENOMEM if the path cannot be stored.
+ =========================================================================== **/
+int Frost_timeTraceParseArg(const char *arg);
+
+/** ============================================================================
+  @fn       Frost_timeTraceEnable
+  @package  Frost_TimeTrace
+
+  @brief    Turns recording on.
+
+  @details  Sets the time origin of the trace on the first call. Flags add up
+            across calls.
+
+  @param    flags     [in]:   TIME_TRACE_REPORT and/or TIME_TRACE_EVENTS.
+  @param    path      [in]:   Trace file for TIME_TRACE_EVENTS, or NULL for
+                              TIME_TRACE_DEFAULT_PATH.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EINVAL if flags is zero or has unknown bits.
+            -ENOMEM if the path cannot be stored.
+ =========================================================================== **/
+int Frost_timeTraceEnable(unsigned int flags, const char *path);
+
+/** ============================================================================
+  @fn       Frost_timeTraceEnabled
+  @package  Frost_TimeTrace
+
+  @brief    Tells whether any recording is on.
+
+  @return   true if Frost_timeTraceEnable was called since the last finish.
+ =========================================================================== **/
+bool Frost_timeTraceEnabled(void);
+
+/** ============================================================================
+  @fn       Frost_tracePhaseName
+  @package  Frost_TimeTrace
+
+  @brief    Returns the printable name of a phase.
+
+  @param    phase     [in]:   Trace phase.
+
+  @return   Lower-case phase name, or "other" for an unknown phase.
+ =========================================================================== **/
+const char *Frost_tracePhaseName(trace_phase_t phase);
+
+/** ============================================================================
+  @fn       Frost_tracePhaseEnter
+  @package  Frost_TimeTrace
+
+  @brief    Sets the current phase of the calling thread, without timing.
+
+  @param    phase     [in]:   New current phase.
+
+  @return   The previous phase, to be given back to Frost_tracePhaseLeave.
+ =========================================================================== **/
+trace_phase_t Frost_tracePhaseEnter(trace_phase_t phase);
+
+/** ============================================================================
+  @fn       Frost_tracePhaseLeave
+  @package  Frost_TimeTrace
+
+  @brief    Restores the phase returned by Frost_tracePhaseEnter.
+
+  @param    previous  [in]:   Phase to restore.
+ =========================================================================== **/
+void Frost_tracePhaseLeave(trace_phase_t previous);
+
+/** ============================================================================
+  @fn       Frost_tracePhaseCurrent
+  @package  Frost_TimeTrace
+
+  @brief    Returns the current phase of the calling thread.
+
+  @return   Phase of the innermost open span or phase scope, or
+            TRACE_PHASE_OTHER outside of any.
+ =========================================================================== **/
+trace_phase_t Frost_tracePhaseCurrent(void);
+
+/** ============================================================================
+  @fn       Frost_traceBegin
+  @package  Frost_TimeTrace
+
+  @brief    Opens a span on the calling thread and makes its phase the
+            current one.
+
+  @param    span      [out]:  Span storage, usually a local variable.
+  @param    phase     [in]:   Phase the span is accounted to.
+  @param    detail    [in]:   File or function name shown in the trace, or
+                              NULL. Copied when the span ends.
+ =========================================================================== **/
+void Frost_traceBegin(trace_span_t *span, trace_phase_t phase, const char *detail);
+
+/** ============================================================================
+  @fn       Frost_traceEnd
+  @package  Frost_TimeTrace
+
+  @brief    Closes a span on the thread that opened it and restores the
+            previous current phase.
+
+  @details  Spans of the same phase nested on one thread are only counted
+            once in the report; the trace keeps all of them.
+
+  @param    span      [in]:   Span filled by Frost_traceBegin.
+ =========================================================================== **/
+void Frost_traceEnd(trace_span_t *span);
+
+/** ============================================================================
+  @fn       Frost_traceSuspend
+  @package  Frost_TimeTrace
+
+  @brief    Steps out of an open span: restores the previous current phase
+            and stops counting time until Frost_traceResume.
+
+  @details  Meant for code called back from inside a span, such as token
+            consumers called by the lexer, so that neither their time nor
+            their allocations are charged to the span phase. When tracing is
+            on, a suspend and resume pair costs four clock reads.
+
+  @param    span      [in]:   Span filled by Frost_traceBegin.
+ =========================================================================== **/
+void Frost_traceSuspend(trace_span_t *span);
+
+/** ============================================================================
+  @fn       Frost_traceResume
+  @package  Frost_TimeTrace
+
+  @brief    Steps back into a span left with Frost_traceSuspend.
+
+  @param    span      [in]:   Span given to Frost_traceSuspend.
+ =========================================================================== **/
+void Frost_traceResume(trace_span_t *span);
+
+/** ============================================================================
+  @fn       Frost_timeTraceReport
+  @package  Frost_TimeTrace
+
+  @brief    Prints wall and CPU time per phase, summed over every thread.
+
+  @param    stream    [in]:   Output stream, e.g. stderr.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EINVAL if stream is NULL.
+ =========================================================================== **/
+int Frost_timeTraceReport(FILE *stream);
+
+/** ============================================================================
+  @fn       Frost_timeTraceWrite
+  @package  Frost_TimeTrace
+
+  @brief    Writes every recorded span as Chrome trace-event JSON.
+
+  @param    path      [in]:   Output file.
+
+  @return   FUNCTION_SUCCESS on success.
+            -EINVAL if path is NULL.
+            -EIO if the file cannot be written.
+ =========================================================================== **/
+int Frost_timeTraceWrite(const char *path);
+
+/** ============================================================================
+  @fn       Frost_timeTraceFinish
+  @package  Frost_TimeTrace
+
+  @brief    Emits the outputs requested by the flags, then turns recording
+            off and releases every buffer.
+
+  @details  Prints the report to stderr with TIME_TRACE_REPORT and writes the
+            trace file with TIME_TRACE_EVENTS.
+
+  @return   FUNCTION_SUCCESS on success, or when recording was off.
+            -EIO if the trace file cannot be written.
+ =========================================================================== **/
+int Frost_timeTraceFinish(void);
+
+#endif /* TIME_TRACE_H_ */
+
+/*< end of header file >*/
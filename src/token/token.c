@@ -40,6 +40,7 @@
 
 /*< Implements >*/
 #include "../../inc/utils.h"
+#include "../allocator/allocator.h"
 #include "token.h"
 
 /* ========================================================================== *\
@@ -82,7 +83,7 @@ token_t *Frost_initToken(const char *lexeme, token_type_t type)
     }
     
     /* Memory Allocation for the Token */
-    token_out = (token_t *)calloc(1u, sizeof(token_t));
+    token_out = (token_t *)Frost_memCalloc(1u, sizeof(token_t), FROST_MEM_TOKEN);
     if (token_out == NULL)
     {
         LOG_ERROR("Memory allocation failed for token.");
@@ -90,13 +91,14 @@ token_t *Frost_initToken(const char *lexeme, token_type_t type)
     }
 
     /*< Token Initialization >*/
-    token_out->type = type;
+    token_out->type     = type;
+    token_out->length   = strlen(lexeme);
 
-    token_out->lexeme = strdup(lexeme);
+    token_out->lexeme = Frost_memStrdup(lexeme, FROST_MEM_TOKEN);
     if (token_out->lexeme == NULL)
     {
         LOG_ERROR("Memory allocation failed for lexeme.");
-        free(token_out);
+        Frost_memFree(token_out, sizeof(token_t), FROST_MEM_TOKEN);
         token_out = NULL;
         goto end_of_function;
     }
@@ -106,13 +108,73 @@ end_of_function:
     return token_out;
 }
 
+/** ===========================================================================
+  @fn       Frost_initTokenSpan
+  @package  Frost_Token
+
+  @brief    Allocates and initializes a new token from a slice of a buffer.
+
+  @details  Same as Frost_initToken, except that the lexeme is given as a
+            pointer and a length, so it can point straight into the source
+            being lexed without being NUL-terminated. The copy stored in the
+            token is NUL-terminated.
+
+  @param    lexeme    [in]: Pointer to the first character of the lexeme.
+  @param    length    [in]: Number of characters in the lexeme.
+  @param    type      [in]: The token type to be assigned.
+
+  @return   Pointer to a fully initialized `token_t` object on success.
+            NULL if the lexeme is NULL or if a memory allocation error occurs.
+ =========================================================================== **/
+token_t *Frost_initTokenSpan(const char *lexeme, size_t length, token_type_t type)
+{
+    /*< Variable Declarations >*/
+    token_t *token_out = NULL;
+
+    /*< Security Checks >*/
+    if (lexeme == NULL)
+    {
+        LOG_ERROR("Lexeme entry point is NULL.");
+        goto end_of_function;
+    }
+
+    /* Memory Allocation for the Token */
+    token_out = (token_t *)Frost_memCalloc(1u, sizeof(token_t), FROST_MEM_TOKEN);
+    if (token_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for token.");
+        goto end_of_function;
+    }
+
+    /*< Token Initialization >*/
+    token_out->type     = type;
+    token_out->length   = length;
+
+    token_out->lexeme = (char *)Frost_memAlloc(length + 1u, FROST_MEM_TOKEN);
+    if (token_out->lexeme == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for lexeme.");
+        Frost_memFree(token_out, sizeof(token_t), FROST_MEM_TOKEN);
+        token_out = NULL;
+        goto end_of_function;
+    }
+
+    memcpy(token_out->lexeme, lexeme, length);
+    token_out->lexeme[length] = '\0';
+
+    /*< Function Output >*/
+end_of_function:
+    return token_out;
+}
+
 /** ===========================================================================
   @fn       Frost_freeToken
   @package  Frost_Token
 
   @brief    Frees the memory associated with a token object.
 
-  @details  This function releases memory allocated for the token's lexeme and 
+  @details  This function releases memory allocated for the token's lexeme,
+            sized from the length recorded when the token was created, and
             then frees the token object itself. If the given token pointer is 
             NULL, it logs an error and returns an error code. On success, it 
             returns `FUNCTION_SUCCESS`.
@@ -130,11 +192,11 @@ int Frost_freeToken(token_t *token)
     /*< Start Function Algorithm >*/
     if (token != NULL)
     {
-        free(token->lexeme); 
-        free(token);
-
+        Frost_memFree(token->lexeme, token->length + 1u, FROST_MEM_TOKEN);
         token->lexeme   = NULL;
-        token           = NULL;
+        token->length   = 0u;
+
+        Frost_memFree(token, sizeof(token_t), FROST_MEM_TOKEN);
     }
     else
     {
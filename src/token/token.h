@@ -29,6 +29,13 @@
 #ifndef TOKEN_H_
 #define TOKEN_H_
 
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
 /* ========================================================================== *\
  *                                PUBLIC ENUMS                                *
 \* ========================================================================== */
@@ -138,6 +145,10 @@ typedef enum frostTokens
 
     /* <End of File> */
     TOKEN_EOF               = 57u,  /**< Represents the end of the source file */
+
+    /* <Shift Assignment Operators, appended so stored values stay valid> */
+    TOKEN_LEFT_SHIFT_ASSIGN  = 58u, /**< Represents the '<<=' operator */
+    TOKEN_RIGHT_SHIFT_ASSIGN = 59u, /**< Represents the '>>=' operator */
 } token_type_t;
 
 /* ========================================================================== *\
@@ -163,9 +174,31 @@ typedef enum frostTokens
 typedef struct __attribute__((packed)) tokenInstance
 {
     char            *lexeme;        /*< Pointer to the token’s lexeme string >*/
+    size_t          length;         /*< Characters in the lexeme, without the NUL >*/
     token_type_t    type;           /*< The token type, as defined by token_type_t >*/
 } token_t;
 
+/** ============================================================================
+  @struct   tokenView
+  @package  Frost_Token
+
+  @typedef  token_view_t
+
+  @brief    Compact, non-owning description of a token.
+
+  @details  A token view is filled by value by the lexer and never owns any
+            memory: its lexeme points straight into the lexer source and is
+            not NUL-terminated. It stays valid as long as that source does,
+            and needs no release.
+============================================================================ **/
+typedef struct tokenView
+{
+    const char      *lexeme;        /*< First character of the lexeme in the source >*/
+    size_t          offset;         /*< Offset of the lexeme in the source >*/
+    size_t          length;         /*< Number of characters in the lexeme >*/
+    token_type_t    type;           /*< The token type, as defined by token_type_t >*/
+} token_view_t;
+
 /* ========================================================================== *\
  *                       PUBLIC FUNCTIONS PROTOTYPES                          *
 \* ========================================================================== */
@@ -195,6 +228,26 @@ typedef struct __attribute__((packed)) tokenInstance
  =========================================================================== **/
 token_t *Frost_initToken(const char *lexeme, token_type_t type);
 
+/** ===========================================================================
+  @fn       Frost_initTokenSpan
+  @package  Frost_Token
+
+  @brief    Allocates and initializes a new token from a slice of a buffer.
+
+  @details  Same as Frost_initToken, except that the lexeme is given as a
+            pointer and a length, so it can point straight into the source
+            being lexed without being NUL-terminated. The copy stored in the
+            token is NUL-terminated.
+
+  @param    lexeme    [in]: Pointer to the first character of the lexeme.
+  @param    length    [in]: Number of characters in the lexeme.
+  @param    type      [in]: The token type to be assigned.
+
+  @return   Pointer to a fully initialized `token_t` object on success.
+            NULL if the lexeme is NULL or if a memory allocation error occurs.
+ =========================================================================== **/
+token_t *Frost_initTokenSpan(const char *lexeme, size_t length, token_type_t type);
+
 /** ===========================================================================
   @fn       Frost_freeToken
   @package  Frost_Token
@@ -211,7 +264,7 @@ token_t *Frost_initToken(const char *lexeme, token_type_t type);
   @return   FUNCTION_SUCCESS on successful deallocation.
             -ENOMEM if the token pointer is NULL.
  =========================================================================== **/
-int FrostCompiler_freeToken(token_t *token);
+int Frost_freeToken(token_t *token);
 
 #endif /* TOKEN_H_ */
 
@@ -0,0 +1,583 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_TokenQueue
+
+    @package    Frost_TokenQueue
+    @brief      This module provides a pipelined lexing mode, in which a
+                dedicated thread runs the lexer ahead of the parser and hands
+                tokens over through a bounded lock-free ring.
+
+    @file       token_queue.c
+    @headerfile token_queue.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The ring follows the classic Lamport SPSC layout. `tail` is
+                written only by the producer and `head` only by the consumer,
+                and each side keeps a private cached copy of the other side's
+                index on its own cache line. A side re-reads the shared index
+                only when its cached copy says the ring is full (producer) or
+                empty (consumer), and publishes its own index once per batch
+                of TOKEN_QUEUE_BATCH tokens.
+
+                A side that finds the ring full or empty yields for up to
+                TOKEN_QUEUE_SPIN_LIMIT rounds, then raises its `waiting` flag
+                and sleeps on a condition variable. After each publication,
+                the other side checks that flag and signals only if it is
+                set, so the lock is never taken while both sides keep up.
+
+    @note       - A NULL token pushed by the producer means the lexer failed,
+                  and terminates the stream just like TOKEN_EOF.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/*< Implements >*/
+#include "token_queue.h"
+#include "../allocator/allocator.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TOKEN_QUEUE_BATCH
+    @brief     Number of tokens lexed or consumed between two publications of
+               the shared ring indexes.
+============================================================================ **/
+#define TOKEN_QUEUE_BATCH           64u
+
+/** ============================================================================
+    @def       TOKEN_QUEUE_MIN_CAPACITY
+    @brief     Smallest ring accepted, so that at least two batches fit.
+============================================================================ **/
+#define TOKEN_QUEUE_MIN_CAPACITY    (2u * TOKEN_QUEUE_BATCH)
+
+/** ============================================================================
+    @def       TOKEN_QUEUE_SPIN_LIMIT
+    @brief     Yields tried on a full or empty ring before blocking.
+============================================================================ **/
+#define TOKEN_QUEUE_SPIN_LIMIT      64u
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostTokenQueue
+  @package  Frost_TokenQueue
+
+  @brief    Ring storage plus the producer and consumer sides, each on its
+            own cache line.
+============================================================================ **/
+struct frostTokenQueue
+{
+    token_t             **slots;        /*< Circular token storage >*/
+    size_t              mask;           /*< Capacity minus one >*/
+    lexer_t             *lexer;         /*< Lexer driven by the producer >*/
+    const frost_allocator_t *allocator; /*< Allocator of the creating thread >*/
+    pthread_t           producer;       /*< Thread running the lexer >*/
+    bool                started;        /*< Producer thread was created >*/
+
+    __attribute__((aligned(ARCH_CACHE_LINE_SIZE)))
+    atomic_size_t       tail;           /*< Published producer index >*/
+    atomic_bool         stop;           /*< Asks the producer to give up >*/
+
+    __attribute__((aligned(ARCH_CACHE_LINE_SIZE)))
+    atomic_size_t       head;           /*< Published consumer index >*/
+
+    __attribute__((aligned(ARCH_CACHE_LINE_SIZE)))
+    size_t              prod_tail;      /*< Producer private write index >*/
+    size_t              prod_head;      /*< Producer cached copy of head >*/
+
+    __attribute__((aligned(ARCH_CACHE_LINE_SIZE)))
+    size_t              cons_head;      /*< Consumer private read index >*/
+    size_t              cons_tail;      /*< Consumer cached copy of tail >*/
+    size_t              cons_unpub;     /*< Tokens read since last publication >*/
+    bool                finished;       /*< End of stream was returned >*/
+
+    __attribute__((aligned(ARCH_CACHE_LINE_SIZE)))
+    atomic_bool         prod_waiting;   /*< Producer sleeps on not_full >*/
+    atomic_bool         cons_waiting;   /*< Consumer sleeps on not_empty >*/
+    pthread_mutex_t     wait_lock;      /*< Guards both condition variables >*/
+    pthread_cond_t      not_full;       /*< Signalled when head moves >*/
+    pthread_cond_t      not_empty;      /*< Signalled when tail moves >*/
+};
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_tokenQueueWake
+  @package  Frost_TokenQueue
+
+  @brief    Wakes the other side after an index was published, if it sleeps.
+
+  @details  The fence orders the index store before the flag load; the
+            sleeper raises its flag before re-reading the index, so one of
+            the two always sees the other.
+
+  @param    queue     [in]:   Pointer to the token queue.
+  @param    waiting   [in]:   Flag of the other side.
+  @param    cond      [in]:   Condition variable the other side sleeps on.
+ =========================================================================== **/
+static void Frost_tokenQueueWake(token_queue_t *queue, atomic_bool *waiting, pthread_cond_t *cond)
+{
+    /*< Start Function Algorithm >*/
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (atomic_load_explicit(waiting, memory_order_relaxed))
+    {
+        pthread_mutex_lock(&queue->wait_lock);
+        pthread_cond_signal(cond);
+        pthread_mutex_unlock(&queue->wait_lock);
+    }
+}
+
+/** ============================================================================
+  @fn       Frost_tokenQueueWaitSpace
+  @package  Frost_TokenQueue
+
+  @brief    Waits until the ring has a free slot (producer only).
+
+  @param    queue     [in]:   Pointer to the token queue.
+
+  @return   true once a slot is free.
+            false if the consumer asked the producer to stop.
+ =========================================================================== **/
+static bool Frost_tokenQueueWaitSpace(token_queue_t *queue)
+{
+    /*< Variable Declarations >*/
+    size_t capacity = queue->mask + 1u;
+    size_t spin     = 0u;
+    bool stop       = false;
+
+    /*< Spin a Little >*/
+    for (spin = 0u; spin < TOKEN_QUEUE_SPIN_LIMIT; spin++)
+    {
+        if (atomic_load_explicit(&queue->stop, memory_order_relaxed))
+        {
+            return false;
+        }
+
+        sched_yield();
+
+        queue->prod_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if ((queue->prod_tail - queue->prod_head) < capacity)
+        {
+            return true;
+        }
+    }
+
+    /*< Then Sleep until the Consumer Frees Slots or Stops Us >*/
+    pthread_mutex_lock(&queue->wait_lock);
+    atomic_store_explicit(&queue->prod_waiting, true, memory_order_seq_cst);
+
+    for (;;)
+    {
+        queue->prod_head    = atomic_load_explicit(&queue->head, memory_order_seq_cst);
+        stop                = atomic_load_explicit(&queue->stop, memory_order_relaxed);
+
+        if ( (stop) || ((queue->prod_tail - queue->prod_head) < capacity) )
+        {
+            break;
+        }
+
+        pthread_cond_wait(&queue->not_full, &queue->wait_lock);
+    }
+
+    atomic_store_explicit(&queue->prod_waiting, false, memory_order_relaxed);
+    pthread_mutex_unlock(&queue->wait_lock);
+
+    /*< Function Output >*/
+    return !stop;
+}
+
+/** ============================================================================
+  @fn       Frost_tokenQueueWaitToken
+  @package  Frost_TokenQueue
+
+  @brief    Waits until the ring holds a token (consumer only).
+
+  @param    queue     [in]:   Pointer to the token queue.
+ =========================================================================== **/
+static void Frost_tokenQueueWaitToken(token_queue_t *queue)
+{
+    /*< Variable Declarations >*/
+    size_t spin = 0u;
+
+    /*< Spin a Little >*/
+    for (spin = 0u; spin < TOKEN_QUEUE_SPIN_LIMIT; spin++)
+    {
+        sched_yield();
+
+        queue->cons_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if (queue->cons_head != queue->cons_tail)
+        {
+            return;
+        }
+    }
+
+    /*< Then Sleep until the Producer Publishes; it always ends with EOF >*/
+    pthread_mutex_lock(&queue->wait_lock);
+    atomic_store_explicit(&queue->cons_waiting, true, memory_order_seq_cst);
+
+    for (;;)
+    {
+        queue->cons_tail = atomic_load_explicit(&queue->tail, memory_order_seq_cst);
+        if (queue->cons_head != queue->cons_tail)
+        {
+            break;
+        }
+
+        pthread_cond_wait(&queue->not_empty, &queue->wait_lock);
+    }
+
+    atomic_store_explicit(&queue->cons_waiting, false, memory_order_relaxed);
+    pthread_mutex_unlock(&queue->wait_lock);
+}
+
+/** ============================================================================
+  @fn       Frost_tokenQueuePublish
+  @package  Frost_TokenQueue
+
+  @brief    Copies a batch of tokens into the ring (producer only).
+
+  @details  Waits for free slots when the ring is full, writing as many tokens
+            as fit before each publication of `tail`.
+
+  @param    queue     [in]:   Pointer to the token queue.
+  @param    batch     [in]:   Tokens to be published.
+  @param    count     [in]:   Number of tokens in batch.
+
+  @return   Number of tokens actually published. It is lower than count only
+            when the consumer asked the producer to stop.
+ =========================================================================== **/
+static size_t Frost_tokenQueuePublish(token_queue_t *queue, token_t **batch, size_t count)
+{
+    /*< Variable Declarations >*/
+    size_t written  = 0u;
+    size_t capacity = queue->mask + 1u;
+
+    /*< Start Function Algorithm >*/
+    while (written < count)
+    {
+        if ((queue->prod_tail - queue->prod_head) == capacity)
+        {
+            queue->prod_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+            if ( ((queue->prod_tail - queue->prod_head) == capacity) &&
+                 (!Frost_tokenQueueWaitSpace(queue)) )
+            {
+                goto end_of_function;
+            }
+        }
+
+        while ( (written < count) && ((queue->prod_tail - queue->prod_head) < capacity) )
+        {
+            queue->slots[queue->prod_tail & queue->mask] = batch[written];
+            queue->prod_tail++;
+            written++;
+        }
+
+        atomic_store_explicit(&queue->tail, queue->prod_tail, memory_order_release);
+        Frost_tokenQueueWake(queue, &queue->cons_waiting, &queue->not_empty);
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return written;
+}
+
+/** ============================================================================
+  @fn       Frost_tokenQueueProducerMain
+  @package  Frost_TokenQueue
+
+  @brief    Main loop of the producer thread.
+
+  @param    arg       [in]:   Pointer to the token queue.
+
+  @return   Always NULL.
+ =========================================================================== **/
+static void *Frost_tokenQueueProducerMain(void *arg)
+{
+    /*< Variable Declarations >*/
+    token_queue_t *queue                = (token_queue_t *)arg;
+    token_t *batch[TOKEN_QUEUE_BATCH]   = { NULL };
+    size_t count                        = 0u;
+    size_t published                    = 0u;
+    bool done                           = false;
+
+    /*< Start Function Algorithm >*/
+    Frost_allocatorSet(queue->allocator);
+
+    while (!done)
+    {
+        for (count = 0u; (count < TOKEN_QUEUE_BATCH) && (!done); count++)
+        {
+            batch[count] = Frost_nextToken(queue->lexer);
+
+            if ( (batch[count] == NULL) || (batch[count]->type == TOKEN_EOF) )
+            {
+                done = true;
+            }
+        }
+
+        published = Frost_tokenQueuePublish(queue, batch, count);
+
+        /*< Consumer went away: drop what could not be handed over >*/
+        for (; published < count; published++)
+        {
+            if (batch[published] != NULL)
+            {
+                Frost_freeToken(batch[published]);
+            }
+
+            done = true;
+        }
+    }
+
+    /*< Function Output >*/
+    return NULL;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initTokenQueue
+  @package  Frost_TokenQueue
+
+  @brief    Creates a token ring and starts lexing into it on a new thread.
+
+  @details  The capacity is rounded up to a power of two. The producer thread
+            stops after pushing the TOKEN_EOF token, or a NULL token if the
+            lexer fails.
+
+  @param    lexer     [in]:   Lexer to be driven by the producer thread.
+  @param    capacity  [in]:   Maximum number of tokens buffered in the ring.
+
+  @return   Pointer to a newly created token queue on success.
+            NULL if the lexer is NULL, or allocation or thread creation fails.
+ =========================================================================== **/
+token_queue_t *Frost_initTokenQueue(lexer_t *lexer, size_t capacity)
+{
+    /*< Variable Declarations >*/
+    token_queue_t *queue_out    = NULL;
+    size_t rounded              = TOKEN_QUEUE_MIN_CAPACITY;
+
+    /*< Security Checks >*/
+    if (lexer == NULL)
+    {
+        LOG_ERROR("Lexer entry point is NULL.");
+        goto end_of_function;
+    }
+
+    while (rounded < capacity)
+    {
+        rounded <<= 1u;
+    }
+
+    /*< Allocate Memory >*/
+    queue_out = (token_queue_t *)Frost_memAlignedAlloc(ARCH_CACHE_LINE_SIZE,
+                    ALIGN_UP(sizeof(token_queue_t), ARCH_CACHE_LINE_SIZE), FROST_MEM_QUEUE);
+    if (queue_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for token queue.");
+        goto end_of_function;
+    }
+
+    memset(queue_out, 0, sizeof(token_queue_t));
+
+    queue_out->slots = (token_t **)Frost_memCalloc(rounded, sizeof(token_t *), FROST_MEM_QUEUE);
+    if (queue_out->slots == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for token queue slots.");
+        Frost_memFree(queue_out, ALIGN_UP(sizeof(token_queue_t), ARCH_CACHE_LINE_SIZE),
+                      FROST_MEM_QUEUE);
+        queue_out = NULL;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    queue_out->mask     = rounded - 1u;
+    queue_out->lexer    = lexer;
+    queue_out->allocator = Frost_allocatorGet();
+
+    atomic_init(&queue_out->tail, 0u);
+    atomic_init(&queue_out->head, 0u);
+    atomic_init(&queue_out->stop, false);
+    atomic_init(&queue_out->prod_waiting, false);
+    atomic_init(&queue_out->cons_waiting, false);
+    pthread_mutex_init(&queue_out->wait_lock, NULL);
+    pthread_cond_init(&queue_out->not_full, NULL);
+    pthread_cond_init(&queue_out->not_empty, NULL);
+
+    if (pthread_create(&queue_out->producer, NULL,
+                       Frost_tokenQueueProducerMain, queue_out) != 0)
+    {
+        LOG_ERROR("Failed to start token queue producer thread.");
+        Frost_freeTokenQueue(queue_out);
+        queue_out = NULL;
+        goto end_of_function;
+    }
+
+    queue_out->started = true;
+
+    /*< Function Output >*/
+end_of_function:
+    return queue_out;
+}
+
+/** ============================================================================
+  @fn       Frost_freeTokenQueue
+  @package  Frost_TokenQueue
+
+  @brief    Stops the producer thread and frees the queue.
+
+  @details  Can be called before the stream was fully consumed: the producer
+            is asked to stop, joined, and every token still buffered in the
+            ring is freed. The lexer itself is not freed.
+
+  @param    queue     [in]:   Pointer to the token queue to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the queue is NULL.
+ =========================================================================== **/
+int Frost_freeTokenQueue(token_queue_t *queue)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    size_t index    = 0u;
+    size_t tail     = 0u;
+
+    /*< Security Checks >*/
+    if (queue == NULL)
+    {
+        LOG_ERROR("Token queue entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (queue->started)
+    {
+        atomic_store_explicit(&queue->stop, true, memory_order_relaxed);
+
+        /*< The producer may be asleep on a full ring >*/
+        pthread_mutex_lock(&queue->wait_lock);
+        pthread_cond_signal(&queue->not_full);
+        pthread_mutex_unlock(&queue->wait_lock);
+
+        pthread_join(queue->producer, NULL);
+    }
+
+    tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    for (index = queue->cons_head; index != tail; index++)
+    {
+        if (queue->slots[index & queue->mask] != NULL)
+        {
+            Frost_freeToken(queue->slots[index & queue->mask]);
+        }
+    }
+
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_cond_destroy(&queue->not_full);
+    pthread_mutex_destroy(&queue->wait_lock);
+
+    Frost_memFree(queue->slots, (queue->mask + 1u) * sizeof(token_t *), FROST_MEM_QUEUE);
+    Frost_memFree(queue, ALIGN_UP(sizeof(token_queue_t), ARCH_CACHE_LINE_SIZE), FROST_MEM_QUEUE);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_tokenQueuePop
+  @package  Frost_TokenQueue
+
+  @brief    Retrieves the next token produced by the lexer thread.
+
+  @details  Waits until a token is available. Ownership of the returned token
+            is transferred to the caller, who must release it with
+            Frost_freeToken. Once the TOKEN_EOF token has been returned, any
+            further call returns NULL.
+
+  @param    queue     [in]:   Pointer to the token queue.
+
+  @return   Pointer to the next token on success.
+            NULL if the queue is NULL, the stream ended, or the lexer failed.
+ =========================================================================== **/
+token_t *Frost_tokenQueuePop(token_queue_t *queue)
+{
+    /*< Variable Declarations >*/
+    token_t *token_out = NULL;
+
+    /*< Security Checks >*/
+    if (queue == NULL)
+    {
+        LOG_ERROR("Token queue entry point is NULL.");
+        goto end_of_function;
+    }
+
+    if (queue->finished)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (queue->cons_head == queue->cons_tail)
+    {
+        /*< Hand the consumed slots back before waiting for new ones >*/
+        atomic_store_explicit(&queue->head, queue->cons_head, memory_order_release);
+        Frost_tokenQueueWake(queue, &queue->prod_waiting, &queue->not_full);
+        queue->cons_unpub = 0u;
+
+        queue->cons_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+        if (queue->cons_head == queue->cons_tail)
+        {
+            Frost_tokenQueueWaitToken(queue);
+        }
+    }
+
+    token_out = queue->slots[queue->cons_head & queue->mask];
+    queue->cons_head++;
+
+    if (++queue->cons_unpub == TOKEN_QUEUE_BATCH)
+    {
+        atomic_store_explicit(&queue->head, queue->cons_head, memory_order_release);
+        Frost_tokenQueueWake(queue, &queue->prod_waiting, &queue->not_full);
+        queue->cons_unpub = 0u;
+    }
+
+    if ( (token_out == NULL) || (token_out->type == TOKEN_EOF) )
+    {
+        queue->finished = true;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return token_out;
+}
+
+/*< end of file >*/
+/** @}*/
@@ -0,0 +1,118 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_TokenQueue
+
+    @brief      This module provides a pipelined lexing mode, in which a
+                dedicated thread runs the lexer ahead of the parser and hands
+                tokens over through a bounded lock-free ring.
+
+    @file       token_queue.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The token queue is a single-producer/single-consumer ring of
+                token pointers. The producer thread calls Frost_nextToken in a
+                loop and publishes tokens in batches, while the consumer (the
+                parser thread) pops them one at a time. Each side only touches
+                the shared indexes once per batch, so lexing and parsing of
+                the same file overlap with very little coherence traffic, and
+                memory stays bounded by the ring capacity instead of the whole
+                token stream. A side that outruns the other yields briefly,
+                then sleeps until the other side publishes, so a stalled
+                parser does not keep a core busy.
+
+    @note       - The lexer is driven by the producer thread from
+                  Frost_initTokenQueue until Frost_freeTokenQueue returns and
+                  must not be used by the caller in between.
+                - Exactly one thread may pop from a given queue.
+ =========================================================================== **/
+
+#ifndef TOKEN_QUEUE_H_
+#define TOKEN_QUEUE_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+
+/*< Implements >*/
+#include "../lexer/lexer.h"
+#include "../token/token.h"
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostTokenQueue
+  @package  Frost_TokenQueue
+
+  @typedef  token_queue_t
+
+  @brief    Opaque handle to a pipelined lexer and its token ring.
+============================================================================ **/
+typedef struct frostTokenQueue token_queue_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initTokenQueue
+  @package  Frost_TokenQueue
+
+  @brief    Creates a token ring and starts lexing into it on a new thread.
+
+  @details  The capacity is rounded up to a power of two. The producer thread
+            stops after pushing the TOKEN_EOF token, or a NULL token if the
+            lexer fails.
+
+  @param    lexer     [in]:   Lexer to be driven by the producer thread.
+  @param    capacity  [in]:   Maximum number of tokens buffered in the ring.
+
+  @return   Pointer to a newly created token queue on success.
+            NULL if the lexer is NULL, or allocation or thread creation fails.
+ =========================================================================== **/
+token_queue_t *Frost_initTokenQueue(lexer_t *lexer, size_t capacity);
+
+/** ============================================================================
+  @fn       Frost_freeTokenQueue
+  @package  Frost_TokenQueue
+
+  @brief    Stops the producer thread and frees the queue.
+
+  @details  Can be called before the stream was fully consumed: the producer
+            is asked to stop, joined, and every token still buffered in the
+            ring is freed. The lexer itself is not freed.
+
+  @param    queue     [in]:   Pointer to the token queue to be freed.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the queue is NULL.
+ =========================================================================== **/
+int Frost_freeTokenQueue(token_queue_t *queue);
+
+/** ============================================================================
+  @fn       Frost_tokenQueuePop
+  @package  Frost_TokenQueue
+
+  @brief    Retrieves the next token produced by the lexer thread.
+
+  @details  Waits until a token is available. Ownership of the returned token
+            is transferred to the caller, who must release it with
+            Frost_freeToken. Once the TOKEN_EOF token has been returned, any
+            further call returns NULL.
+
+  @param    queue     [in]:   Pointer to the token queue.
+
+  @return   Pointer to the next token on success.
+            NULL if the queue is NULL, the stream ended, or the lexer failed.
+ =========================================================================== **/
+token_t *Frost_tokenQueuePop(token_queue_t *queue);
+
+#endif /* TOKEN_QUEUE_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,699 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Module Frost_VirtualSource
+
+    @package    Frost_VirtualSource
+    @brief      This module presents a sequence of pieces of shared file
+                buffers as one translation unit, without copying any text.
+
+    @file       virtual_source.c
+    @headerfile virtual_source.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Pieces are kept in append order together with their start
+                position, a running sum of the lengths before them, so that
+                locating a position is a binary search and lexing a piece only
+                adds its start to the offsets the lexer reports.
+
+                One lexer object belongs to the virtual source and is
+                re-targeted from piece to piece; it is never reallocated.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+
+/*< Implements >*/
+#include "virtual_source.h"
+#include "../allocator/allocator.h"
+#include "../../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       VSOURCE_INITIAL_ENTRIES
+    @brief     Initial capacity of the file and piece tables.
+============================================================================ **/
+#define VSOURCE_INITIAL_ENTRIES     16u
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostVirtualFile
+  @package  Frost_VirtualSource
+
+  @typedef  vsource_file_t
+
+  @brief    Registered file.
+============================================================================ **/
+typedef struct frostVirtualFile
+{
+    const char          *name;          /*< File name, borrowed >*/
+    const char          *buffer;        /*< File contents, borrowed >*/
+    size_t              size;           /*< Bytes of buffer >*/
+} vsource_file_t;
+
+/** ============================================================================
+  @struct   frostVirtualPiece
+  @package  Frost_VirtualSource
+
+  @typedef  vsource_piece_t
+
+  @brief    Range of a file placed in the virtual source.
+============================================================================ **/
+typedef struct frostVirtualPiece
+{
+    size_t              start;          /*< Position of the first byte >*/
+    size_t              offset;         /*< Offset of the first byte in the file >*/
+    size_t              length;         /*< Bytes of the range >*/
+    uint32_t            file;           /*< File number >*/
+} vsource_piece_t;
+
+/** ============================================================================
+  @struct   frostVirtualSource
+  @package  Frost_VirtualSource
+
+  @brief    File table, piece table and lexing cursor.
+============================================================================ **/
+struct frostVirtualSource
+{
+    vsource_file_t      *files;         /*< Registered files >*/
+    size_t              file_count;     /*< Entries used in files >*/
+    size_t              file_capacity;  /*< Entries allocated in files >*/
+    vsource_piece_t     *pieces;        /*< Pieces in order >*/
+    size_t              piece_count;    /*< Entries used in pieces >*/
+    size_t              piece_capacity; /*< Entries allocated in pieces >*/
+    size_t              size;           /*< Total bytes of all pieces >*/
+    lexer_t             *lexer;         /*< Lexer re-targeted to each piece >*/
+    size_t              cursor;         /*< Piece Frost_virtualSourceNextToken is in >*/
+    bool                attached;       /*< The lexer is on pieces[cursor] >*/
+};
+
+/** ============================================================================
+  @struct   frostVirtualLex
+  @package  Frost_VirtualSource
+
+  @typedef  vsource_lex_t
+
+  @brief    Context of the token callback of Frost_virtualSourceLex.
+============================================================================ **/
+typedef struct frostVirtualLex
+{
+    lexer_callback_t    callback;       /*< User callback >*/
+    void                *ctx;           /*< User context >*/
+    size_t              start;          /*< Start position of the current piece >*/
+} vsource_lex_t;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_virtualSourceGrow
+  @package  Frost_VirtualSource
+
+  @brief    Makes room for one more entry in a table.
+
+  @param    table     [in]:   Address of the table pointer.
+  @param    capacity  [in]:   Address of the table capacity.
+  @param    count     [in]:   Entries used.
+  @param    entry     [in]:   Bytes per entry.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if allocation fails.
+ =========================================================================== **/
+static int Frost_virtualSourceGrow(void **table, size_t *capacity, size_t count, size_t entry)
+{
+    /*< Variable Declarations >*/
+    int ret         = FUNCTION_SUCESS;
+    void *grown     = NULL;
+    size_t target   = 0u;
+
+    /*< Security Checks >*/
+    if (count < *capacity)
+    {
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    target = MAX(*capacity * 2u, (size_t)VSOURCE_INITIAL_ENTRIES);
+
+    grown = Frost_memRealloc(*table, *capacity * entry, target * entry, FROST_MEM_VSOURCE);
+    if (grown == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for virtual source table.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    *table      = grown;
+    *capacity   = target;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourceFind
+  @package  Frost_VirtualSource
+
+  @brief    Finds the piece holding a position.
+
+  @param    source    [in]:   Pointer to a non-empty virtual source.
+  @param    position  [in]:   Position, at most the size of the source.
+
+  @return   Index of the piece; the last one for the end position.
+ =========================================================================== **/
+static size_t Frost_virtualSourceFind(const virtual_source_t *source, size_t position)
+{
+    /*< Variable Declarations >*/
+    size_t low  = 0u;
+    size_t high = source->piece_count - 1u;
+    size_t mid  = 0u;
+
+    /*< Start Function Algorithm >*/
+    while (low < high)
+    {
+        mid = low + ((high - low + 1u) / 2u);
+        if (source->pieces[mid].start <= position)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid - 1u;
+        }
+    }
+
+    /*< Function Output >*/
+    return low;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourceOnToken
+  @package  Frost_VirtualSource
+
+  @brief    Token callback of Frost_virtualSourceLex: shifts offsets to
+            virtual positions and holds back the TOKEN_EOF of each piece.
+
+  @return   The value returned by the user callback.
+ =========================================================================== **/
+static int Frost_virtualSourceOnToken(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    /*< Variable Declarations >*/
+    vsource_lex_t *lex  = (vsource_lex_t *)ctx;
+    int ret             = FUNCTION_SUCESS;
+
+    /*< Start Function Algorithm >*/
+    if (type != TOKEN_EOF)
+    {
+        ret = lex->callback(type, lex->start + offset, length, lex->ctx);
+    }
+
+    /*< Function Output >*/
+    return ret;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initVirtualSource
+  @package  Frost_VirtualSource
+
+  @brief    Creates an empty virtual source.
+
+  @return   Pointer to a new virtual source on success.
+            NULL if allocation fails.
+ =========================================================================== **/
+virtual_source_t *Frost_initVirtualSource(void)
+{
+    /*< Variable Declarations >*/
+    virtual_source_t *source_out = NULL;
+
+    /*< Allocate Memory >*/
+    source_out = (virtual_source_t *)Frost_memCalloc(1u, sizeof(virtual_source_t), FROST_MEM_VSOURCE);
+    if (source_out == NULL)
+    {
+        LOG_ERROR("Memory allocation failed for virtual source.");
+        goto end_of_function;
+    }
+
+    source_out->lexer = Frost_initLexerView("", 0u);
+    if (source_out->lexer == NULL)
+    {
+        Frost_memFree(source_out, sizeof(virtual_source_t), FROST_MEM_VSOURCE);
+        source_out = NULL;
+    }
+
+    /*< Function Output >*/
+end_of_function:
+    return source_out;
+}
+
+/** ============================================================================
+  @fn       Frost_freeVirtualSource
+  @package  Frost_VirtualSource
+
+  @brief    Releases a virtual source. File names and buffers are borrowed
+            and left untouched.
+
+  @param    source    [in]:   Pointer to the virtual source.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the source is NULL.
+ =========================================================================== **/
+int Frost_freeVirtualSource(virtual_source_t *source)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (source == NULL)
+    {
+        LOG_ERROR("Virtual source entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Free Memory >*/
+    (void)Frost_freeLexer(source->lexer);
+    Frost_memFree(source->files, source->file_capacity * sizeof(vsource_file_t), FROST_MEM_VSOURCE);
+    Frost_memFree(source->pieces, source->piece_capacity * sizeof(vsource_piece_t), FROST_MEM_VSOURCE);
+    Frost_memFree(source, sizeof(virtual_source_t), FROST_MEM_VSOURCE);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourceAddFile
+  @package  Frost_VirtualSource
+
+  @brief    Registers a file whose ranges pieces may refer to.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    name      [in]:   File name, borrowed.
+  @param    buffer    [in]:   File contents, borrowed.
+  @param    size      [in]:   Bytes of buffer.
+
+  @return   File number, starting at 0, on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            -ERANGE if the file table is full.
+ =========================================================================== **/
+int Frost_virtualSourceAddFile(virtual_source_t *source, const char *name, const char *buffer, size_t size)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if ( (source == NULL) || (name == NULL) || (buffer == NULL) )
+    {
+        LOG_ERROR("Virtual source entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if (source->file_count >= (size_t)INT_MAX)
+    {
+        ret = -ERANGE;
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    ret = Frost_virtualSourceGrow((void **)&source->files, &source->file_capacity,
+                                  source->file_count, sizeof(vsource_file_t));
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    source->files[source->file_count] = (vsource_file_t)
+    {
+        .name   = name,
+        .buffer = buffer,
+        .size   = size,
+    };
+
+    ret = (int)source->file_count;
+    source->file_count++;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourceAppend
+  @package  Frost_VirtualSource
+
+  @brief    Appends a range of a registered file.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    file      [in]:   File number.
+  @param    offset    [in]:   First byte of the range in the file.
+  @param    length    [in]:   Bytes of the range.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the source is NULL or allocation fails.
+            -ERANGE if the file or the range does not exist.
+ =========================================================================== **/
+int Frost_virtualSourceAppend(virtual_source_t *source, uint32_t file, size_t offset, size_t length)
+{
+    /*< Variable Declarations >*/
+    int ret                 = FUNCTION_SUCESS;
+    vsource_piece_t *last   = NULL;
+
+    /*< Security Checks >*/
+    if (source == NULL)
+    {
+        LOG_ERROR("Virtual source entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if ( ((size_t)file >= source->file_count) || (offset > source->files[file].size) ||
+         (length > (source->files[file].size - offset)) || (length > (SIZE_MAX - source->size)) )
+    {
+        LOG_ERROR("Virtual source piece is out of range.");
+        ret = -ERANGE;
+        goto end_of_function;
+    }
+
+    if (length == 0u)
+    {
+        goto end_of_function;
+    }
+
+    /*< Extend the Previous Piece when Contiguous >*/
+    last = (source->piece_count > 0u) ? &source->pieces[source->piece_count - 1u] : NULL;
+    if ( (last != NULL) && (last->file == file) && ((last->offset + last->length) == offset) )
+    {
+        last->length    += length;
+        source->size    += length;
+        goto end_of_function;
+    }
+
+    /*< Allocate Memory >*/
+    ret = Frost_virtualSourceGrow((void **)&source->pieces, &source->piece_capacity,
+                                  source->piece_count, sizeof(vsource_piece_t));
+    if (ret != FUNCTION_SUCESS)
+    {
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    source->pieces[source->piece_count] = (vsource_piece_t)
+    {
+        .start  = source->size,
+        .offset = offset,
+        .length = length,
+        .file   = file,
+    };
+
+    source->piece_count++;
+    source->size += length;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourceSize
+  @package  Frost_VirtualSource
+
+  @brief    Returns the total bytes of all pieces.
+
+  @param    source    [in]:   Pointer to the virtual source.
+
+  @return   Size of the virtual source, 0 if it is NULL.
+ =========================================================================== **/
+size_t Frost_virtualSourceSize(const virtual_source_t *source)
+{
+    return (source != NULL) ? source->size : 0u;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourceFileName
+  @package  Frost_VirtualSource
+
+  @brief    Returns the name a file was registered with.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    file      [in]:   File number.
+
+  @return   File name, or NULL if the file does not exist.
+ =========================================================================== **/
+const char *Frost_virtualSourceFileName(const virtual_source_t *source, uint32_t file)
+{
+    return ( (source != NULL) && ((size_t)file < source->file_count) ) ? source->files[file].name : NULL;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourceLocate
+  @package  Frost_VirtualSource
+
+  @brief    Maps a position to the file and offset it comes from.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    position  [in]:   Position in the virtual source.
+  @param    location  [out]:  File number and offset.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            -ERANGE if the position is past the end, or the source is empty.
+ =========================================================================== **/
+int Frost_virtualSourceLocate(const virtual_source_t *source, size_t position, source_location_t *location)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCESS;
+    const vsource_piece_t *piece    = NULL;
+
+    /*< Security Checks >*/
+    if ( (source == NULL) || (location == NULL) )
+    {
+        LOG_ERROR("Virtual source entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    if ( (source->piece_count == 0u) || (position > source->size) )
+    {
+        ret = -ERANGE;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    piece = &source->pieces[Frost_virtualSourceFind(source, position)];
+
+    location->file      = piece->file;
+    location->offset    = piece->offset + (position - piece->start);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourcePointer
+  @package  Frost_VirtualSource
+
+  @brief    Returns the address of the byte at a position.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    position  [in]:   Position in the virtual source.
+
+  @return   Pointer into the file buffer, or NULL if the position is past the
+            end.
+ =========================================================================== **/
+const char *Frost_virtualSourcePointer(const virtual_source_t *source, size_t position)
+{
+    /*< Variable Declarations >*/
+    const char *pointer_out         = NULL;
+    source_location_t location      = { 0u, 0u };
+
+    /*< Start Function Algorithm >*/
+    if (Frost_virtualSourceLocate(source, position, &location) == FUNCTION_SUCESS)
+    {
+        pointer_out = source->files[location.file].buffer + location.offset;
+    }
+
+    /*< Function Output >*/
+    return pointer_out;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourceRewind
+  @package  Frost_VirtualSource
+
+  @brief    Restarts Frost_virtualSourceNextToken at the first piece.
+
+  @param    source    [in]:   Pointer to the virtual source.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the source is NULL.
+ =========================================================================== **/
+int Frost_virtualSourceRewind(virtual_source_t *source)
+{
+    /*< Variable Declarations >*/
+    int ret = FUNCTION_SUCESS;
+
+    /*< Security Checks >*/
+    if (source == NULL)
+    {
+        LOG_ERROR("Virtual source entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    source->cursor      = 0u;
+    source->attached    = false;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourceNextToken
+  @package  Frost_VirtualSource
+
+  @brief    Retrieves the next token of the virtual source.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    token     [out]:  Caller-owned token view to fill.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+ =========================================================================== **/
+int Frost_virtualSourceNextToken(virtual_source_t *source, token_view_t *token)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCESS;
+    const vsource_piece_t *piece    = NULL;
+
+    /*< Security Checks >*/
+    if ( (source == NULL) || (token == NULL) )
+    {
+        LOG_ERROR("Virtual source entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    while (source->cursor < source->piece_count)
+    {
+        piece = &source->pieces[source->cursor];
+
+        if (!source->attached)
+        {
+            (void)Frost_lexerResetView(source->lexer, source->files[piece->file].buffer + piece->offset,
+                                       piece->length);
+            source->attached = true;
+        }
+
+        ret = Frost_nextTokenInto(source->lexer, token);
+        if ( (ret != FUNCTION_SUCESS) || (token->type != TOKEN_EOF) )
+        {
+            token->offset += piece->start;
+            goto end_of_function;
+        }
+
+        source->cursor++;
+        source->attached = false;
+    }
+
+    /*< A Single End of File, after the Last Piece >*/
+    token->lexeme   = (source->piece_count > 0u) ? Frost_virtualSourcePointer(source, source->size) : "";
+    token->offset   = source->size;
+    token->length   = 0u;
+    token->type     = TOKEN_EOF;
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Frost_virtualSourceLex
+  @package  Frost_VirtualSource
+
+  @brief    Streams every token of the virtual source to a callback.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    callback  [in]:   Function receiving each token.
+  @param    ctx       [in]:   User context passed to the callback.
+
+  @return   FUNCTION_SUCCESS once the end of the source was delivered.
+            -ENOMEM if a pointer argument is NULL.
+            The value returned by the callback, if it stopped early.
+ =========================================================================== **/
+int Frost_virtualSourceLex(virtual_source_t *source, lexer_callback_t callback, void *ctx)
+{
+    /*< Variable Declarations >*/
+    int ret                         = FUNCTION_SUCESS;
+    vsource_lex_t lex               = { 0 };
+    const vsource_piece_t *piece    = NULL;
+    size_t index                    = 0u;
+
+    /*< Security Checks >*/
+    if ( (source == NULL) || (callback == NULL) )
+    {
+        LOG_ERROR("Virtual source entry point is NULL.");
+        ret = -ENOMEM;
+        goto end_of_function;
+    }
+
+    /*< Start Function Algorithm >*/
+    lex.callback    = callback;
+    lex.ctx         = ctx;
+
+    /*< The Lexer Leaves the Piece the Pull Cursor was on >*/
+    source->attached = false;
+
+    for (index = 0u; index < source->piece_count; index++)
+    {
+        piece       = &source->pieces[index];
+        lex.start   = piece->start;
+
+        (void)Frost_lexerResetView(source->lexer, source->files[piece->file].buffer + piece->offset,
+                                   piece->length);
+
+        ret = Frost_lexStructural(source->lexer, Frost_virtualSourceOnToken, &lex);
+        if (ret != FUNCTION_SUCESS)
+        {
+            goto end_of_function;
+        }
+    }
+
+    ret = callback(TOKEN_EOF, source->size, 0u, ctx);
+
+    /*< Function Output >*/
+end_of_function:
+    return ret;
+}
+
+/*< end of file >*/
+/** @}*/
@@ -0,0 +1,260 @@
+/** ============================================================================
+    @addtogroup FrostCompiler
+    @package    Frost_VirtualSource
+
+    @brief      This module presents a sequence of pieces of shared file
+                buffers as one translation unit, without copying any text.
+
+    @file       virtual_source.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    A virtual source is a list of files (name and buffer, both
+                borrowed, typically mapped or held by the server file cache)
+                and a list of pieces, each a range of one of those files.
+                Pasting an included header is one more piece pointing at the
+                header buffer: no text is ever copied, however many
+                translation units include it.
+
+                Positions in a virtual source count bytes from the start of
+                its first piece, as if the pieces had been concatenated.
+                Tokens report such positions, and Frost_virtualSourceLocate
+                maps them back to (file, offset) with a binary search over the
+                pieces.
+
+                The lexer walks the pieces in order: it is re-targeted to each
+                piece with Frost_lexerResetView, so the scanning loops run
+                unchanged on plain contiguous memory, and only the end of a
+                piece costs anything.
+
+    @note       - Piece boundaries must fall between tokens, as they do when
+                  splicing at #include directives, which occupy whole lines.
+                  A token crossing a boundary is delivered as two tokens.
+                - A virtual source must not be used by two threads at once.
+ =========================================================================== **/
+
+#ifndef VIRTUAL_SOURCE_H_
+#define VIRTUAL_SOURCE_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../token/token.h"
+#include "../lexer/lexer.h"
+
+/* ========================================================================== *\
+ *                              PUBLIC STRUCTURES                             *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   frostSourceLocation
+  @package  Frost_VirtualSource
+
+  @typedef  source_location_t
+
+  @brief    Position of a byte in the file it comes from.
+============================================================================ **/
+typedef struct frostSourceLocation
+{
+    uint32_t            file;           /*< File number, see Frost_virtualSourceAddFile >*/
+    size_t              offset;         /*< Offset of the byte in that file >*/
+} source_location_t;
+
+/** ============================================================================
+  @struct   frostVirtualSource
+  @package  Frost_VirtualSource
+
+  @typedef  virtual_source_t
+
+  @brief    Opaque handle to a virtual source.
+============================================================================ **/
+typedef struct frostVirtualSource virtual_source_t;
+
+/* ========================================================================== *\
+ *                       PUBLIC FUNCTIONS PROTOTYPES                          *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Frost_initVirtualSource
+  @package  Frost_VirtualSource
+
+  @brief    Creates an empty virtual source.
+
+  @return   Pointer to a new virtual source on success.
+            NULL if allocation fails.
+ =========================================================================== **/
+virtual_source_t *Frost_initVirtualSource(void);
+
+/** ============================================================================
+  @fn       Frost_freeVirtualSource
+  @package  Frost_VirtualSource
+
+  @brief    Releases a virtual source. File names and buffers are borrowed
+            and left untouched.
+
+  @param    source    [in]:   Pointer to the virtual source.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the source is NULL.
+ =========================================================================== **/
+int Frost_freeVirtualSource(virtual_source_t *source);
+
+/** ============================================================================
+  @fn       Frost_virtualSourceAddFile
+  @package  Frost_VirtualSource
+
+  @brief    Registers a file whose ranges pieces may refer to.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    name      [in]:   File name, borrowed.
+  @param    buffer    [in]:   File contents, borrowed.
+  @param    size      [in]:   Bytes of buffer.
+
+  @return   File number, starting at 0, on success.
+            -ENOMEM if a pointer argument is NULL or allocation fails.
+            -ERANGE if the file table is full.
+ =========================================================================== **/
+int Frost_virtualSourceAddFile(virtual_source_t *source, const char *name, const char *buffer, size_t size);
+
+/** ============================================================================
+  @fn       Frost_virtualSourceAppend
+  @package  Frost_VirtualSource
+
+  @brief    Appends a range of a registered file.
+
+  @details  Empty ranges are ignored, and a range that continues the previous
+            piece in the same file extends it.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    file      [in]:   File number.
+  @param    offset    [in]:   First byte of the range in the file.
+  @param    length    [in]:   Bytes of the range.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the source is NULL or allocation fails.
+            -ERANGE if the file or the range does not exist.
+ =========================================================================== **/
+int Frost_virtualSourceAppend(virtual_source_t *source, uint32_t file, size_t offset, size_t length);
+
+/** ============================================================================
+  @fn       Frost_virtualSourceSize
+  @package  Frost_VirtualSource
+
+  @brief    Returns the total bytes of all pieces.
+
+  @param    source    [in]:   Pointer to the virtual source.
+
+  @return   Size of the virtual source, 0 if it is NULL.
+ =========================================================================== **/
+size_t Frost_virtualSourceSize(const virtual_source_t *source);
+
+/** ============================================================================
+  @fn       Frost_virtualSourceFileName
+  @package  Frost_VirtualSource
+
+  @brief    Returns the name a file was registered with.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    file      [in]:   File number.
+
+  @return   File name, or NULL if the file does not exist.
+ =========================================================================== **/
+const char *Frost_virtualSourceFileName(const virtual_source_t *source, uint32_t file);
+
+/** ============================================================================
+  @fn       Frost_virtualSourceLocate
+  @package  Frost_VirtualSource
+
+  @brief    Maps a position to the file and offset it comes from.
+
+  @details  The end position (the size of the source) maps to the end of the
+            last piece, which is where TOKEN_EOF is reported.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    position  [in]:   Position in the virtual source.
+  @param    location  [out]:  File number and offset.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+            -ERANGE if the position is past the end, or the source is empty.
+ =========================================================================== **/
+int Frost_virtualSourceLocate(const virtual_source_t *source, size_t position, source_location_t *location);
+
+/** ============================================================================
+  @fn       Frost_virtualSourcePointer
+  @package  Frost_VirtualSource
+
+  @brief    Returns the address of the byte at a position.
+
+  @details  Since tokens never cross pieces, the lexeme of a token delivered
+            by Frost_virtualSourceLex is the `length` bytes at this address.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    position  [in]:   Position in the virtual source.
+
+  @return   Pointer into the file buffer, or NULL if the position is past the
+            end.
+ =========================================================================== **/
+const char *Frost_virtualSourcePointer(const virtual_source_t *source, size_t position);
+
+/** ============================================================================
+  @fn       Frost_virtualSourceRewind
+  @package  Frost_VirtualSource
+
+  @brief    Restarts Frost_virtualSourceNextToken at the first piece.
+
+  @param    source    [in]:   Pointer to the virtual source.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if the source is NULL.
+ =========================================================================== **/
+int Frost_virtualSourceRewind(virtual_source_t *source);
+
+/** ============================================================================
+  @fn       Frost_virtualSourceNextToken
+  @package  Frost_VirtualSource
+
+  @brief    Retrieves the next token of the virtual source.
+
+  @details  Same contract as Frost_nextTokenInto: the lexeme points into the
+            file buffer the token comes from, and the offset is a position in
+            the virtual source. TOKEN_EOF is delivered once, after the last
+            piece, at the end position.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    token     [out]:  Caller-owned token view to fill.
+
+  @return   FUNCTION_SUCCESS on success.
+            -ENOMEM if a pointer argument is NULL.
+ =========================================================================== **/
+int Frost_virtualSourceNextToken(virtual_source_t *source, token_view_t *token);
+
+/** ============================================================================
+  @fn       Frost_virtualSourceLex
+  @package  Frost_VirtualSource
+
+  @brief    Streams every token of the virtual source to a callback.
+
+  @details  Runs Frost_lexStructural over each piece in turn. Offsets given
+            to the callback are positions in the virtual source, and a single
+            TOKEN_EOF is delivered at the end position.
+
+  @param    source    [in]:   Pointer to the virtual source.
+  @param    callback  [in]:   Function receiving each token.
+  @param    ctx       [in]:   User context passed to the callback.
+
+  @return   FUNCTION_SUCCESS once the end of the source was delivered.
+            -ENOMEM if a pointer argument is NULL.
+            The value returned by the callback, if it stopped early.
+ =========================================================================== **/
+int Frost_virtualSourceLex(virtual_source_t *source, lexer_callback_t callback, void *ctx);
+
+#endif /* VIRTUAL_SOURCE_H_ */
+
+/*< end of header file >*/
@@ -0,0 +1,333 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks allocation, commit, exhaustion and reset of an arena.
+
+    @file       arena_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Every block handed out is written over its whole size, so a
+                granule left uncommitted faults the test instead of passing
+                silently. The arena is then exhausted exactly, reset and
+                refilled, and finally installed as the current allocator to
+                grow and shrink blocks through Frost_memRealloc.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*< Implements >*/
+#include "../src/arena/arena.h"
+#include "../src/allocator/allocator.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TEST_GRANULES
+    @brief     Commit granules reserved by the test arena.
+============================================================================ **/
+#define TEST_GRANULES               3u
+
+/** ============================================================================
+    @def       TEST_RESERVE
+    @brief     Bytes reserved by the test arena.
+============================================================================ **/
+#define TEST_RESERVE                (TEST_GRANULES * (size_t)ARENA_COMMIT_GRANULE)
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_used
+  @package  Frost_Tests
+
+  @brief    Returns the bytes handed out by an arena.
+ =========================================================================== **/
+static size_t Test_used(const arena_t *arena)
+{
+    /*< Variable Declarations >*/
+    size_t used = 0u;
+
+    /*< Start Function Algorithm >*/
+    (void)Frost_arenaUsage(arena, &used, NULL);
+
+    /*< Function Output >*/
+    return used;
+}
+
+/** ============================================================================
+  @fn       Test_committed
+  @package  Frost_Tests
+
+  @brief    Returns the bytes committed by an arena.
+ =========================================================================== **/
+static size_t Test_committed(const arena_t *arena)
+{
+    /*< Variable Declarations >*/
+    size_t committed = 0u;
+
+    /*< Start Function Algorithm >*/
+    (void)Frost_arenaUsage(arena, NULL, &committed);
+
+    /*< Function Output >*/
+    return committed;
+}
+
+/** ============================================================================
+  @fn       Test_granules
+  @package  Frost_Tests
+
+  @brief    Allocates across commit granules, with assorted alignments.
+
+  @return   First block of the arena.
+ =========================================================================== **/
+static char *Test_granules(arena_t *arena)
+{
+    /*< Variable Declarations >*/
+    static const size_t alignments[] = { 1u, 8u, 16u, 64u, 4096u, ARENA_HUGE_PAGE_SIZE };
+    char *first     = NULL;
+    char *block     = NULL;
+    char *end       = NULL;
+    size_t index    = 0u;
+
+    /*< Start Function Algorithm >*/
+    TEST_CHECK(Test_committed(arena) == 0u);
+
+    /*< Stop 64 bytes short of the first granule, then cross it >*/
+    first = (char *)Frost_arenaAlloc(arena, ARENA_COMMIT_GRANULE - 64u, 0u);
+    TEST_CHECK(first != NULL);
+    if (first == NULL)
+    {
+        return NULL;
+    }
+
+    memset(first, 0xA5, ARENA_COMMIT_GRANULE - 64u);
+    TEST_CHECK(Test_committed(arena) == ARENA_COMMIT_GRANULE);
+
+    block = (char *)Frost_arenaAlloc(arena, 256u, 0u);
+    TEST_CHECK(block == first + ARENA_COMMIT_GRANULE - 64u);
+    if (block != NULL)
+    {
+        memset(block, 0x5A, 256u);
+    }
+
+    TEST_CHECK(Test_committed(arena) == 2u * ARENA_COMMIT_GRANULE);
+    TEST_CHECK(Test_used(arena) == ARENA_COMMIT_GRANULE + 192u);
+
+    /*< Alignment: odd sizes in between, blocks never overlap >*/
+    end = block + 256u;
+    for (index = 0u; index < (sizeof(alignments) / sizeof(alignments[0])); index++)
+    {
+        block = (char *)Frost_arenaAlloc(arena, 3u + index, alignments[index]);
+        TEST_CHECK(block != NULL);
+        if (block == NULL)
+        {
+            break;
+        }
+
+        TEST_CHECK(((uintptr_t)block % MAX(alignments[index], (size_t)ARCH_ALIGNMENT)) == 0u);
+        TEST_CHECK(block >= end);
+
+        memset(block, (int)index, 3u + index);
+        end = block + 3u + index;
+    }
+
+    TEST_CHECK(((uintptr_t)first % ARENA_HUGE_PAGE_SIZE) == 0u);
+    TEST_CHECK( ((unsigned char)first[0] == 0xA5u) &&
+                ((unsigned char)first[ARENA_COMMIT_GRANULE - 65u] == 0xA5u) );
+
+    /*< Function Output >*/
+    return first;
+}
+
+/** ============================================================================
+  @fn       Test_exhaust
+  @package  Frost_Tests
+
+  @brief    Fills the arena exactly, then checks that it refuses more.
+ =========================================================================== **/
+static void Test_exhaust(arena_t *arena)
+{
+    /*< Variable Declarations >*/
+    size_t used     = ALIGN_UP(Test_used(arena), (size_t)ARCH_ALIGNMENT);
+    char *block     = NULL;
+
+    /*< Start Function Algorithm >*/
+    TEST_CHECK(Frost_arenaAlloc(arena, TEST_RESERVE, 0u) == NULL);
+    TEST_CHECK(Frost_arenaAlloc(arena, SIZE_MAX, 0u) == NULL);
+    TEST_CHECK(Frost_arenaAlloc(arena, 1u, SIZE_MAX / 2u + 1u) == NULL);
+
+    block = (char *)Frost_arenaAlloc(arena, TEST_RESERVE - used, 0u);
+    TEST_CHECK(block != NULL);
+    if (block != NULL)
+    {
+        memset(block, 0x3C, TEST_RESERVE - used);
+    }
+
+    TEST_CHECK(Test_used(arena) == TEST_RESERVE);
+    TEST_CHECK(Test_committed(arena) == TEST_RESERVE);
+
+    TEST_CHECK(Frost_arenaAlloc(arena, 1u, 0u) == NULL);
+    TEST_CHECK(Test_used(arena) == TEST_RESERVE);
+}
+
+/** ============================================================================
+  @fn       Test_reset
+  @package  Frost_Tests
+
+  @brief    Checks that a reset hands the same memory out again.
+ =========================================================================== **/
+static void Test_reset(arena_t *arena, char *first)
+{
+    /*< Variable Declarations >*/
+    char *block = NULL;
+
+    /*< Start Function Algorithm >*/
+    TEST_CHECK(Frost_arenaReset(arena) == FUNCTION_SUCESS);
+    TEST_CHECK(Test_used(arena) == 0u);
+    TEST_CHECK(Test_committed(arena) == TEST_RESERVE);
+
+    block = (char *)Frost_arenaAlloc(arena, 128u, 0u);
+    TEST_CHECK(block == first);
+
+    block = (char *)Frost_arenaAlloc(arena, TEST_RESERVE - 128u, 0u);
+    TEST_CHECK(block == first + 128u);
+    if (block != NULL)
+    {
+        memset(block, 0xC3, TEST_RESERVE - 128u);
+    }
+
+    TEST_CHECK(Frost_arenaAlloc(arena, 1u, 0u) == NULL);
+    TEST_CHECK(Frost_arenaReset(arena) == FUNCTION_SUCESS);
+}
+
+/** ============================================================================
+  @fn       Test_allocator
+  @package  Frost_Tests
+
+  @brief    Grows and shrinks blocks with the arena as the current allocator.
+ =========================================================================== **/
+static void Test_allocator(arena_t *arena)
+{
+    /*< Variable Declarations >*/
+    frost_allocator_t allocator         = Frost_arenaAllocator(arena);
+    const frost_allocator_t *previous   = NULL;
+    unsigned char *block                = NULL;
+    unsigned char *grown                = NULL;
+    unsigned char *aligned              = NULL;
+    size_t index                        = 0u;
+    bool intact                         = true;
+
+    /*< Start Function Algorithm >*/
+    previous = Frost_allocatorSet(&allocator);
+
+    block = (unsigned char *)Frost_memAlloc(100u, FROST_MEM_GENERAL);
+    TEST_CHECK(block != NULL);
+    if (block != NULL)
+    {
+        for (index = 0u; index < 100u; index++)
+        {
+            block[index] = (unsigned char)(index * 7u);
+        }
+
+        /*< Another block in between, so growing must move >*/
+        aligned = (unsigned char *)Frost_memAlignedAlloc(256u, 32u, FROST_MEM_QUEUE);
+        TEST_CHECK( (aligned != NULL) && (((uintptr_t)aligned % 256u) == 0u) );
+
+        grown = (unsigned char *)Frost_memRealloc(block, 100u, 5000u, FROST_MEM_GENERAL);
+        TEST_CHECK( (grown != NULL) && (grown != block) );
+        if (grown != NULL)
+        {
+            for (index = 0u; index < 100u; index++)
+            {
+                intact = intact && (grown[index] == (unsigned char)(index * 7u));
+            }
+
+            memset(grown + 100u, 0xEE, 4900u);
+            TEST_CHECK(intact);
+
+            /*< Shrinking keeps the block >*/
+            TEST_CHECK(Frost_memRealloc(grown, 5000u, 10u, FROST_MEM_GENERAL) == grown);
+
+            /*< Unknown size: refused, as allocator.h documents >*/
+            TEST_CHECK(Frost_memRealloc(grown, 0u, 8000u, FROST_MEM_GENERAL) == NULL);
+            TEST_CHECK(grown[99] == (unsigned char)(99u * 7u));
+        }
+
+        Frost_memFree(block, 100u, FROST_MEM_GENERAL);
+        Frost_memFree(grown, 5000u, FROST_MEM_GENERAL);
+        Frost_memFree(aligned, 32u, FROST_MEM_QUEUE);
+    }
+
+    /*< From NULL it allocates >*/
+    block = (unsigned char *)Frost_memRealloc(NULL, 0u, 64u, FROST_MEM_GENERAL);
+    TEST_CHECK( (block != NULL) && (((uintptr_t)block % ARCH_ALIGNMENT) == 0u) );
+
+    (void)Frost_allocatorSet(previous);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    arena_t *arena  = NULL;
+    char *first     = NULL;
+
+    /*< Security Checks >*/
+    TEST_CHECK(Frost_initArena(0u, 0u) == NULL);
+    TEST_CHECK(Frost_arenaAlloc(NULL, 16u, 0u) == NULL);
+    TEST_CHECK(Frost_arenaReset(NULL) != FUNCTION_SUCESS);
+
+    /*< Allocate Memory >*/
+    arena = Frost_initArena(TEST_RESERVE - 1u, 0u);
+    TEST_CHECK(arena != NULL);
+    if (arena == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    /*< Start Function Algorithm >*/
+    first = Test_granules(arena);
+    if (first != NULL)
+    {
+        Test_exhaust(arena);
+        Test_reset(arena, first);
+    }
+
+    Test_allocator(arena);
+
+    /*< Free Memory >*/
+    TEST_CHECK(Frost_freeArena(arena) == FUNCTION_SUCESS);
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "arena_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("arena_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
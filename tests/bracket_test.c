@@ -0,0 +1,376 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks the bracket-match index against a scalar reference.
+
+    @file       bracket_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Frost_initBracketIndex skips whole blocks of 16 tokens that
+                its SIMD prefilter finds free of delimiters. The reference
+                below matches the same way token by token, with no prefilter,
+                so any block the prefilter wrongly skips shows up as a
+                difference. Fixed cases put nested, mismatched and unbalanced
+                delimiters on both sides of block boundaries; random cases
+                mix delimiters with the token types just outside their range.
+
+                The default build covers the SSE2 prefilter on x86-64; build
+                with CFLAGS="-O2 -mavx2" to cover the AVX2 one.
+
+                Usage: bracket_test [seed] [cases]
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include "../src/bracket/bracket.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       BRACKET_TEST_MAX
+    @brief     Longest token stream of a case.
+============================================================================ **/
+#define BRACKET_TEST_MAX            256u
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static token_type_t bracket_types[BRACKET_TEST_MAX];
+static size_t bracket_expected[BRACKET_TEST_MAX];
+static size_t bracket_stack[BRACKET_TEST_MAX];
+
+/*< Non-delimiters the random cases favour: both neighbours of the range >*/
+static const token_type_t bracket_fillers[] =
+{
+    TOKEN_ID, TOKEN_LEFT_PAREN - 1, TOKEN_RIGHT_BRACKET + 1, TOKEN_EOF,
+};
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Bracket_random
+  @package  Frost_Tests
+
+  @brief    xorshift64* generator, reproducible across platforms.
+ =========================================================================== **/
+static uint64_t Bracket_random(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+/** ============================================================================
+  @fn       Bracket_reference
+  @package  Frost_Tests
+
+  @brief    Matches delimiters one token at a time.
+
+  @details  An opening delimiter is pushed; a closing one pops the top of the
+            stack only if it is its own opener, and is left unmatched
+            otherwise.
+ =========================================================================== **/
+static void Bracket_reference(const token_type_t *types, size_t count, size_t *match)
+{
+    /*< Variable Declarations >*/
+    size_t depth    = 0u;
+    size_t position = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (position = 0u; position < count; position++)
+    {
+        match[position] = BRACKET_NO_MATCH;
+
+        switch (types[position])
+        {
+            case TOKEN_LEFT_PAREN:
+            case TOKEN_LEFT_BRACE:
+            case TOKEN_LEFT_BRACKET:
+                bracket_stack[depth++] = position;
+                break;
+
+            case TOKEN_RIGHT_PAREN:
+            case TOKEN_RIGHT_BRACE:
+            case TOKEN_RIGHT_BRACKET:
+                if ( (depth > 0u) && (types[bracket_stack[depth - 1u]] == types[position] - 1) )
+                {
+                    depth--;
+                    match[bracket_stack[depth]] = position;
+                    match[position]             = bracket_stack[depth];
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+/** ============================================================================
+  @fn       Bracket_check
+  @package  Frost_Tests
+
+  @brief    Builds the index of a stream and compares it with the reference.
+
+  @details  Also checks Frost_bracketSkipBody at every position: it must
+            return the range of each matched opening delimiter and reject
+            everything else, closing delimiters included.
+
+  @return   true if the index agrees with the reference.
+ =========================================================================== **/
+static bool Bracket_check(const char *label, size_t number, const token_type_t *types, size_t count)
+{
+    /*< Variable Declarations >*/
+    bracket_index_t *index  = NULL;
+    lazy_body_t body        = { 0u, 0u };
+    size_t position         = 0u;
+    bool opener             = false;
+    bool same               = true;
+    int ret                 = FUNCTION_SUCESS;
+
+    /*< Allocate Memory >*/
+    index = Frost_initBracketIndex(types, count);
+    if (index == NULL)
+    {
+        fprintf(stderr, "%s %zu: no index\n", label, number);
+        return false;
+    }
+
+    /*< Start Function Algorithm >*/
+    Bracket_reference(types, count, bracket_expected);
+
+    for (position = 0u; (position < count) && same; position++)
+    {
+        if (Frost_bracketMatch(index, position) != bracket_expected[position])
+        {
+            fprintf(stderr, "%s %zu: token %zu of %zu (type %d) matched %zu, expected %zu\n",
+                    label, number, position, count, (int)types[position],
+                    Frost_bracketMatch(index, position), bracket_expected[position]);
+            same = false;
+        }
+
+        opener  = (bracket_expected[position] != BRACKET_NO_MATCH) && (bracket_expected[position] > position);
+        ret     = Frost_bracketSkipBody(index, position, &body);
+
+        if ( (opener && ( (ret != FUNCTION_SUCESS) || (body.open != position) ||
+                          (body.close != bracket_expected[position]) )) ||
+             (!opener && (ret != -EINVAL)) )
+        {
+            fprintf(stderr, "%s %zu: skipping from token %zu returned %d\n", label, number, position, ret);
+            same = false;
+        }
+    }
+
+    if ( same && ( (Frost_bracketMatch(index, count) != BRACKET_NO_MATCH) ||
+                   (Frost_bracketSkipBody(index, count, &body) != -EINVAL) ) )
+    {
+        fprintf(stderr, "%s %zu: position %zu past the end is not rejected\n", label, number, count);
+        same = false;
+    }
+
+    /*< Free Memory >*/
+    (void)Frost_freeBracketIndex(index);
+
+    /*< Function Output >*/
+    return same;
+}
+
+/** ============================================================================
+  @fn       Bracket_fill
+  @package  Frost_Tests
+
+  @brief    Fills a stream with TOKEN_ID, then places delimiters.
+
+  @param    count     [in]:   Tokens in the stream.
+  @param    places    [in]:   Pairs of (position, type), ended by SIZE_MAX.
+ =========================================================================== **/
+static void Bracket_fill(size_t count, const size_t *places)
+{
+    /*< Variable Declarations >*/
+    size_t position = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (position = 0u; position < count; position++)
+    {
+        bracket_types[position] = TOKEN_ID;
+    }
+
+    for (; places[0] != SIZE_MAX; places += 2)
+    {
+        bracket_types[places[0]] = (token_type_t)places[1];
+    }
+}
+
+/** ============================================================================
+  @fn       Bracket_fixed
+  @package  Frost_Tests
+
+  @brief    Delimiters on both sides of block boundaries, with known matches.
+ =========================================================================== **/
+static void Bracket_fixed(void)
+{
+    /*< Variable Declarations >*/
+    bracket_index_t *index  = NULL;
+    lazy_body_t body        = { 0u, 0u };
+
+    /*< Nested: the pairs straddle the boundaries at 16 and 32 >*/
+    static const size_t nested[] =
+    {
+        15u, TOKEN_LEFT_PAREN,  16u, TOKEN_LEFT_BRACE,  31u, TOKEN_LEFT_BRACKET,
+        32u, TOKEN_RIGHT_BRACKET, 33u, TOKEN_RIGHT_BRACE, 47u, TOKEN_RIGHT_PAREN, SIZE_MAX,
+    };
+
+    /*< Mismatched: the ']' in the middle block is left unmatched >*/
+    static const size_t mismatched[] =
+    {
+        15u, TOKEN_LEFT_PAREN, 24u, TOKEN_RIGHT_BRACKET, 48u, TOKEN_RIGHT_PAREN, SIZE_MAX,
+    };
+
+    /*< Unbalanced: a stray closer first, an opener never closed >*/
+    static const size_t unbalanced[] =
+    {
+        0u, TOKEN_RIGHT_BRACE, 15u, TOKEN_LEFT_BRACE, 16u, TOKEN_LEFT_BRACE, 63u, TOKEN_RIGHT_BRACE, SIZE_MAX,
+    };
+
+    /*< Delimiters only in the partial block at the end >*/
+    static const size_t tail[] =
+    {
+        32u, TOKEN_LEFT_BRACKET, 34u, TOKEN_RIGHT_BRACKET, SIZE_MAX,
+    };
+
+    Bracket_fill(48u, nested);
+    TEST_CHECK(Bracket_check("nested", 0u, bracket_types, 48u));
+
+    index = Frost_initBracketIndex(bracket_types, 48u);
+    TEST_CHECK(index != NULL);
+    if (index != NULL)
+    {
+        TEST_CHECK(Frost_bracketMatch(index, 15u) == 47u);
+        TEST_CHECK(Frost_bracketMatch(index, 16u) == 33u);
+        TEST_CHECK(Frost_bracketMatch(index, 32u) == 31u);
+
+        TEST_CHECK( (Frost_bracketSkipBody(index, 16u, &body) == FUNCTION_SUCESS) &&
+                    (body.open == 16u) && (body.close == 33u) );
+        TEST_CHECK(Frost_bracketSkipBody(index, 33u, &body) == -EINVAL);
+        TEST_CHECK(Frost_bracketSkipBody(index, 47u, &body) == -EINVAL);
+        TEST_CHECK(Frost_bracketSkipBody(index, 0u, &body) == -EINVAL);
+        TEST_CHECK(Frost_bracketSkipBody(index, 16u, NULL) == -ENOMEM);
+
+        (void)Frost_freeBracketIndex(index);
+    }
+
+    Bracket_fill(64u, mismatched);
+    TEST_CHECK(Bracket_check("mismatched", 0u, bracket_types, 64u));
+    TEST_CHECK(bracket_expected[15] == 48u);
+    TEST_CHECK(bracket_expected[24] == BRACKET_NO_MATCH);
+
+    Bracket_fill(64u, unbalanced);
+    TEST_CHECK(Bracket_check("unbalanced", 0u, bracket_types, 64u));
+    TEST_CHECK( (bracket_expected[0] == BRACKET_NO_MATCH) && (bracket_expected[15] == BRACKET_NO_MATCH) );
+    TEST_CHECK(bracket_expected[16] == 63u);
+
+    Bracket_fill(35u, tail);
+    TEST_CHECK(Bracket_check("tail", 0u, bracket_types, 35u));
+    TEST_CHECK(bracket_expected[32] == 34u);
+
+    TEST_CHECK(Bracket_check("empty", 0u, bracket_types, 0u));
+}
+
+/** ============================================================================
+  @fn       Bracket_generate
+  @package  Frost_Tests
+
+  @brief    Fills a random stream with a random density of delimiters.
+
+  @return   Tokens in the stream.
+ =========================================================================== **/
+static size_t Bracket_generate(uint64_t *state)
+{
+    /*< Variable Declarations >*/
+    static const unsigned densities[] = { 0u, 2u, 16u, 64u, 256u };
+    size_t count        = (size_t)(Bracket_random(state) % (BRACKET_TEST_MAX + 1u));
+    unsigned density    = densities[Bracket_random(state) % (sizeof(densities) / sizeof(densities[0]))];
+    size_t position     = 0u;
+    uint64_t draw       = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (position = 0u; position < count; position++)
+    {
+        draw = Bracket_random(state);
+
+        if ((draw % 256u) < density)
+        {
+            bracket_types[position] = (token_type_t)(TOKEN_LEFT_PAREN + (int)((draw >> 8) % 6u));
+        }
+        else if (((draw >> 8) % 4u) == 0u)
+        {
+            bracket_types[position] = (token_type_t)((draw >> 16) % (TOKEN_EOF + 1u));
+        }
+        else
+        {
+            bracket_types[position] = bracket_fillers[(draw >> 16) % (sizeof(bracket_fillers) / sizeof(bracket_fillers[0]))];
+        }
+    }
+
+    /*< Function Output >*/
+    return count;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(int argc, char **argv)
+{
+    /*< Variable Declarations >*/
+    uint64_t seed       = (argc > 1) ? (uint64_t)strtoull(argv[1], NULL, 10) : 1u;
+    size_t cases        = (argc > 2) ? (size_t)strtoul(argv[2], NULL, 10) : 5000u;
+    uint64_t state      = (seed * UINT64_C(0x9E3779B97F4A7C15)) | 1u;
+    size_t index        = 0u;
+    size_t count        = 0u;
+
+    /*< Fixed cases >*/
+    Bracket_fixed();
+
+    /*< Random cases >*/
+    for (index = 0u; (index < cases) && (test_failures < 5); index++)
+    {
+        count = Bracket_generate(&state);
+        TEST_CHECK(Bracket_check("seed case", index, bracket_types, count));
+    }
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "bracket_test: %d check(s) failed (seed %llu)\n",
+                test_failures, (unsigned long long)seed);
+        return EXIT_FAILURE;
+    }
+
+    printf("bracket_test: ok (%zu cases, seed %llu)\n", cases, (unsigned long long)seed);
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
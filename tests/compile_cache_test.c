@@ -0,0 +1,316 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks the keys and the entries of the compile cache.
+
+    @file       compile_cache_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Fingerprints must ignore whitespace and comments but not
+                tokens, and keys must follow the flags and the dependencies.
+                Entries are stored in a temporary directory, read back, then
+                damaged on disk: a truncated entry or one with a foreign magic
+                must be a miss, not an error and not a hit.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Feature Macros >*/
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE     /*< mkdtemp() >*/
+#endif
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*< Implements >*/
+#include "../src/compile_cache/compile_cache.h"
+#include "../src/allocator/allocator.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const char test_unit[] =
+    "int add(int a, int b)\n"
+    "{\n"
+    "    return a + b; /* sum */\n"
+    "}\n";
+
+/*< Same tokens: other layout, other comments >*/
+static const char test_reformatted[] =
+    "int add( int a,int b ) { // adds\n"
+    "\treturn a+b;\n"
+    "/* no comment */ }";
+
+/*< One token changed >*/
+static const char test_edited[] =
+    "int add(int a, int b)\n"
+    "{\n"
+    "    return a - b; /* sum */\n"
+    "}\n";
+
+static const char test_object[] = "\x7f" "ELF pretend object file contents";
+
+static char test_directory[] = "/tmp/frost-cache-XXXXXX";
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_equal
+  @package  Frost_Tests
+
+  @brief    Compares two keys.
+ =========================================================================== **/
+static bool Test_equal(cache_key_t left, cache_key_t right)
+{
+    return (left.lo == right.lo) && (left.hi == right.hi);
+}
+
+/** ============================================================================
+  @fn       Test_fingerprint
+  @package  Frost_Tests
+
+  @brief    Fingerprints a NUL-terminated test source.
+ =========================================================================== **/
+static cache_key_t Test_fingerprint(const char *source)
+{
+    /*< Variable Declarations >*/
+    cache_key_t key = { 0u, 0u };
+
+    /*< Start Function Algorithm >*/
+    TEST_CHECK(Frost_cacheFingerprint(source, strlen(source), &key) == FUNCTION_SUCESS);
+
+    /*< Function Output >*/
+    return key;
+}
+
+/** ============================================================================
+  @fn       Test_entryPath
+  @package  Frost_Tests
+
+  @brief    Builds the path of the entry of a key, as the cache lays it out.
+
+  @param    key       [in]:   Cache key.
+  @param    subdir    [in]:   Build the path of its fan-out directory only.
+  @param    path      [out]:  Buffer of PATH_MAX bytes.
+ =========================================================================== **/
+static void Test_entryPath(cache_key_t key, bool subdir, char *path)
+{
+    /*< Variable Declarations >*/
+    char hex[CACHE_KEY_HEX_SIZE] = { 0 };
+
+    /*< Start Function Algorithm >*/
+    Frost_cacheKeyHex(key, hex);
+
+    if (subdir)
+    {
+        snprintf(path, PATH_MAX, "%s/%.2s", test_directory, hex);
+    }
+    else
+    {
+        snprintf(path, PATH_MAX, "%s/%.2s/%s", test_directory, hex, &hex[2]);
+    }
+}
+
+/** ============================================================================
+  @fn       Test_lookup
+  @package  Frost_Tests
+
+  @brief    Looks a key up and checks the object when it hits.
+
+  @return   Value returned by Frost_compileCacheLookup.
+ =========================================================================== **/
+static int Test_lookup(compile_cache_t *cache, cache_key_t key)
+{
+    /*< Variable Declarations >*/
+    void *data  = NULL;
+    size_t size = 0u;
+    int ret     = FUNCTION_SUCESS;
+
+    /*< Start Function Algorithm >*/
+    ret = Frost_compileCacheLookup(cache, key, &data, &size);
+    if (ret == FUNCTION_SUCESS)
+    {
+        TEST_CHECK( (size == sizeof(test_object)) && (memcmp(data, test_object, size) == 0) );
+        Frost_memFree(data, size, FROST_MEM_CACHE);
+    }
+
+    /*< Function Output >*/
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Test_keys
+  @package  Frost_Tests
+
+  @brief    Checks fingerprints and keys.
+ =========================================================================== **/
+static void Test_keys(void)
+{
+    /*< Variable Declarations >*/
+    cache_key_t unit        = Test_fingerprint(test_unit);
+    cache_key_t deps[2]     = { { 0u, 0u }, { 0u, 0u } };
+    cache_key_t base        = { 0u, 0u };
+    cache_key_t other       = { 0u, 0u };
+
+    /*< Fingerprints >*/
+    TEST_CHECK(Test_equal(unit, Test_fingerprint(test_reformatted)));
+    TEST_CHECK(!Test_equal(unit, Test_fingerprint(test_edited)));
+    TEST_CHECK(!Test_equal(Test_fingerprint("a b"), Test_fingerprint("ab")));
+
+    /*< Keys >*/
+    deps[0] = Test_fingerprint("int first;");
+    deps[1] = Test_fingerprint("int second;");
+
+    TEST_CHECK(Frost_cacheKey(unit, "-O2", deps, 2u, &base) == FUNCTION_SUCESS);
+
+    TEST_CHECK(Frost_cacheKey(unit, "-O2", deps, 2u, &other) == FUNCTION_SUCESS);
+    TEST_CHECK(Test_equal(base, other));
+
+    TEST_CHECK(Frost_cacheKey(unit, "-O3", deps, 2u, &other) == FUNCTION_SUCESS);
+    TEST_CHECK(!Test_equal(base, other));
+
+    TEST_CHECK(Frost_cacheKey(unit, NULL, deps, 2u, &other) == FUNCTION_SUCESS);
+    TEST_CHECK(!Test_equal(base, other));
+
+    TEST_CHECK(Frost_cacheKey(unit, "-O2", deps, 1u, &other) == FUNCTION_SUCESS);
+    TEST_CHECK(!Test_equal(base, other));
+
+    deps[1] = Test_fingerprint("int second = 2;");
+    TEST_CHECK(Frost_cacheKey(unit, "-O2", deps, 2u, &other) == FUNCTION_SUCESS);
+    TEST_CHECK(!Test_equal(base, other));
+
+    TEST_CHECK(Frost_cacheKey(unit, "-O2", NULL, 1u, &other) == -ENOMEM);
+}
+
+/** ============================================================================
+  @fn       Test_entries
+  @package  Frost_Tests
+
+  @brief    Stores, reads back and damages entries.
+ =========================================================================== **/
+static void Test_entries(void)
+{
+    /*< Variable Declarations >*/
+    compile_cache_t *cache  = NULL;
+    cache_key_t keys[3]     = { { 0u, 0u }, { 0u, 0u }, { 0u, 0u } };
+    char path[PATH_MAX]     = { 0 };
+    int fd                  = -1;
+    size_t index            = 0u;
+
+    /*< Allocate Memory >*/
+    cache = Frost_initCompileCache(test_directory);
+    TEST_CHECK(cache != NULL);
+    if (cache == NULL)
+    {
+        return;
+    }
+
+    /*< Store then Lookup >*/
+    (void)Frost_cacheKey(Test_fingerprint(test_unit), "-O2", NULL, 0u, &keys[0]);
+    (void)Frost_cacheKey(Test_fingerprint(test_unit), "-O3", NULL, 0u, &keys[1]);
+    (void)Frost_cacheKey(Test_fingerprint(test_edited), "-O2", NULL, 0u, &keys[2]);
+
+    TEST_CHECK(Test_lookup(cache, keys[0]) == -ENOENT);
+
+    for (index = 0u; index < 3u; index++)
+    {
+        TEST_CHECK(Frost_compileCacheStore(cache, keys[index], test_object, sizeof(test_object)) == FUNCTION_SUCESS);
+        TEST_CHECK(Test_lookup(cache, keys[index]) == FUNCTION_SUCESS);
+    }
+
+    /*< A reformatted unit hits the entry of the original >*/
+    (void)Frost_cacheKey(Test_fingerprint(test_reformatted), "-O2", NULL, 0u, &keys[0]);
+    TEST_CHECK(Test_lookup(cache, keys[0]) == FUNCTION_SUCESS);
+
+    /*< Truncated: object cut short, then header cut short >*/
+    Test_entryPath(keys[0], false, path);
+    TEST_CHECK(truncate(path, 40) == 0);
+    TEST_CHECK(Test_lookup(cache, keys[0]) == -ENOENT);
+
+    TEST_CHECK(truncate(path, 8) == 0);
+    TEST_CHECK(Test_lookup(cache, keys[0]) == -ENOENT);
+
+    /*< Foreign magic >*/
+    Test_entryPath(keys[1], false, path);
+    fd = open(path, O_WRONLY);
+    TEST_CHECK(fd >= 0);
+    if (fd >= 0)
+    {
+        TEST_CHECK(write(fd, "ELF!", 4u) == 4);
+        close(fd);
+    }
+
+    TEST_CHECK(Test_lookup(cache, keys[1]) == -ENOENT);
+
+    /*< An untouched entry still hits, and a store repairs a damaged one >*/
+    TEST_CHECK(Test_lookup(cache, keys[2]) == FUNCTION_SUCESS);
+
+    TEST_CHECK(Frost_compileCacheStore(cache, keys[1], test_object, sizeof(test_object)) == FUNCTION_SUCESS);
+    TEST_CHECK(Test_lookup(cache, keys[1]) == FUNCTION_SUCESS);
+
+    /*< Free Memory >*/
+    for (index = 0u; index < 3u; index++)
+    {
+        Test_entryPath(keys[index], false, path);
+        (void)unlink(path);
+        Test_entryPath(keys[index], true, path);
+        (void)rmdir(path);
+    }
+
+    Frost_freeCompileCache(cache);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Security Checks >*/
+    if (mkdtemp(test_directory) == NULL)
+    {
+        fprintf(stderr, "compile_cache_test: cannot create a directory\n");
+        return EXIT_FAILURE;
+    }
+
+    /*< Start Function Algorithm >*/
+    Test_keys();
+    Test_entries();
+
+    /*< Free Memory >*/
+    if (rmdir(test_directory) != 0)
+    {
+        fprintf(stderr, "compile_cache_test: %s left behind\n", test_directory);
+    }
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "compile_cache_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("compile_cache_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
@@ -0,0 +1,128 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks that the flight recorder dumps the last events of
+                threads that already exited.
+
+    @file       flight_recorder_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    A worker thread records a file switch and a few tokens, then
+                exits, which releases its ring. The dump, written to a
+                temporary file, must still show that ring, marked as exited,
+                next to the ring of the dumping thread.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/*< Implements >*/
+#include "../src/flight_recorder/flight_recorder.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TEST_DUMP_SIZE
+    @brief     Bytes of the dump read back.
+============================================================================ **/
+#define TEST_DUMP_SIZE              (64u * 1024u)
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static char test_dump[TEST_DUMP_SIZE + 1u];
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_worker
+  @package  Frost_Tests
+
+  @brief    Records a file switch and three tokens, then exits.
+ =========================================================================== **/
+static void *Test_worker(void *arg)
+{
+    /*< Variable Declarations >*/
+    uint64_t offset = 0u;
+
+    /*< Start Function Algorithm >*/
+    UNUSED(arg);
+
+    Frost_flightRecordFile("worker.c");
+    for (offset = 0u; offset < 3u; offset++)
+    {
+        Frost_flightRecord(FLIGHT_EVENT_TOKEN, 7u, 1000u + offset);
+    }
+
+    /*< Function Output >*/
+    return NULL;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    pthread_t worker    = { 0 };
+    FILE *file          = NULL;
+    size_t length       = 0u;
+    const char *ring    = NULL;
+
+    /*< Start Function Algorithm >*/
+    Frost_flightRecordFile("main.c");
+
+    TEST_CHECK(pthread_create(&worker, NULL, Test_worker, NULL) == 0);
+    TEST_CHECK(pthread_join(worker, NULL) == 0);
+
+    file = tmpfile();
+    if (file == NULL)
+    {
+        fprintf(stderr, "flight_recorder_test: cannot create a file\n");
+        return EXIT_FAILURE;
+    }
+
+    TEST_CHECK(Frost_flightRecorderDump(fileno(file)) == FUNCTION_SUCESS);
+
+    rewind(file);
+    length = fread(test_dump, 1u, TEST_DUMP_SIZE, file);
+    test_dump[length] = '\0';
+    fclose(file);
+
+    ring = strstr(test_dump, "(exited), file \"worker.c\", 4 events");
+    TEST_CHECK(ring != NULL);
+    TEST_CHECK( (ring != NULL) && (strstr(ring, "token type 7 at offset 1002") != NULL) );
+    TEST_CHECK(strstr(test_dump, "(this thread), file \"main.c\"") != NULL);
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "flight_recorder_test: %d check(s) failed\n%s", test_failures, test_dump);
+        return EXIT_FAILURE;
+    }
+
+    printf("flight_recorder_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
@@ -0,0 +1,135 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Round-trips a header image and checks that failed opens leave
+                the trace phase alone.
+
+    @file       header_image_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Feature Macros >*/
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE     /*< mkdtemp() >*/
+#endif
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*< Implements >*/
+#include "../src/header_image/header_image.h"
+#include "../src/time_trace/time_trace.h"
+#include "../src/lexer/lexer.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const char test_header[] =
+    "#ifndef FROST_TEST_H\n"
+    "#define FROST_TEST_H\n"
+    "typedef struct point { int x; int y; } point_t; /* a point */\n"
+    "int point_norm(const point_t *point);\n"
+    "#endif\n";
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    char directory[]        = "/tmp/frost-image-XXXXXX";
+    char path[64]           = { 0 };
+    header_image_t *image   = NULL;
+    lexer_t *lexer          = NULL;
+    token_view_t expected   = { 0 };
+    token_view_t stored     = { 0 };
+    const char *source      = NULL;
+    size_t size             = 0u;
+    size_t count            = 0u;
+    size_t index            = 0u;
+    trace_phase_t phase     = TRACE_PHASE_OTHER;
+
+    /*< Security Checks >*/
+    if (mkdtemp(directory) == NULL)
+    {
+        fprintf(stderr, "header_image_test: cannot create a directory\n");
+        return EXIT_FAILURE;
+    }
+
+    snprintf(path, sizeof(path), "%s/test.himg", directory);
+
+    /*< Failed Opens Keep the Current Phase >*/
+    phase = Frost_tracePhaseEnter(TRACE_PHASE_PARSE);
+
+    TEST_CHECK(Frost_headerImageOpen(NULL) == NULL);
+    TEST_CHECK(Frost_tracePhaseCurrent() == TRACE_PHASE_PARSE);
+
+    TEST_CHECK(Frost_headerImageOpen(path) == NULL);
+    TEST_CHECK(Frost_tracePhaseCurrent() == TRACE_PHASE_PARSE);
+
+    Frost_tracePhaseLeave(phase);
+
+    /*< Build, Map and Compare with a Fresh Lexer: the image drops comments >*/
+    TEST_CHECK(Frost_headerImageBuild(test_header, sizeof(test_header) - 1u, path) == FUNCTION_SUCESS);
+
+    image = Frost_headerImageOpen(path);
+    TEST_CHECK(image != NULL);
+
+    if (image != NULL)
+    {
+        source = Frost_headerImageSource(image, &size);
+        TEST_CHECK( (size == sizeof(test_header) - 1u) && (memcmp(source, test_header, size) == 0) );
+
+        (void)Frost_headerImageTokens(image, &count);
+        lexer = Frost_initLexerView(test_header, sizeof(test_header) - 1u);
+
+        for (index = 0u; (lexer != NULL) && (index < count); index++)
+        {
+            do
+            {
+                (void)Frost_nextTokenInto(lexer, &expected);
+            } while (expected.type == TOKEN_COMMENT);
+
+            TEST_CHECK(Frost_headerImageToken(image, index, &stored) == FUNCTION_SUCESS);
+            TEST_CHECK( (stored.type == expected.type) && (stored.offset == expected.offset) &&
+                        (stored.length == expected.length) );
+        }
+
+        TEST_CHECK(Frost_headerImageIntern(image, "point_t", 7u) ==
+                   Frost_headerImageIntern(image, "point_t", 7u));
+
+        (void)Frost_freeLexer(lexer);
+        TEST_CHECK(Frost_headerImageClose(image) == FUNCTION_SUCESS);
+    }
+
+    /*< Free Memory >*/
+    unlink(path);
+    rmdir(directory);
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "header_image_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("header_image_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
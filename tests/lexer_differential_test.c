@@ -0,0 +1,341 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Differential fuzz test: Frost_lexStructural must produce
+                exactly the tokens of Frost_lexWithCallback.
+
+    @file       lexer_differential_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Sources are generated from a seeded PRNG, either by gluing
+                C-like fragments (so identifiers, numbers, literals and
+                comments straddle the 64-byte blocks of the structural
+                engine) or as raw bytes. Each source is lexed by both engines,
+                from the start and from a cursor left a few tokens in, and
+                the (type, offset, length) streams are compared.
+
+                Usage: lexer_differential_test [seed] [cases]
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*< Implements >*/
+#include "../src/lexer/lexer.h"
+#include "../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       DIFF_MAX_SOURCE
+    @brief     Largest generated source, in bytes.
+============================================================================ **/
+#define DIFF_MAX_SOURCE             1024u
+
+/** ============================================================================
+    @def       DIFF_MAX_TOKENS
+    @brief     Room for the tokens of one source (at most one per byte, + EOF).
+============================================================================ **/
+#define DIFF_MAX_TOKENS             (DIFF_MAX_SOURCE + 1u)
+
+/** ============================================================================
+    @def       DIFF_FRAGMENTS
+    @brief     Number of source fragments.
+============================================================================ **/
+#define DIFF_FRAGMENTS              (sizeof(diff_fragments) / sizeof(diff_fragments[0]))
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   diffToken
+  @package  Frost_Tests
+
+  @typedef  diff_token_t
+
+  @brief    One token as seen by a callback.
+============================================================================ **/
+typedef struct diffToken
+{
+    token_type_t        type;           /*< Token type >*/
+    size_t              offset;         /*< Offset in the source >*/
+    size_t              length;         /*< Length of the lexeme >*/
+} diff_token_t;
+
+/** ============================================================================
+  @struct   diffStream
+  @package  Frost_Tests
+
+  @typedef  diff_stream_t
+
+  @brief    Tokens collected from one engine.
+============================================================================ **/
+typedef struct diffStream
+{
+    diff_token_t        tokens[DIFF_MAX_TOKENS];    /*< Tokens in order >*/
+    size_t              count;                      /*< Entries used >*/
+} diff_stream_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const char *const diff_fragments[] =
+{
+    "a", "_b", "x1", "identifier_long_enough_to_cross", "0", "42", "0x1F", "3.25", "1.", ".5",
+    "1e10", "2.5f", "+", "-", "*", "/", "%", "=", "==", "!=", "<", "<=", "<<", "<<=", ">>=",
+    "&&", "||", "&", "|", "^", "~", "!", "?", ":", "::", "->", "++", "--", ".", "...", ",",
+    ";", "(", ")", "[", "]", "{", "}", " ", "  ", "\t", "\n", "\r\n", "// line comment\n",
+    "/* block */", "/* multi\nline */", "/*", "\"string\"", "\"esc \\\" q\"", "\"open",
+    "'c'", "'\\n'", "'", "@", "$", "`", "#", "\\",
+};
+
+static diff_stream_t diff_reference;
+static diff_stream_t diff_structural;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Diff_random
+  @package  Frost_Tests
+
+  @brief    xorshift64* generator, reproducible across platforms.
+ =========================================================================== **/
+static uint64_t Diff_random(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+    return *state * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+/** ============================================================================
+  @fn       Diff_generate
+  @package  Frost_Tests
+
+  @brief    Fills a buffer with a random source.
+
+  @return   Number of bytes written.
+ =========================================================================== **/
+static size_t Diff_generate(uint64_t *state, char *source)
+{
+    /*< Variable Declarations >*/
+    size_t target       = (size_t)(Diff_random(state) % DIFF_MAX_SOURCE);
+    size_t size         = 0u;
+    size_t length       = 0u;
+    const char *piece   = NULL;
+
+    /*< Raw bytes, one case in eight >*/
+    if ((Diff_random(state) % 8u) == 0u)
+    {
+        for (size = 0u; size < target; size++)
+        {
+            source[size] = (char)(Diff_random(state) & 0x7Fu);
+        }
+
+        return size;
+    }
+
+    /*< Glued fragments >*/
+    while (size < target)
+    {
+        piece   = diff_fragments[Diff_random(state) % DIFF_FRAGMENTS];
+        length  = strlen(piece);
+
+        if ((size + length) > DIFF_MAX_SOURCE)
+        {
+            break;
+        }
+
+        memcpy(source + size, piece, length);
+        size += length;
+    }
+
+    /*< Function Output >*/
+    return size;
+}
+
+/** ============================================================================
+  @fn       Diff_collect
+  @package  Frost_Tests
+
+  @brief    Callback appending each token to a stream.
+ =========================================================================== **/
+static int Diff_collect(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    /*< Variable Declarations >*/
+    diff_stream_t *stream = (diff_stream_t *)ctx;
+
+    /*< Security Checks >*/
+    if (stream->count == DIFF_MAX_TOKENS)
+    {
+        return -1;
+    }
+
+    /*< Start Function Algorithm >*/
+    stream->tokens[stream->count].type      = type;
+    stream->tokens[stream->count].offset    = offset;
+    stream->tokens[stream->count].length    = length;
+    stream->count++;
+
+    /*< Function Output >*/
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Diff_lex
+  @package  Frost_Tests
+
+  @brief    Lexes a source with one engine, after skipping some tokens.
+
+  @return   Value returned by the engine.
+ =========================================================================== **/
+static int Diff_lex(const char *source, size_t size, size_t skip, bool structural, diff_stream_t *stream)
+{
+    /*< Variable Declarations >*/
+    lexer_t *lexer      = NULL;
+    token_view_t token  = { 0 };
+    size_t index        = 0u;
+    int ret             = FUNCTION_SUCESS;
+
+    /*< Start Function Algorithm >*/
+    stream->count = 0u;
+
+    lexer = Frost_initLexerView(source, size);
+    if (lexer == NULL)
+    {
+        return -1;
+    }
+
+    for (index = 0u; (index < skip) && (token.type != TOKEN_EOF); index++)
+    {
+        (void)Frost_nextTokenInto(lexer, &token);
+    }
+
+    ret = structural ? Frost_lexStructural(lexer, Diff_collect, stream)
+                     : Frost_lexWithCallback(lexer, Diff_collect, stream);
+
+    (void)Frost_freeLexer(lexer);
+
+    /*< Function Output >*/
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Diff_diverges
+  @package  Frost_Tests
+
+  @brief    Finds the first token where the two streams differ.
+
+  @return   Index of that token, or the common count if none differs.
+ =========================================================================== **/
+static size_t Diff_diverges(void)
+{
+    /*< Variable Declarations >*/
+    const diff_token_t *left    = diff_reference.tokens;
+    const diff_token_t *right   = diff_structural.tokens;
+    size_t token                = 0u;
+
+    /*< Start Function Algorithm >*/
+    while ( (token < diff_reference.count) && (token < diff_structural.count) &&
+            (left[token].type == right[token].type) && (left[token].offset == right[token].offset) &&
+            (left[token].length == right[token].length) )
+    {
+        token++;
+    }
+
+    /*< Function Output >*/
+    return token;
+}
+
+/** ============================================================================
+  @fn       Diff_report
+  @package  Frost_Tests
+
+  @brief    Prints a failing source and the first diverging token.
+ =========================================================================== **/
+static void Diff_report(uint64_t seed, size_t index, const char *source, size_t size, size_t skip)
+{
+    /*< Variable Declarations >*/
+    size_t token = Diff_diverges();
+    size_t byte  = 0u;
+
+    /*< Start Function Algorithm >*/
+    fprintf(stderr, "seed %llu case %zu skip %zu: token %zu differs (%zu vs %zu tokens)\n  source: \"",
+            (unsigned long long)seed, index, skip, token, diff_reference.count, diff_structural.count);
+
+    for (byte = 0u; byte < size; byte++)
+    {
+        fprintf(stderr, ((unsigned char)source[byte] < 0x20u) ? "\\x%02x" : "%c", (unsigned char)source[byte]);
+    }
+
+    fprintf(stderr, "\"\n");
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(int argc, char **argv)
+{
+    /*< Variable Declarations >*/
+    static char source[DIFF_MAX_SOURCE];
+    uint64_t seed       = (argc > 1) ? (uint64_t)strtoull(argv[1], NULL, 10) : 1u;
+    size_t cases        = (argc > 2) ? (size_t)strtoul(argv[2], NULL, 10) : 20000u;
+    uint64_t state      = (seed * UINT64_C(0x9E3779B97F4A7C15)) | 1u;
+    size_t index        = 0u;
+    size_t size         = 0u;
+    size_t skip         = 0u;
+    size_t failures     = 0u;
+    int reference_ret   = 0;
+    int structural_ret  = 0;
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < cases; index++)
+    {
+        size = Diff_generate(&state, source);
+        skip = ((index % 2u) == 0u) ? 0u : (size_t)(Diff_random(&state) % 8u);
+
+        reference_ret   = Diff_lex(source, size, skip, false, &diff_reference);
+        structural_ret  = Diff_lex(source, size, skip, true,  &diff_structural);
+
+        if ( (reference_ret != structural_ret) || (diff_reference.count != diff_structural.count) ||
+             (Diff_diverges() != diff_reference.count) )
+        {
+            if (failures++ < 5u)
+            {
+                Diff_report(seed, index, source, size, skip);
+            }
+        }
+    }
+
+    /*< Function Output >*/
+    if (failures != 0u)
+    {
+        fprintf(stderr, "lexer_differential_test: %zu of %zu case(s) differ\n", failures, cases);
+        return EXIT_FAILURE;
+    }
+
+    printf("lexer_differential_test: ok (%zu cases, seed %llu)\n", cases, (unsigned long long)seed);
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
@@ -0,0 +1,262 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Measures the scanner under one dispatch strategy.
+
+    @file       lexer_dispatch_bench.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The Makefile builds this file twice: lexer_dispatch_bench with
+                the portable `switch`, and lexer_dispatch_bench_goto with
+                -DFROST_COMPUTED_GOTO. `make bench` runs both, so the two
+                tables can be compared line by line.
+
+                Each workload is a unit repeated up to the source size, lexed
+                through Frost_lexWithCallback and Frost_nextTokenInto; the
+                best of several passes is kept. The workloads stress the
+                dispatch differently: plain code alternates token classes,
+                the operator soup changes class on nearly every byte, and the
+                literal-heavy one spends most of its time inside a class.
+
+                Usage: lexer_dispatch_bench [source-MB] [passes]
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+/*< Implements >*/
+#include "../src/lexer/lexer.h"
+#include "../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       BENCH_DISPATCH
+    @brief     Name of the dispatch strategy this binary was built with.
+============================================================================ **/
+#if defined(FROST_COMPUTED_GOTO) && (defined(__GNUC__) || defined(__clang__))
+    #define BENCH_DISPATCH          "computed goto"
+#else
+    #define BENCH_DISPATCH          "switch"
+#endif
+
+/** ============================================================================
+    @def       BENCH_WORKLOADS
+    @brief     Number of workloads.
+============================================================================ **/
+#define BENCH_WORKLOADS             (sizeof(bench_workloads) / sizeof(bench_workloads[0]))
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   benchWorkload
+  @package  Frost_Tests
+
+  @typedef  bench_workload_t
+
+  @brief    A named unit of source to repeat.
+============================================================================ **/
+typedef struct benchWorkload
+{
+    const char          *name;          /*< Shown in the table >*/
+    const char          *unit;          /*< Repeated up to the source size >*/
+} bench_workload_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const bench_workload_t bench_workloads[] =
+{
+    {
+        "plain code",
+        "static int f(const struct s *p, size_t n) {\n"
+        "    int t = 0; /* x */\n"
+        "    for (size_t i = 0; i < n; i++) { t += p[i].v * 3 - (t >> 1); }\n"
+        "    return t; // done\n"
+        "}\n"
+    },
+    {
+        "operators",
+        "a+=b<<c;d->e[f]=!g&&h||~i^j%k;l<=m?n:o;(p)++,--q;r>>=s!=t;u&v|w*x/y-z;\n"
+    },
+    {
+        "literals",
+        "\"a string literal with \\\"escapes\\\" and more text\" 'c' '\\n' 0x7FFF 3.14159 "
+        "/* a block comment running for a while */ 1e-9 // a trailing line comment\n"
+    },
+};
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Bench_now
+  @package  Frost_Tests
+
+  @brief    Monotonic time, in seconds.
+ =========================================================================== **/
+static double Bench_now(void)
+{
+    struct timespec now = { 0, 0 };
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/** ============================================================================
+  @fn       Bench_onToken
+  @package  Frost_Tests
+
+  @brief    Folds each token into a checksum so no work is optimized away.
+ =========================================================================== **/
+static int Bench_onToken(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    UNUSED(offset);
+
+    *(size_t *)ctx += length + (size_t)type;
+
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Bench_callback
+  @package  Frost_Tests
+
+  @brief    One pass through Frost_lexWithCallback.
+
+  @return   Elapsed seconds.
+ =========================================================================== **/
+static double Bench_callback(lexer_t *lexer, const char *source, size_t size, size_t *checksum)
+{
+    /*< Variable Declarations >*/
+    double start = 0.0;
+
+    /*< Start Function Algorithm >*/
+    (void)Frost_lexerResetView(lexer, source, size);
+
+    start = Bench_now();
+    (void)Frost_lexWithCallback(lexer, Bench_onToken, checksum);
+
+    /*< Function Output >*/
+    return Bench_now() - start;
+}
+
+/** ============================================================================
+  @fn       Bench_pull
+  @package  Frost_Tests
+
+  @brief    One pass through Frost_nextTokenInto.
+
+  @return   Elapsed seconds.
+ =========================================================================== **/
+static double Bench_pull(lexer_t *lexer, const char *source, size_t size, size_t *checksum)
+{
+    /*< Variable Declarations >*/
+    token_view_t token  = { 0 };
+    double start        = 0.0;
+
+    /*< Start Function Algorithm >*/
+    (void)Frost_lexerResetView(lexer, source, size);
+
+    start = Bench_now();
+
+    do
+    {
+        (void)Frost_nextTokenInto(lexer, &token);
+        *checksum += token.length + (size_t)token.type;
+    } while (token.type != TOKEN_EOF);
+
+    /*< Function Output >*/
+    return Bench_now() - start;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(int argc, char **argv)
+{
+    /*< Variable Declarations >*/
+    size_t megabytes    = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : 16u;
+    size_t passes       = (argc > 2) ? (size_t)strtoul(argv[2], NULL, 10) : 5u;
+    size_t size         = MAX(megabytes, (size_t)1u) << 20;
+    size_t checksum     = 0u;
+    size_t workload     = 0u;
+    size_t pass         = 0u;
+    size_t offset       = 0u;
+    size_t length       = 0u;
+    double best_push    = 0.0;
+    double best_pull    = 0.0;
+    double elapsed      = 0.0;
+    char *source        = NULL;
+    lexer_t *lexer      = NULL;
+
+    /*< Allocate Memory >*/
+    source  = (char *)malloc(size);
+    lexer   = Frost_initLexerView("", 0u);
+    if ( (source == NULL) || (lexer == NULL) )
+    {
+        fprintf(stderr, "lexer_dispatch_bench: setup failed\n");
+        free(source);
+        return EXIT_FAILURE;
+    }
+
+    /*< Start Function Algorithm >*/
+    printf("Dispatch: %s, %zu MB per workload, best of %zu\n\n", BENCH_DISPATCH, size >> 20, passes);
+    printf("%-12s %16s %16s\n", "Workload", "Callback MB/s", "Pull MB/s");
+
+    for (workload = 0u; workload < BENCH_WORKLOADS; workload++)
+    {
+        length = strlen(bench_workloads[workload].unit);
+
+        for (offset = 0u; offset < size; offset += length)
+        {
+            memcpy(source + offset, bench_workloads[workload].unit, MIN(length, size - offset));
+        }
+
+        best_push = 1e30;
+        best_pull = 1e30;
+
+        for (pass = 0u; pass < MAX(passes, (size_t)1u); pass++)
+        {
+            /*< MIN evaluates its arguments twice: time first, then compare >*/
+            elapsed     = Bench_callback(lexer, source, size, &checksum);
+            best_push   = MIN(best_push, elapsed);
+            elapsed     = Bench_pull(lexer, source, size, &checksum);
+            best_pull   = MIN(best_pull, elapsed);
+        }
+
+        printf("%-12s %16.1f %16.1f\n", bench_workloads[workload].name,
+               (double)size / (best_push * 1e6), (double)size / (best_pull * 1e6));
+    }
+
+    printf("\n(checksum %zu)\n", checksum);
+
+    /*< Free Memory >*/
+    (void)Frost_freeLexer(lexer);
+    free(source);
+
+    /*< Function Output >*/
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
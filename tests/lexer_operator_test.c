@@ -0,0 +1,212 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks that multi-character operators lex as the longest
+                match.
+
+    @file       lexer_operator_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Each case is lexed through both the pull API and
+                Frost_lexStructural from a borrowed view of exactly its size.
+                The bytes past the view are '=', so an operator ending the
+                source that were matched past its end would lex as a longer
+                one.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*< Implements >*/
+#include "../src/lexer/lexer.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TEST_MAX_TOKENS
+    @brief     Tokens of the longest case, TOKEN_EOF included.
+============================================================================ **/
+#define TEST_MAX_TOKENS             8u
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   testOperatorCase
+  @package  Frost_Tests
+
+  @typedef  test_operator_case_t
+
+  @brief    A source and the token types it must lex to, TOKEN_EOF last.
+============================================================================ **/
+typedef struct testOperatorCase
+{
+    const char      *source;
+    token_type_t    types[TEST_MAX_TOKENS];
+} test_operator_case_t;
+
+/** ============================================================================
+  @struct   testCollect
+  @package  Frost_Tests
+
+  @typedef  test_collect_t
+
+  @brief    Token types gathered by Test_collect.
+============================================================================ **/
+typedef struct testCollect
+{
+    token_type_t    types[TEST_MAX_TOKENS];
+    size_t          count;
+} test_collect_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const test_operator_case_t test_cases[] =
+{
+    { "<<=",        { TOKEN_LEFT_SHIFT_ASSIGN, TOKEN_EOF } },
+    { ">>=",        { TOKEN_RIGHT_SHIFT_ASSIGN, TOKEN_EOF } },
+    { "<<",         { TOKEN_LEFT_SHIFT, TOKEN_EOF } },
+    { ">>",         { TOKEN_RIGHT_SHIFT, TOKEN_EOF } },
+    { "<=",         { TOKEN_LESS_EQUAL, TOKEN_EOF } },
+    { "<",          { TOKEN_LESS, TOKEN_EOF } },
+    { "<<==",       { TOKEN_LEFT_SHIFT_ASSIGN, TOKEN_ASSIGN, TOKEN_EOF } },
+    { "<< =",       { TOKEN_LEFT_SHIFT, TOKEN_ASSIGN, TOKEN_EOF } },
+    { "<<<=",       { TOKEN_LEFT_SHIFT, TOKEN_LESS_EQUAL, TOKEN_EOF } },
+    { ">>>>=",      { TOKEN_RIGHT_SHIFT, TOKEN_RIGHT_SHIFT_ASSIGN, TOKEN_EOF } },
+    { "a<<=b>>=1",  { TOKEN_ID, TOKEN_LEFT_SHIFT_ASSIGN, TOKEN_ID,
+                      TOKEN_RIGHT_SHIFT_ASSIGN, TOKEN_LITERAL_INT, TOKEN_EOF } },
+};
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_collect
+  @package  Frost_Tests
+
+  @brief    Structural callback storing each token type.
+ =========================================================================== **/
+static int Test_collect(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    /*< Variable Declarations >*/
+    test_collect_t *collect = (test_collect_t *)ctx;
+
+    /*< Start Function Algorithm >*/
+    UNUSED(offset);
+    UNUSED(length);
+
+    if (collect->count < TEST_MAX_TOKENS)
+    {
+        collect->types[collect->count] = type;
+    }
+
+    collect->count++;
+
+    /*< Function Output >*/
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Test_case
+  @package  Frost_Tests
+
+  @brief    Lexes one case through both engines and compares the types.
+ =========================================================================== **/
+static void Test_case(const test_operator_case_t *test)
+{
+    /*< Variable Declarations >*/
+    char buffer[16]             = { 0 };
+    size_t size                 = strlen(test->source);
+    lexer_t *lexer              = NULL;
+    token_view_t token          = { 0 };
+    test_collect_t collect      = { 0 };
+    size_t index                = 0u;
+    size_t expected             = 0u;
+
+    /*< Start Function Algorithm >*/
+    memcpy(buffer, test->source, size);
+    memset(buffer + size, '=', sizeof(buffer) - size);
+
+    while (test->types[expected] != TOKEN_EOF)
+    {
+        expected++;
+    }
+
+    expected++;
+
+    lexer = Frost_initLexerView(buffer, size);
+    TEST_CHECK(lexer != NULL);
+    if (lexer == NULL)
+    {
+        return;
+    }
+
+    /*< Pull API >*/
+    for (index = 0u; index < expected; index++)
+    {
+        TEST_CHECK(Frost_nextTokenInto(lexer, &token) == FUNCTION_SUCESS);
+        if (token.type != test->types[index])
+        {
+            fprintf(stderr, "\"%s\": token %zu is %d, expected %d\n",
+                    test->source, index, (int)token.type, (int)test->types[index]);
+            test_failures++;
+            break;
+        }
+    }
+
+    /*< Structural engine >*/
+    TEST_CHECK(Frost_lexerResetView(lexer, buffer, size) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_lexStructural(lexer, Test_collect, &collect) == FUNCTION_SUCESS);
+    TEST_CHECK(collect.count == expected);
+    TEST_CHECK( (collect.count == expected) &&
+                (memcmp(collect.types, test->types, expected * sizeof(token_type_t)) == 0) );
+
+    /*< Free Memory >*/
+    Frost_freeLexer(lexer);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    size_t index = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < (sizeof(test_cases) / sizeof(test_cases[0])); index++)
+    {
+        Test_case(&test_cases[index]);
+    }
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "lexer_operator_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("lexer_operator_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
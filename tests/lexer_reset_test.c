@@ -0,0 +1,175 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks that re-targeting a lexer never leaks the source it
+                owns.
+
+    @file       lexer_reset_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Hands a heap source to Frost_initLexer, re-targets the lexer
+                with Frost_lexerResetView, either to that same buffer or to
+                a borrowed one, then frees the lexer. The accounting allocator
+                must see every FROST_MEM_SOURCE byte given back, and the
+                borrowed buffer must be left alone.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*< Implements >*/
+#include "../src/allocator/allocator.h"
+#include "../src/mem_stats/mem_stats.h"
+#include "../src/lexer/lexer.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const char test_source[] = "int frost = 1;\n";
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_ownedLexer
+  @package  Frost_Tests
+
+  @brief    Creates a lexer owning a heap copy of the test source.
+ =========================================================================== **/
+static lexer_t *Test_ownedLexer(void)
+{
+    /*< Variable Declarations >*/
+    char *source    = NULL;
+    lexer_t *lexer  = NULL;
+
+    /*< Allocate Memory >*/
+    source = (char *)Frost_memAlloc(sizeof(test_source), FROST_MEM_SOURCE);
+    TEST_CHECK(source != NULL);
+    if (source == NULL)
+    {
+        return NULL;
+    }
+
+    memcpy(source, test_source, sizeof(test_source));
+
+    lexer = Frost_initLexer(source);
+    TEST_CHECK(lexer != NULL);
+
+    /*< Function Output >*/
+    return lexer;
+}
+
+/** ============================================================================
+  @fn       Test_countTokens
+  @package  Frost_Tests
+
+  @brief    Pulls every token of a lexer, TOKEN_EOF included.
+ =========================================================================== **/
+static size_t Test_countTokens(lexer_t *lexer)
+{
+    /*< Variable Declarations >*/
+    token_view_t token  = { 0 };
+    size_t count        = 0u;
+
+    /*< Start Function Algorithm >*/
+    do
+    {
+        if (Frost_nextTokenInto(lexer, &token) != FUNCTION_SUCESS)
+        {
+            break;
+        }
+
+        count++;
+    } while (token.type != TOKEN_EOF);
+
+    /*< Function Output >*/
+    return count;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    mem_stats_t *stats                  = NULL;
+    frost_allocator_t allocator         = { 0 };
+    const frost_allocator_t *previous   = NULL;
+    mem_tag_stats_t source              = { 0 };
+    char borrowed[sizeof(test_source)]  = { 0 };
+    lexer_t *lexer                      = NULL;
+    size_t count                        = 0u;
+
+    /*< Allocate Memory >*/
+    stats = Frost_initMemStats(NULL, 0u);
+    if (stats == NULL)
+    {
+        fprintf(stderr, "lexer_reset_test: cannot create the stats\n");
+        return EXIT_FAILURE;
+    }
+
+    allocator   = Frost_memStatsAllocator(stats);
+    previous    = Frost_allocatorSet(&allocator);
+
+    /*< Re-targeting to the owned buffer rewinds it and keeps it owned >*/
+    lexer = Test_ownedLexer();
+    if (lexer != NULL)
+    {
+        count = Test_countTokens(lexer);
+        TEST_CHECK(Frost_lexerResetView(lexer, lexer->source, lexer->source_size) == FUNCTION_SUCESS);
+        TEST_CHECK(Test_countTokens(lexer) == count);
+        TEST_CHECK(lexer->owns_source);
+
+        Frost_freeLexer(lexer);
+    }
+
+    /*< Re-targeting to a borrowed buffer releases the owned one >*/
+    memcpy(borrowed, test_source, sizeof(test_source));
+
+    lexer = Test_ownedLexer();
+    if (lexer != NULL)
+    {
+        TEST_CHECK(Frost_lexerResetView(lexer, borrowed, sizeof(borrowed) - 1u) == FUNCTION_SUCESS);
+        TEST_CHECK(Test_countTokens(lexer) == count);
+        TEST_CHECK(!lexer->owns_source);
+
+        Frost_freeLexer(lexer);
+        TEST_CHECK(memcmp(borrowed, test_source, sizeof(test_source)) == 0);
+    }
+
+    TEST_CHECK(Frost_memStatsTag(stats, FROST_MEM_SOURCE, &source) == FUNCTION_SUCESS);
+    TEST_CHECK(source.allocs == 2u);
+    TEST_CHECK(source.frees == source.allocs);
+    TEST_CHECK(source.live == 0u);
+
+    /*< Free Memory >*/
+    (void)Frost_allocatorSet(previous);
+    Frost_freeMemStats(stats);
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "lexer_reset_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("lexer_reset_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
@@ -0,0 +1,325 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Runs many lexers at once on shared sources, to be built with
+                ThreadSanitizer (`make tsan`).
+
+    @file       lexer_stress_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    STRESS_THREADS threads each create their own lexers over the
+                same read-only sources and lex them repeatedly through
+                Frost_nextToken, Frost_nextTokenInto, Frost_lexWithCallback
+                and Frost_lexStructural, including the error and logging
+                paths. Every pass must give the digest computed beforehand on
+                the main thread; any shared mutable state in the lexer shows
+                up as a data race report or as a wrong digest.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+
+/*< Implements >*/
+#include "../src/lexer/lexer.h"
+#include "../src/token/token.h"
+#include "../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       STRESS_THREADS
+    @brief     Number of lexing threads.
+============================================================================ **/
+#define STRESS_THREADS              16u
+
+/** ============================================================================
+    @def       STRESS_ROUNDS
+    @brief     Passes over every source, per thread.
+============================================================================ **/
+#define STRESS_ROUNDS               25u
+
+/** ============================================================================
+    @def       STRESS_SOURCES
+    @brief     Number of shared sources.
+============================================================================ **/
+#define STRESS_SOURCES              (sizeof(stress_sources) / sizeof(stress_sources[0]))
+
+/** ============================================================================
+    @def       STRESS_DIGEST_SEED
+    @brief     FNV-1a offset basis.
+============================================================================ **/
+#define STRESS_DIGEST_SEED          UINT64_C(0xcbf29ce484222325)
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   stressWorker
+  @package  Frost_Tests
+
+  @typedef  stress_worker_t
+
+  @brief    State of one lexing thread.
+============================================================================ **/
+typedef struct stressWorker
+{
+    pthread_t           thread;         /*< Thread handle >*/
+    unsigned int        id;             /*< Thread number >*/
+    size_t              mismatches;     /*< Passes that gave a wrong digest >*/
+} stress_worker_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const char *const stress_sources[] =
+{
+    "int main(void)\n{\n    return 0;\n}\n",
+    "static const double ratio = 1.5e3; /* block */ // line\n"
+    "char c = '\\n'; const char *s = \"esc \\\" aped\";\n",
+    "a<<=b>>=c&&d||e!=f==g<=h>=i->j++k--l+=m-=n*=o/=p%=q^=r|=s&=t\n",
+    "@ $ ` unknown characters reach the error path \"unterminated\n",
+    "/* unterminated comment reaches the end of the source",
+    "x1 _y2 __z3 0x1F 077 3.25f 1. .5 identifiers_and_numbers_and_more_text\n",
+};
+
+static uint64_t stress_expected[sizeof(stress_sources) / sizeof(stress_sources[0])];
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Stress_mix
+  @package  Frost_Tests
+
+  @brief    Folds one token into a digest.
+ =========================================================================== **/
+static uint64_t Stress_mix(uint64_t digest, token_type_t type, size_t offset, size_t length)
+{
+    digest = (digest ^ (uint64_t)type)     * UINT64_C(0x100000001b3);
+    digest = (digest ^ (uint64_t)offset)   * UINT64_C(0x100000001b3);
+    digest = (digest ^ (uint64_t)length)   * UINT64_C(0x100000001b3);
+
+    return digest;
+}
+
+/** ============================================================================
+  @fn       Stress_onToken
+  @package  Frost_Tests
+
+  @brief    Callback folding every token into the digest given as context.
+ =========================================================================== **/
+static int Stress_onToken(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    uint64_t *digest = (uint64_t *)ctx;
+
+    *digest = Stress_mix(*digest, type, offset, length);
+
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Stress_lexCallback
+  @package  Frost_Tests
+
+  @brief    Digest of a source through one of the callback APIs.
+ =========================================================================== **/
+static uint64_t Stress_lexCallback(const char *source, bool structural)
+{
+    /*< Variable Declarations >*/
+    lexer_t *lexer  = NULL;
+    uint64_t digest = STRESS_DIGEST_SEED;
+
+    /*< Start Function Algorithm >*/
+    lexer = Frost_initLexerView(source, strlen(source));
+    if (lexer == NULL)
+    {
+        return 0u;
+    }
+
+    if (structural)
+    {
+        (void)Frost_lexStructural(lexer, Stress_onToken, &digest);
+    }
+    else
+    {
+        (void)Frost_lexWithCallback(lexer, Stress_onToken, &digest);
+    }
+
+    (void)Frost_freeLexer(lexer);
+
+    /*< Function Output >*/
+    return digest;
+}
+
+/** ============================================================================
+  @fn       Stress_lexViews
+  @package  Frost_Tests
+
+  @brief    Digest of a source through Frost_nextTokenInto.
+ =========================================================================== **/
+static uint64_t Stress_lexViews(const char *source)
+{
+    /*< Variable Declarations >*/
+    lexer_t *lexer      = NULL;
+    token_view_t token  = { 0 };
+    uint64_t digest     = STRESS_DIGEST_SEED;
+
+    /*< Start Function Algorithm >*/
+    lexer = Frost_initLexerView(source, strlen(source));
+    if (lexer == NULL)
+    {
+        return 0u;
+    }
+
+    do
+    {
+        (void)Frost_nextTokenInto(lexer, &token);
+        digest = Stress_mix(digest, token.type, token.offset, token.length);
+    } while (token.type != TOKEN_EOF);
+
+    (void)Frost_freeLexer(lexer);
+
+    /*< Function Output >*/
+    return digest;
+}
+
+/** ============================================================================
+  @fn       Stress_lexTokens
+  @package  Frost_Tests
+
+  @brief    Walks a source through Frost_nextToken, allocating every token.
+
+  @return   Number of tokens, EOF included.
+ =========================================================================== **/
+static size_t Stress_lexTokens(const char *source)
+{
+    /*< Variable Declarations >*/
+    lexer_t *lexer  = NULL;
+    token_t *token  = NULL;
+    size_t count    = 0u;
+    bool done       = false;
+
+    /*< Start Function Algorithm >*/
+    lexer = Frost_initLexerView(source, strlen(source));
+    if (lexer == NULL)
+    {
+        return 0u;
+    }
+
+    while (!done)
+    {
+        token = Frost_nextToken(lexer);
+        if (token == NULL)
+        {
+            break;
+        }
+
+        done = (token->type == TOKEN_EOF);
+        (void)Frost_freeToken(token);
+        count++;
+    }
+
+    (void)Frost_freeLexer(lexer);
+
+    /*< Function Output >*/
+    return count;
+}
+
+/** ============================================================================
+  @fn       Stress_worker
+  @package  Frost_Tests
+
+  @brief    Thread body: lexes every source STRESS_ROUNDS times.
+ =========================================================================== **/
+static void *Stress_worker(void *arg)
+{
+    /*< Variable Declarations >*/
+    stress_worker_t *worker = (stress_worker_t *)arg;
+    size_t round            = 0u;
+    size_t index            = 0u;
+    size_t source           = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (round = 0u; round < STRESS_ROUNDS; round++)
+    {
+        for (index = 0u; index < STRESS_SOURCES; index++)
+        {
+            /*< Threads start on different sources to mix the workloads >*/
+            source = (index + worker->id) % STRESS_SOURCES;
+
+            worker->mismatches += (Stress_lexCallback(stress_sources[source], false) != stress_expected[source]);
+            worker->mismatches += (Stress_lexCallback(stress_sources[source], true)  != stress_expected[source]);
+            worker->mismatches += (Stress_lexViews(stress_sources[source])           != stress_expected[source]);
+            worker->mismatches += (Stress_lexTokens(stress_sources[source]) == 0u);
+        }
+    }
+
+    /*< Function Output >*/
+    return NULL;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    stress_worker_t workers[STRESS_THREADS] = { { 0 } };
+    size_t mismatches                       = 0u;
+    size_t started                          = 0u;
+    size_t index                            = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < STRESS_SOURCES; index++)
+    {
+        stress_expected[index] = Stress_lexCallback(stress_sources[index], false);
+    }
+
+    for (started = 0u; started < STRESS_THREADS; started++)
+    {
+        workers[started].id = (unsigned int)started;
+
+        if (pthread_create(&workers[started].thread, NULL, Stress_worker, &workers[started]) != 0)
+        {
+            fprintf(stderr, "lexer_stress_test: cannot start thread %zu\n", started);
+            break;
+        }
+    }
+
+    for (index = 0u; index < started; index++)
+    {
+        (void)pthread_join(workers[index].thread, NULL);
+        mismatches += workers[index].mismatches;
+    }
+
+    /*< Function Output >*/
+    if ( (started != STRESS_THREADS) || (mismatches != 0u) )
+    {
+        fprintf(stderr, "lexer_stress_test: %zu mismatching pass(es)\n", mismatches);
+        return EXIT_FAILURE;
+    }
+
+    printf("lexer_stress_test: ok (%u threads)\n", STRESS_THREADS);
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
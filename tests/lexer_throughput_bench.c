@@ -0,0 +1,271 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Measures aggregate lexing throughput as threads are added.
+
+    @file       lexer_throughput_bench.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Every thread runs its own lexer over the same read-only source
+                with Frost_lexStructural. Thread counts double from 1 up to
+                the number of online cores, and the last one is always tried.
+                The table reports aggregate MB/s, the speedup over one thread
+                and the scaling efficiency (speedup / threads); since lexers
+                share no mutable state, efficiency should stay close to 1
+                until memory bandwidth or SMT siblings get in the way.
+
+                Usage: lexer_throughput_bench [source-MB] [passes]
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/*< Implements >*/
+#include "../src/lexer/lexer.h"
+#include "../inc/utils.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       BENCH_MAX_THREADS
+    @brief     Upper bound on the thread count tried.
+============================================================================ **/
+#define BENCH_MAX_THREADS           256u
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   benchWorker
+  @package  Frost_Tests
+
+  @typedef  bench_worker_t
+
+  @brief    State of one lexing thread.
+============================================================================ **/
+typedef struct benchWorker
+{
+    pthread_t           thread;         /*< Thread handle >*/
+    size_t              tokens;         /*< Tokens seen over every pass >*/
+} bench_worker_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const char bench_unit[] =
+    "static int frost_parse(const token_view_t *tokens, size_t count) /* scan */\n"
+    "{\n"
+    "    for (size_t index = 0u; index < count; index++) {\n"
+    "        if ((tokens[index].type == TOKEN_ID) && (tokens[index].length >= 3u)) {\n"
+    "            total += 0x1F * 2.5f; // accumulate\n"
+    "        }\n"
+    "    }\n"
+    "    return printf(\"%zu\\n\", total) != 'x';\n"
+    "}\n";
+
+static char *bench_source;
+static size_t bench_size;
+static size_t bench_passes;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Bench_now
+  @package  Frost_Tests
+
+  @brief    Monotonic time, in seconds.
+ =========================================================================== **/
+static double Bench_now(void)
+{
+    struct timespec now = { 0, 0 };
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/** ============================================================================
+  @fn       Bench_onToken
+  @package  Frost_Tests
+
+  @brief    Counts tokens.
+ =========================================================================== **/
+static int Bench_onToken(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    UNUSED(type);
+    UNUSED(offset);
+    UNUSED(length);
+
+    (*(size_t *)ctx)++;
+
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Bench_worker
+  @package  Frost_Tests
+
+  @brief    Thread body: lexes the source bench_passes times.
+ =========================================================================== **/
+static void *Bench_worker(void *arg)
+{
+    /*< Variable Declarations >*/
+    bench_worker_t *worker  = (bench_worker_t *)arg;
+    lexer_t *lexer          = NULL;
+    size_t pass             = 0u;
+
+    /*< Start Function Algorithm >*/
+    lexer = Frost_initLexerView(bench_source, bench_size);
+    if (lexer == NULL)
+    {
+        return NULL;
+    }
+
+    for (pass = 0u; pass < bench_passes; pass++)
+    {
+        (void)Frost_lexerResetView(lexer, bench_source, bench_size);
+        (void)Frost_lexStructural(lexer, Bench_onToken, &worker->tokens);
+    }
+
+    (void)Frost_freeLexer(lexer);
+
+    /*< Function Output >*/
+    return NULL;
+}
+
+/** ============================================================================
+  @fn       Bench_run
+  @package  Frost_Tests
+
+  @brief    Runs one thread count.
+
+  @return   Aggregate throughput in MB/s, or 0 on failure.
+ =========================================================================== **/
+static double Bench_run(bench_worker_t *workers, size_t threads)
+{
+    /*< Variable Declarations >*/
+    double start    = 0.0;
+    double elapsed  = 0.0;
+    size_t started  = 0u;
+    size_t index    = 0u;
+
+    /*< Start Function Algorithm >*/
+    start = Bench_now();
+
+    for (started = 0u; started < threads; started++)
+    {
+        workers[started].tokens = 0u;
+
+        if (pthread_create(&workers[started].thread, NULL, Bench_worker, &workers[started]) != 0)
+        {
+            break;
+        }
+    }
+
+    for (index = 0u; index < started; index++)
+    {
+        (void)pthread_join(workers[index].thread, NULL);
+    }
+
+    elapsed = Bench_now() - start;
+
+    /*< Every thread must have lexed the same tokens >*/
+    for (index = 1u; index < started; index++)
+    {
+        if (workers[index].tokens != workers[0].tokens)
+        {
+            return 0.0;
+        }
+    }
+
+    /*< Function Output >*/
+    return (started == threads) ?
+           ((double)bench_size * (double)bench_passes * (double)threads) / (elapsed * 1e6) : 0.0;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(int argc, char **argv)
+{
+    /*< Variable Declarations >*/
+    static bench_worker_t workers[BENCH_MAX_THREADS];
+    size_t megabytes    = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : 8u;
+    long cores          = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t max_threads  = 0u;
+    size_t threads      = 1u;
+    size_t offset       = 0u;
+    double single       = 0.0;
+    double rate         = 0.0;
+
+    bench_passes = (argc > 2) ? (size_t)strtoul(argv[2], NULL, 10) : 4u;
+    max_threads  = MIN((cores > 0) ? (size_t)cores : 1u, (size_t)BENCH_MAX_THREADS);
+
+    /*< Allocate Memory >*/
+    bench_size      = MAX(megabytes, (size_t)1u) << 20;
+    bench_source    = (char *)malloc(bench_size);
+    if (bench_source == NULL)
+    {
+        fprintf(stderr, "lexer_throughput_bench: cannot allocate the source\n");
+        return EXIT_FAILURE;
+    }
+
+    for (offset = 0u; offset < bench_size; offset += sizeof(bench_unit) - 1u)
+    {
+        memcpy(bench_source + offset, bench_unit, MIN(sizeof(bench_unit) - 1u, bench_size - offset));
+    }
+
+    /*< Start Function Algorithm >*/
+    printf("%zu MB source, %zu pass(es) per thread, %ld core(s)\n\n", bench_size >> 20, bench_passes, cores);
+    printf("%8s %12s %10s %12s\n", "Threads", "MB/s", "Speedup", "Efficiency");
+
+    while (threads <= max_threads)
+    {
+        rate = Bench_run(workers, threads);
+        if (rate == 0.0)
+        {
+            fprintf(stderr, "lexer_throughput_bench: run with %zu thread(s) failed\n", threads);
+            free(bench_source);
+            return EXIT_FAILURE;
+        }
+
+        single = (threads == 1u) ? rate : single;
+        printf("%8zu %12.1f %10.2f %12.2f\n", threads, rate, rate / single, (rate / single) / (double)threads);
+
+        if (threads == max_threads)
+        {
+            break;
+        }
+
+        threads = MIN(threads * 2u, max_threads);
+    }
+
+    /*< Free Memory >*/
+    free(bench_source);
+
+    /*< Function Output >*/
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
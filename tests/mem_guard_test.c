@@ -0,0 +1,270 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks that lexing does not allocate, while token consumers
+                may.
+
+    @file       mem_guard_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Installs the accounting allocator with MEM_STATS_GUARD_LEX and
+                lexes the same source through Frost_nextTokenInto,
+                Frost_lexWithCallback and Frost_lexStructural, then a source
+                with line splices through Frost_lexSpliced. The callbacks
+                allocate and free a block per token, as a parser building
+                nodes would: those allocations must be accepted and must not
+                be charged to TRACE_PHASE_LEX.
+
+                It also grows and shrinks cache-line aligned blocks, as the
+                token queue and the scheduler allocate them, through the
+                accounting allocator: they must keep their alignment and
+                contents.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include "../src/allocator/allocator.h"
+#include "../src/mem_stats/mem_stats.h"
+#include "../src/time_trace/time_trace.h"
+#include "../src/lexer/lexer.h"
+#include "../src/splice/splice.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const char test_source[] =
+    "int main(void)\n"
+    "{\n"
+    "    /* comment */ float ratio = 3.25f;\n"
+    "    const char *name = \"frost\\n\"; // trailing\n"
+    "    return (ratio >= 1.0) ? 'a' : 0x1F;\n"
+    "}\n";
+
+static const char test_spliced[] =
+    "#define FROST_MAX(a, b) \\\n"
+    "    ((a) > (b) ? (a) : (b))\n"
+    "int fro\\\nst = 1; /* a comment long enough to need \\\n"
+    "   more than one stitched window, \\\n"
+    "   since no token fits before its end */ int done;\n";
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_allocatingCallback
+  @package  Frost_Tests
+
+  @brief    Token consumer allocating and freeing a block per token.
+ =========================================================================== **/
+static int Test_allocatingCallback(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    /*< Variable Declarations >*/
+    size_t *count   = (size_t *)ctx;
+    void *node      = NULL;
+
+    /*< Start Function Algorithm >*/
+    UNUSED(type);
+    UNUSED(offset);
+
+    node = Frost_memAlloc(length + 1u, FROST_MEM_GENERAL);
+    if (node == NULL)
+    {
+        return -ENOMEM;
+    }
+
+    Frost_memFree(node, length + 1u, FROST_MEM_GENERAL);
+    (*count)++;
+
+    /*< Function Output >*/
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Test_lexAll
+  @package  Frost_Tests
+
+  @brief    Lexes the test source through the three lexing entry points.
+ =========================================================================== **/
+static void Test_lexAll(void)
+{
+    /*< Variable Declarations >*/
+    lexer_t *lexer      = NULL;
+    token_view_t token  = { 0 };
+    void *node          = NULL;
+    size_t pulled       = 0u;
+    size_t streamed     = 0u;
+    size_t structural   = 0u;
+
+    /*< Allocate Memory >*/
+    lexer = Frost_initLexerView(test_source, sizeof(test_source) - 1u);
+    TEST_CHECK(lexer != NULL);
+    if (lexer == NULL)
+    {
+        return;
+    }
+
+    /*< Pull API: the consumer allocates between calls >*/
+    do
+    {
+        TEST_CHECK(Frost_nextTokenInto(lexer, &token) == FUNCTION_SUCESS);
+
+        node = Frost_memAlloc(token.length + 1u, FROST_MEM_GENERAL);
+        TEST_CHECK(node != NULL);
+        Frost_memFree(node, token.length + 1u, FROST_MEM_GENERAL);
+
+        pulled++;
+    } while (token.type != TOKEN_EOF);
+
+    /*< Callback APIs: the consumer allocates from inside the lexing loop >*/
+    TEST_CHECK(Frost_lexerResetView(lexer, test_source, sizeof(test_source) - 1u) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_lexWithCallback(lexer, Test_allocatingCallback, &streamed) == FUNCTION_SUCESS);
+
+    TEST_CHECK(Frost_lexerResetView(lexer, test_source, sizeof(test_source) - 1u) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_lexStructural(lexer, Test_allocatingCallback, &structural) == FUNCTION_SUCESS);
+
+    TEST_CHECK(pulled > 1u);
+    TEST_CHECK(streamed == pulled);
+    TEST_CHECK(structural == pulled);
+
+    /*< Splices: the map, the private lexer and the windows are allocated >*/
+    structural = 0u;
+    TEST_CHECK(Frost_lexerResetView(lexer, test_spliced, sizeof(test_spliced) - 1u) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_lexSpliced(lexer, Test_allocatingCallback, &structural) == FUNCTION_SUCESS);
+    TEST_CHECK(structural > 1u);
+
+    /*< Callbacks must leave the caller phase as they found it >*/
+    TEST_CHECK(Frost_tracePhaseCurrent() == TRACE_PHASE_PARSE);
+
+    /*< Free Memory >*/
+    Frost_freeLexer(lexer);
+}
+
+/** ============================================================================
+  @fn       Test_alignedRealloc
+  @package  Frost_Tests
+
+  @brief    Resizes an over-aligned block and checks alignment and contents.
+
+  @param    stats     [in]:   Stats behind the current allocator.
+ =========================================================================== **/
+static void Test_alignedRealloc(const mem_stats_t *stats)
+{
+    /*< Variable Declarations >*/
+    mem_tag_stats_t queue   = { 0 };
+    unsigned char *block    = NULL;
+    unsigned char *grown    = NULL;
+    size_t index            = 0u;
+    bool intact             = true;
+
+    /*< Allocate Memory >*/
+    block = (unsigned char *)Frost_memAlignedAlloc(ARCH_CACHE_LINE_SIZE, 128u, FROST_MEM_QUEUE);
+    TEST_CHECK(block != NULL);
+    if (block == NULL)
+    {
+        return;
+    }
+
+    for (index = 0u; index < 128u; index++)
+    {
+        block[index] = (unsigned char)index;
+    }
+
+    /*< Start Function Algorithm >*/
+    grown = (unsigned char *)Frost_memRealloc(block, 128u, 4096u, FROST_MEM_QUEUE);
+    TEST_CHECK(grown != NULL);
+    if (grown == NULL)
+    {
+        Frost_memFree(block, 128u, FROST_MEM_QUEUE);
+        return;
+    }
+
+    TEST_CHECK(((uintptr_t)grown % ARCH_CACHE_LINE_SIZE) == 0u);
+    for (index = 0u; index < 128u; index++)
+    {
+        intact = (intact) && (grown[index] == (unsigned char)index);
+    }
+
+    TEST_CHECK(intact);
+
+    block = (unsigned char *)Frost_memRealloc(grown, 4096u, 64u, FROST_MEM_QUEUE);
+    TEST_CHECK(block != NULL);
+    TEST_CHECK( (block != NULL) && (((uintptr_t)block % ARCH_CACHE_LINE_SIZE) == 0u) );
+    TEST_CHECK( (block != NULL) && (block[63] == 63u) );
+
+    /*< Free Memory >*/
+    Frost_memFree((block != NULL) ? block : grown, 64u, FROST_MEM_QUEUE);
+
+    TEST_CHECK(Frost_memStatsTag(stats, FROST_MEM_QUEUE, &queue) == FUNCTION_SUCESS);
+    TEST_CHECK(queue.live == 0u);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    mem_stats_t *stats                  = NULL;
+    frost_allocator_t allocator         = { 0 };
+    const frost_allocator_t *previous   = NULL;
+    mem_phase_stats_t lex               = { 0 };
+    trace_phase_t phase                 = TRACE_PHASE_OTHER;
+
+    /*< Allocate Memory >*/
+    stats = Frost_initMemStats(NULL, MEM_STATS_GUARD_LEX);
+    if (stats == NULL)
+    {
+        fprintf(stderr, "mem_guard_test: cannot create the stats\n");
+        return EXIT_FAILURE;
+    }
+
+    allocator   = Frost_memStatsAllocator(stats);
+    previous    = Frost_allocatorSet(&allocator);
+
+    /*< Start Function Algorithm >*/
+    phase = Frost_tracePhaseEnter(TRACE_PHASE_PARSE);
+    Test_lexAll();
+    Frost_tracePhaseLeave(phase);
+
+    Test_alignedRealloc(stats);
+
+    TEST_CHECK(Frost_memStatsViolations(stats) == 0u);
+    TEST_CHECK(Frost_memStatsPhase(stats, TRACE_PHASE_LEX, &lex) == FUNCTION_SUCESS);
+    TEST_CHECK(lex.allocs == 0u);
+
+    /*< Free Memory >*/
+    (void)Frost_allocatorSet(previous);
+    Frost_freeMemStats(stats);
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "mem_guard_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("mem_guard_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
@@ -0,0 +1,484 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Recursive fork/join stress test of the work-stealing scheduler.
+
+    @file       scheduler_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Fibonacci is computed with one task group per call, so every
+                worker joins nested groups while its children are stolen.
+                Several outside threads inject roots at the same time and
+                join them, stealing as they wait. Two more cases make the
+                rarer paths deterministic: a task that waits without joining
+                until a thief runs its child, and a lone worker forking past
+                the capacity of its deque, which must run the overflow
+                inline. Built for `make tsan` as well.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/*< Implements >*/
+#include "../src/scheduler/scheduler.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TEST_WORKERS
+    @brief     Workers of the pool used by the recursive cases.
+============================================================================ **/
+#define TEST_WORKERS                4u
+
+/** ============================================================================
+    @def       TEST_INJECTORS
+    @brief     Outside threads forking roots at the same time.
+============================================================================ **/
+#define TEST_INJECTORS              3u
+
+/** ============================================================================
+    @def       TEST_ROOTS
+    @brief     Roots forked by each outside thread.
+============================================================================ **/
+#define TEST_ROOTS                  4u
+
+/** ============================================================================
+    @def       TEST_FIB
+    @brief     Argument of every root.
+============================================================================ **/
+#define TEST_FIB                    18u
+
+/** ============================================================================
+    @def       TEST_DEQUE_CAPACITY
+    @brief     Mirrors SCHEDULER_DEQUE_CAPACITY, private to the scheduler.
+============================================================================ **/
+#define TEST_DEQUE_CAPACITY         4096u
+
+/** ============================================================================
+    @def       TEST_OVERFLOW
+    @brief     Tasks forked past a full deque.
+============================================================================ **/
+#define TEST_OVERFLOW               64u
+
+/** ============================================================================
+    @def       TEST_TIMEOUT_S
+    @brief     Seconds a case waits for another thread before failing.
+============================================================================ **/
+#define TEST_TIMEOUT_S              10
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   testFib
+  @package  Frost_Tests
+
+  @typedef  test_fib_t
+
+  @brief    One call of the recursive Fibonacci, and the task running it.
+============================================================================ **/
+typedef struct testFib
+{
+    task_t              task;           /*< Task storage, alive until the join >*/
+    scheduler_t         *scheduler;     /*< Pool the call forks into >*/
+    pthread_t           forker;         /*< Thread that forked the call >*/
+    unsigned int        n;              /*< Argument >*/
+    uint64_t            result;         /*< Fibonacci of n >*/
+} test_fib_t;
+
+/** ============================================================================
+  @struct   testMarker
+  @package  Frost_Tests
+
+  @typedef  test_marker_t
+
+  @brief    Task recording where and whether it ran.
+============================================================================ **/
+typedef struct testMarker
+{
+    task_t              task;           /*< Task storage >*/
+    pthread_t           thread;         /*< Thread that ran the task >*/
+    atomic_bool         done;           /*< Set once the task ran >*/
+} test_marker_t;
+
+/** ============================================================================
+  @struct   testParent
+  @package  Frost_Tests
+
+  @typedef  test_parent_t
+
+  @brief    Task forking markers, for the stealing and overflow cases.
+============================================================================ **/
+typedef struct testParent
+{
+    task_t              task;           /*< Task storage >*/
+    scheduler_t         *scheduler;     /*< Pool the markers are forked into >*/
+    test_marker_t       *markers;       /*< Markers to fork >*/
+    size_t              count;          /*< Entries of markers >*/
+    size_t              inline_runs;    /*< Markers run before their fork returned >*/
+    bool                stolen;         /*< The first marker ran on another thread >*/
+    atomic_bool         forked;         /*< Set once every marker was forked >*/
+} test_parent_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Children run on another thread than the one that forked them >*/
+static atomic_size_t test_stolen;
+
+/*< Children run at all >*/
+static atomic_size_t test_calls;
+
+static test_marker_t test_markers[TEST_DEQUE_CAPACITY + TEST_OVERFLOW];
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_expected
+  @package  Frost_Tests
+
+  @brief    Iterative Fibonacci, the reference.
+ =========================================================================== **/
+static uint64_t Test_expected(unsigned int n)
+{
+    /*< Variable Declarations >*/
+    uint64_t previous   = 0u;
+    uint64_t current    = 1u;
+    uint64_t next       = 0u;
+
+    /*< Start Function Algorithm >*/
+    if (n == 0u)
+    {
+        return 0u;
+    }
+
+    while (--n > 0u)
+    {
+        next        = previous + current;
+        previous    = current;
+        current     = next;
+    }
+
+    /*< Function Output >*/
+    return current;
+}
+
+/** ============================================================================
+  @fn       Test_fib
+  @package  Frost_Tests
+
+  @brief    Forks both recursive calls into a group of their own and joins it.
+ =========================================================================== **/
+static void Test_fib(void *arg)
+{
+    /*< Variable Declarations >*/
+    test_fib_t *call        = (test_fib_t *)arg;
+    test_fib_t children[2];
+    task_group_t group;
+    size_t index            = 0u;
+
+    /*< Start Function Algorithm >*/
+    atomic_fetch_add_explicit(&test_calls, 1u, memory_order_relaxed);
+
+    if (!pthread_equal(call->forker, pthread_self()))
+    {
+        atomic_fetch_add_explicit(&test_stolen, 1u, memory_order_relaxed);
+    }
+
+    if (call->n < 2u)
+    {
+        call->result = call->n;
+        return;
+    }
+
+    (void)Frost_taskGroupInit(&group);
+
+    for (index = 0u; index < 2u; index++)
+    {
+        children[index].scheduler   = call->scheduler;
+        children[index].forker      = pthread_self();
+        children[index].n           = call->n - 1u - (unsigned int)index;
+        children[index].result      = 0u;
+
+        TEST_CHECK(Frost_schedulerFork(call->scheduler, &group, &children[index].task,
+                                       Test_fib, &children[index]) == FUNCTION_SUCESS);
+    }
+
+    TEST_CHECK(Frost_schedulerJoin(call->scheduler, &group) == FUNCTION_SUCESS);
+
+    /*< Function Output >*/
+    call->result = children[0].result + children[1].result;
+}
+
+/** ============================================================================
+  @fn       Test_injector
+  @package  Frost_Tests
+
+  @brief    Outside thread: forks TEST_ROOTS roots, joins, checks them.
+ =========================================================================== **/
+static void *Test_injector(void *arg)
+{
+    /*< Variable Declarations >*/
+    scheduler_t *scheduler  = (scheduler_t *)arg;
+    test_fib_t roots[TEST_ROOTS];
+    task_group_t group;
+    size_t index            = 0u;
+
+    /*< Start Function Algorithm >*/
+    (void)Frost_taskGroupInit(&group);
+
+    for (index = 0u; index < TEST_ROOTS; index++)
+    {
+        roots[index].scheduler  = scheduler;
+        roots[index].forker     = pthread_self();
+        roots[index].n          = TEST_FIB - (unsigned int)index;
+        roots[index].result     = 0u;
+
+        TEST_CHECK(Frost_schedulerFork(scheduler, &group, &roots[index].task,
+                                       Test_fib, &roots[index]) == FUNCTION_SUCESS);
+    }
+
+    TEST_CHECK(Frost_schedulerJoin(scheduler, &group) == FUNCTION_SUCESS);
+
+    for (index = 0u; index < TEST_ROOTS; index++)
+    {
+        TEST_CHECK(roots[index].result == Test_expected(roots[index].n));
+    }
+
+    /*< Function Output >*/
+    return NULL;
+}
+
+/** ============================================================================
+  @fn       Test_marker
+  @package  Frost_Tests
+
+  @brief    Records the thread running the task, then marks it done.
+ =========================================================================== **/
+static void Test_marker(void *arg)
+{
+    /*< Variable Declarations >*/
+    test_marker_t *marker = (test_marker_t *)arg;
+
+    /*< Start Function Algorithm >*/
+    marker->thread = pthread_self();
+    atomic_store_explicit(&marker->done, true, memory_order_release);
+}
+
+/** ============================================================================
+  @fn       Test_wait
+  @package  Frost_Tests
+
+  @brief    Spins until a flag is set, without running any task.
+
+  @return   false if TEST_TIMEOUT_S elapsed first.
+ =========================================================================== **/
+static bool Test_wait(atomic_bool *flag)
+{
+    /*< Variable Declarations >*/
+    struct timespec start   = { 0, 0 };
+    struct timespec now     = { 0, 0 };
+
+    /*< Start Function Algorithm >*/
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+
+    while (!atomic_load_explicit(flag, memory_order_acquire))
+    {
+        (void)clock_gettime(CLOCK_MONOTONIC, &now);
+        if ((now.tv_sec - start.tv_sec) > TEST_TIMEOUT_S)
+        {
+            return false;
+        }
+
+        sched_yield();
+    }
+
+    /*< Function Output >*/
+    return true;
+}
+
+/** ============================================================================
+  @fn       Test_parent
+  @package  Frost_Tests
+
+  @brief    Forks every marker, counting those run inline, then joins.
+
+  @details  With one marker, the parent waits for it without joining: only
+            a thief can run it meanwhile.
+ =========================================================================== **/
+static void Test_parent(void *arg)
+{
+    /*< Variable Declarations >*/
+    test_parent_t *parent   = (test_parent_t *)arg;
+    task_group_t group;
+    size_t index            = 0u;
+
+    /*< Start Function Algorithm >*/
+    (void)Frost_taskGroupInit(&group);
+
+    for (index = 0u; index < parent->count; index++)
+    {
+        atomic_init(&parent->markers[index].done, false);
+
+        TEST_CHECK(Frost_schedulerFork(parent->scheduler, &group, &parent->markers[index].task,
+                                       Test_marker, &parent->markers[index]) == FUNCTION_SUCESS);
+
+        if ( atomic_load_explicit(&parent->markers[index].done, memory_order_acquire) &&
+             pthread_equal(parent->markers[index].thread, pthread_self()) )
+        {
+            parent->inline_runs++;
+        }
+    }
+
+    atomic_store_explicit(&parent->forked, true, memory_order_release);
+
+    if (parent->count == 1u)
+    {
+        TEST_CHECK(Test_wait(&parent->markers[0].done));
+        parent->stolen = !pthread_equal(parent->markers[0].thread, pthread_self());
+    }
+
+    TEST_CHECK(Frost_schedulerJoin(parent->scheduler, &group) == FUNCTION_SUCESS);
+
+    for (index = 0u; index < parent->count; index++)
+    {
+        TEST_CHECK(atomic_load_explicit(&parent->markers[index].done, memory_order_acquire));
+    }
+}
+
+/** ============================================================================
+  @fn       Test_runParent
+  @package  Frost_Tests
+
+  @brief    Injects a parent task, waits until it forked everything, joins.
+ =========================================================================== **/
+static void Test_runParent(scheduler_t *scheduler, test_parent_t *parent)
+{
+    /*< Variable Declarations >*/
+    task_group_t group;
+
+    /*< Start Function Algorithm >*/
+    parent->scheduler   = scheduler;
+    parent->inline_runs = 0u;
+    parent->stolen      = false;
+    atomic_init(&parent->forked, false);
+
+    (void)Frost_taskGroupInit(&group);
+    TEST_CHECK(Frost_schedulerFork(scheduler, &group, &parent->task, Test_parent, parent) == FUNCTION_SUCESS);
+
+    /*< Joining would steal from the parent's deque: wait first >*/
+    TEST_CHECK(Test_wait(&parent->forked));
+    TEST_CHECK(Frost_schedulerJoin(scheduler, &group) == FUNCTION_SUCESS);
+}
+
+/** ============================================================================
+  @fn       Test_recursive
+  @package  Frost_Tests
+
+  @brief    Nested fork/join from several outside threads at once.
+ =========================================================================== **/
+static void Test_recursive(scheduler_t *scheduler)
+{
+    /*< Variable Declarations >*/
+    pthread_t threads[TEST_INJECTORS];
+    uint64_t calls      = 0u;
+    size_t index        = 0u;
+    size_t root         = 0u;
+
+    /*< Start Function Algorithm >*/
+    atomic_init(&test_stolen, 0u);
+    atomic_init(&test_calls, 0u);
+
+    for (index = 0u; index < TEST_INJECTORS; index++)
+    {
+        TEST_CHECK(pthread_create(&threads[index], NULL, Test_injector, scheduler) == 0);
+    }
+
+    for (index = 0u; index < TEST_INJECTORS; index++)
+    {
+        (void)pthread_join(threads[index], NULL);
+    }
+
+    /*< fib(n) makes 2 * fib(n + 1) - 1 calls >*/
+    for (root = 0u; root < TEST_ROOTS; root++)
+    {
+        calls += 2u * Test_expected(TEST_FIB - (unsigned int)root + 1u) - 1u;
+    }
+
+    TEST_CHECK(atomic_load(&test_calls) == TEST_INJECTORS * calls);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    scheduler_t *scheduler  = NULL;
+    test_parent_t parent;
+
+    /*< Recursive fork/join and stealing, on a pool >*/
+    scheduler = Frost_initScheduler(TEST_WORKERS);
+    TEST_CHECK(scheduler != NULL);
+    if (scheduler != NULL)
+    {
+        Test_recursive(scheduler);
+
+        parent.markers  = test_markers;
+        parent.count    = 1u;
+        Test_runParent(scheduler, &parent);
+        TEST_CHECK(parent.stolen);
+        TEST_CHECK(parent.inline_runs == 0u);
+
+        (void)Frost_freeScheduler(scheduler);
+    }
+
+    /*< Deque overflow, on a lone worker nobody steals from >*/
+    scheduler = Frost_initScheduler(1u);
+    TEST_CHECK(scheduler != NULL);
+    if (scheduler != NULL)
+    {
+        parent.markers  = test_markers;
+        parent.count    = TEST_DEQUE_CAPACITY + TEST_OVERFLOW;
+        Test_runParent(scheduler, &parent);
+        TEST_CHECK(parent.inline_runs == TEST_OVERFLOW);
+
+        (void)Frost_freeScheduler(scheduler);
+    }
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "scheduler_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("scheduler_test: ok (%zu calls, %zu stolen)\n", atomic_load(&test_calls), atomic_load(&test_stolen));
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
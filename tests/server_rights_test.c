@@ -0,0 +1,255 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks that the compile server closes every descriptor a
+                client passes that it does not use.
+
+    @file       server_rights_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Sends requests whose SCM_RIGHTS messages carry the wrong
+                number of descriptors, or come twice, and checks that the
+                number of descriptors open in the process is back to where it
+                was once the server has answered.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Feature Macros >*/
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE     /*< mkdtemp() >*/
+#endif
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/*< Implements >*/
+#include "../src/server/server.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TEST_MAGIC
+    @brief     First word of a request, as in server.c.
+============================================================================ **/
+#define TEST_MAGIC                  0x54535246u
+
+/** ============================================================================
+    @def       TEST_MAX_RIGHTS
+    @brief     Most descriptors sent in one control message.
+============================================================================ **/
+#define TEST_MAX_RIGHTS             4u
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_handler
+  @package  Frost_Tests
+
+  @brief    Request handler: succeeds without compiling anything.
+ =========================================================================== **/
+static int Test_handler(server_t *server, const server_request_t *request, void *ctx)
+{
+    UNUSED(server);
+    UNUSED(request);
+    UNUSED(ctx);
+
+    return 0;
+}
+
+/** ============================================================================
+  @fn       Test_serve
+  @package  Frost_Tests
+
+  @brief    Server thread.
+ =========================================================================== **/
+static void *Test_serve(void *arg)
+{
+    (void)Frost_serverRun((server_t *)arg, NULL);
+
+    return NULL;
+}
+
+/** ============================================================================
+  @fn       Test_openDescriptors
+  @package  Frost_Tests
+
+  @brief    Counts the descriptors open in the process.
+ =========================================================================== **/
+static size_t Test_openDescriptors(void)
+{
+    /*< Variable Declarations >*/
+    DIR *directory  = NULL;
+    size_t count    = 0u;
+
+    /*< Start Function Algorithm >*/
+    directory = opendir("/proc/self/fd");
+    if (directory == NULL)
+    {
+        return 0u;
+    }
+
+    while (readdir(directory) != NULL)
+    {
+        count++;
+    }
+
+    closedir(directory);
+
+    /*< Function Output >*/
+    return count;
+}
+
+/** ============================================================================
+  @fn       Test_request
+  @package  Frost_Tests
+
+  @brief    Sends an empty request with one or two SCM_RIGHTS messages and
+            waits for the server to hang up.
+
+  @param    path      [in]:   Server socket path.
+  @param    first     [in]:   Descriptors in the first message.
+  @param    second    [in]:   Descriptors in a second message, or 0.
+ =========================================================================== **/
+static void Test_request(const char *path, size_t first, size_t second)
+{
+    /*< Variable Declarations >*/
+    uint32_t header[4]                                          = { TEST_MAGIC, 1u, 0u, 0u };
+    char control[2u * CMSG_SPACE(TEST_MAX_RIGHTS * sizeof(int))] = { 0 };
+    int rights[TEST_MAX_RIGHTS]                                 = { 0 };
+    struct sockaddr_un address                                  = { 0 };
+    struct iovec iov                                            = { 0 };
+    struct msghdr message                                       = { 0 };
+    struct cmsghdr *cmsg                                        = NULL;
+    char reply[8]                                               = { 0 };
+    size_t counts[2]                                            = { first, second };
+    size_t index                                                = 0u;
+    int fd                                                      = -1;
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < TEST_MAX_RIGHTS; index++)
+    {
+        rights[index] = STDERR_FILENO;
+    }
+
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    TEST_CHECK(fd >= 0);
+    TEST_CHECK(connect(fd, (struct sockaddr *)&address, sizeof(address)) == 0);
+
+    iov.iov_base            = header;
+    iov.iov_len             = sizeof(header);
+    message.msg_iov         = &iov;
+    message.msg_iovlen      = 1u;
+    message.msg_control     = control;
+    message.msg_controllen  = CMSG_SPACE(first * sizeof(int)) +
+                              ((second != 0u) ? CMSG_SPACE(second * sizeof(int)) : 0u);
+
+    cmsg = CMSG_FIRSTHDR(&message);
+    for (index = 0u; (index < 2u) && (counts[index] != 0u); index++)
+    {
+        cmsg->cmsg_level    = SOL_SOCKET;
+        cmsg->cmsg_type     = SCM_RIGHTS;
+        cmsg->cmsg_len      = CMSG_LEN(counts[index] * sizeof(int));
+        memcpy(CMSG_DATA(cmsg), rights, counts[index] * sizeof(int));
+        cmsg = CMSG_NXTHDR(&message, cmsg);
+    }
+
+    TEST_CHECK(sendmsg(fd, &message, 0) == (ssize_t)sizeof(header));
+
+    /*< The server closes the connection once it is done with the request >*/
+    while (read(fd, reply, sizeof(reply)) > 0)
+    {
+    }
+
+    close(fd);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    char directory[]    = "/tmp/frost-rights-XXXXXX";
+    char path[64]       = { 0 };
+    server_t *server    = NULL;
+    pthread_t thread;
+    size_t before       = 0u;
+
+    /*< Allocate Memory >*/
+    if (mkdtemp(directory) == NULL)
+    {
+        fprintf(stderr, "server_rights_test: cannot create a directory\n");
+        return EXIT_FAILURE;
+    }
+
+    snprintf(path, sizeof(path), "%s/frost.sock", directory);
+
+    server = Frost_initServer(path, Test_handler, NULL);
+    if ( (server == NULL) || (pthread_create(&thread, NULL, Test_serve, server) != 0) )
+    {
+        fprintf(stderr, "server_rights_test: cannot start the server\n");
+        return EXIT_FAILURE;
+    }
+
+    /*< Start Function Algorithm >*/
+    before = Test_openDescriptors();
+
+    Test_request(path, 2u, 0u);     /*< accepted >*/
+    TEST_CHECK(Test_openDescriptors() == before);
+
+    Test_request(path, 1u, 0u);     /*< too few >*/
+    TEST_CHECK(Test_openDescriptors() == before);
+
+    Test_request(path, 3u, 0u);     /*< too many >*/
+    TEST_CHECK(Test_openDescriptors() == before);
+
+    Test_request(path, 2u, 2u);     /*< a second pair >*/
+    TEST_CHECK(Test_openDescriptors() == before);
+
+    Test_request(path, 2u, 4u);     /*< a second, oversized message >*/
+    TEST_CHECK(Test_openDescriptors() == before);
+
+    /*< Free Memory >*/
+    Frost_serverStop(server);
+    (void)pthread_join(thread, NULL);
+    (void)Frost_freeServer(server);
+    rmdir(directory);
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "server_rights_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("server_rights_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
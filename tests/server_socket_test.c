@@ -0,0 +1,162 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks how the compile server claims and releases its socket
+                path.
+
+    @file       server_socket_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    A live server must not be displaced by a second one, a file
+                that is not a socket must never be removed, a socket left by a
+                dead server must be reclaimed, and freeing a server must not
+                remove a socket that replaced its own.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Feature Macros >*/
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE     /*< mkdtemp() >*/
+#endif
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/*< Implements >*/
+#include "../src/server/server.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_handler
+  @package  Frost_Tests
+
+  @brief    Request handler that is never called.
+ =========================================================================== **/
+static int Test_handler(server_t *server, const server_request_t *request, void *ctx)
+{
+    UNUSED(server);
+    UNUSED(request);
+    UNUSED(ctx);
+
+    return 0;
+}
+
+/** ============================================================================
+  @fn       Test_deadSocket
+  @package  Frost_Tests
+
+  @brief    Leaves a socket file nobody listens on, as a crash would.
+ =========================================================================== **/
+static void Test_deadSocket(const char *path)
+{
+    /*< Variable Declarations >*/
+    struct sockaddr_un address  = { 0 };
+    int fd                      = -1;
+
+    /*< Start Function Algorithm >*/
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    TEST_CHECK(fd >= 0);
+    TEST_CHECK(bind(fd, (struct sockaddr *)&address, sizeof(address)) == 0);
+    close(fd);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    char directory[]        = "/tmp/frost-server-XXXXXX";
+    char path[64]           = { 0 };
+    server_t *first         = NULL;
+    server_t *second        = NULL;
+    struct stat info        = { 0 };
+    int fd                  = -1;
+
+    /*< Security Checks >*/
+    if (mkdtemp(directory) == NULL)
+    {
+        fprintf(stderr, "server_socket_test: cannot create a directory\n");
+        return EXIT_FAILURE;
+    }
+
+    snprintf(path, sizeof(path), "%s/frost.sock", directory);
+
+    /*< A live server keeps its path >*/
+    first = Frost_initServer(path, Test_handler, NULL);
+    TEST_CHECK(first != NULL);
+    TEST_CHECK(lstat(path, &info) == 0);
+    TEST_CHECK((info.st_mode & 0077u) == 0u);
+
+    errno   = 0;
+    second  = Frost_initServer(path, Test_handler, NULL);
+    TEST_CHECK(second == NULL);
+    TEST_CHECK(errno == EADDRINUSE);
+
+    /*< Freeing the server removes its own socket >*/
+    TEST_CHECK(Frost_freeServer(first) == FUNCTION_SUCESS);
+    TEST_CHECK(lstat(path, &info) != 0);
+
+    /*< A socket left by a dead server is reclaimed >*/
+    Test_deadSocket(path);
+    first = Frost_initServer(path, Test_handler, NULL);
+    TEST_CHECK(first != NULL);
+
+    /*< A socket that replaced ours survives Frost_freeServer >*/
+    TEST_CHECK(unlink(path) == 0);
+    Test_deadSocket(path);
+    TEST_CHECK(Frost_freeServer(first) == FUNCTION_SUCESS);
+    TEST_CHECK(lstat(path, &info) == 0);
+    TEST_CHECK(unlink(path) == 0);
+
+    /*< Anything that is not a socket is never removed >*/
+    fd = open(path, O_CREAT | O_WRONLY | O_CLOEXEC, 0600);
+    TEST_CHECK(fd >= 0);
+    close(fd);
+
+    errno   = 0;
+    second  = Frost_initServer(path, Test_handler, NULL);
+    TEST_CHECK(second == NULL);
+    TEST_CHECK(errno == EEXIST);
+    TEST_CHECK( (lstat(path, &info) == 0) && (S_ISREG(info.st_mode)) );
+
+    /*< Free Memory >*/
+    unlink(path);
+    rmdir(directory);
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "server_socket_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("server_socket_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
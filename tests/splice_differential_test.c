@@ -0,0 +1,553 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Differential test: Frost_lexSpliced on a spliced source must
+                produce the tokens Frost_lexStructural produces on the same
+                source with its splices removed.
+
+    @file       splice_differential_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Each case is a logical source, free of splices, with markers
+                where a splice goes: backslash-LF, backslash-CRLF or `??/`-LF.
+                The physical source has the markers expanded, the logical one
+                has them dropped. The spliced engine lexes the physical
+                source; each token must have the type of the matching logical
+                token, and Frost_spliceCopy of its physical extent must give
+                the logical spelling. Extents must also be tight: a splice
+                next to a token is not part of it.
+
+                Fixed cases put splices inside identifiers, operators,
+                numbers, strings and comments, and include a block comment
+                long enough that the stitching window has to be doubled
+                several times. Random cases glue fragments and drop markers
+                at random offsets.
+
+                Usage: splice_differential_test [seed] [cases]
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*< Implements >*/
+#include "../src/lexer/lexer.h"
+#include "../src/splice/splice.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       SPLICE_MAX_SOURCE
+    @brief     Largest logical source, in bytes, markers included.
+============================================================================ **/
+#define SPLICE_MAX_SOURCE           4096u
+
+/** ============================================================================
+    @def       SPLICE_MAX_PHYSICAL
+    @brief     Largest physical source: every marker may grow to 4 bytes.
+============================================================================ **/
+#define SPLICE_MAX_PHYSICAL         (SPLICE_MAX_SOURCE * 4u)
+
+/** ============================================================================
+    @def       SPLICE_MAX_TOKENS
+    @brief     Room for the tokens of one source (at most one per byte, + EOF).
+============================================================================ **/
+#define SPLICE_MAX_TOKENS           (SPLICE_MAX_SOURCE + 1u)
+
+/** ============================================================================
+    @def       SPLICE_MARKER_LF / SPLICE_MARKER_CRLF / SPLICE_MARKER_TRIGRAPH
+    @brief     Bytes standing for a splice in a logical source.
+============================================================================ **/
+#define SPLICE_MARKER_LF            '\x01'
+#define SPLICE_MARKER_CRLF          '\x02'
+#define SPLICE_MARKER_TRIGRAPH      '\x03'
+
+/** ============================================================================
+    @def       SPLICE_FRAGMENTS
+    @brief     Number of source fragments.
+============================================================================ **/
+#define SPLICE_FRAGMENTS            (sizeof(splice_fragments) / sizeof(splice_fragments[0]))
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   spliceStream
+  @package  Frost_Tests
+
+  @typedef  splice_stream_t
+
+  @brief    Token types and spellings collected from one engine.
+============================================================================ **/
+typedef struct spliceStream
+{
+    const char          *source;                            /*< Source the offsets refer to >*/
+    bool                physical;                           /*< Spellings need Frost_spliceCopy >*/
+    token_type_t        types[SPLICE_MAX_TOKENS];           /*< Token types in order >*/
+    size_t              starts[SPLICE_MAX_TOKENS + 1u];     /*< Spelling offsets in text >*/
+    char                text[SPLICE_MAX_PHYSICAL];          /*< Spellings, back to back >*/
+    size_t              count;                              /*< Tokens collected >*/
+    size_t              last_end;                           /*< End of the last token >*/
+    bool                ordered;                            /*< Extents never went backwards >*/
+    bool                tight;                              /*< No extent starts or ends with a splice >*/
+} splice_stream_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Hand-written cases; markers: \x01 backslash-LF, \x02 backslash-CRLF, \x03 ??/-LF >*/
+static const char *const splice_cases[] =
+{
+    "int fro\x01st = 1;\n",
+    "a <\x02<\x03= b; c -\x01> d; e &\x01& f; g >\x03>= 2; h =\x02= i;\n",
+    "x = 12\x01" "345 + 3.\x02" "25f + 0x\x03" "FF + 1e\x01" "10;\n",
+    "s = \"hel\x01lo wor\x02ld\"; c = '\x03x'; e = \"esc \\\x01\" q\";\n",
+    "/* a\x01" "b */ // line \x01 continued\nint after;\n",
+    "\x01\x02\x03int\x01\x01\x02 lead\x03;\x01",
+    "#define MAX(a, b) \x01    ((a) > (b) ? (a) : (b))\nint tail;",
+};
+
+/*< Fragments glued into random logical sources >*/
+static const char *const splice_fragments[] =
+{
+    "a", "_b", "x1", "identifier_long_enough_to_matter", "0", "42", "0x1F", "3.25", "1e10",
+    "2.5f", "+", "-", "*", "/", "=", "==", "!=", "<", "<=", "<<", "<<=", ">>=", "&&", "||",
+    "->", "++", "::", ".", ",", ";", "(", ")", "{", "}", " ", "\t", "\n", "\r\n",
+    "// line comment\n", "/* block */", "/* multi\nline\ncomment */", "\"string\"",
+    "\"esc \\\" q\"", "'c'", "'\\n'", "?", "??", "\\",
+};
+
+/*< Physical spellings of a splice >*/
+static const char *const splice_spellings[] = { "\\\n", "\\\r\n", "?\?/\n" };
+
+static splice_stream_t splice_reference;
+static splice_stream_t splice_spliced;
+
+static char splice_logical[SPLICE_MAX_SOURCE];
+static char splice_marked[SPLICE_MAX_SOURCE];
+static char splice_physical[SPLICE_MAX_PHYSICAL];
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Splice_random
+  @package  Frost_Tests
+
+  @brief    xorshift64* generator, reproducible across platforms.
+ =========================================================================== **/
+static uint64_t Splice_random(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+/** ============================================================================
+  @fn       Splice_expand
+  @package  Frost_Tests
+
+  @brief    Builds the logical and physical sources of a marked source.
+
+  @param    marked    [in]:   Logical source with splice markers.
+  @param    size      [in]:   Bytes of marked.
+  @param    logical   [out]:  Receives the source without markers.
+  @param    physical  [out]:  Receives the source with markers expanded.
+  @param    physical_size [out]: Bytes written to physical.
+
+  @return   Bytes written to logical.
+ =========================================================================== **/
+static size_t Splice_expand(const char *marked, size_t size, char *logical,
+                            char *physical, size_t *physical_size)
+{
+    /*< Variable Declarations >*/
+    size_t logical_size = 0u;
+    size_t written      = 0u;
+    size_t index        = 0u;
+    const char *text    = NULL;
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < size; index++)
+    {
+        if ( (marked[index] >= SPLICE_MARKER_LF) && (marked[index] <= SPLICE_MARKER_TRIGRAPH) )
+        {
+            text = splice_spellings[marked[index] - SPLICE_MARKER_LF];
+            memcpy(physical + written, text, strlen(text));
+            written += strlen(text);
+            continue;
+        }
+
+        logical[logical_size++]  = marked[index];
+        physical[written++]     = marked[index];
+    }
+
+    *physical_size = written;
+
+    /*< Function Output >*/
+    return logical_size;
+}
+
+/** ============================================================================
+  @fn       Splice_edge
+  @package  Frost_Tests
+
+  @brief    Tells whether a lexeme starts or ends with a splice.
+
+  @details  Splices next to a token belong to the whitespace around it, so
+            the spliced engine must leave them out of its extent.
+ =========================================================================== **/
+static bool Splice_edge(const char *lexeme, size_t length)
+{
+    /*< Variable Declarations >*/
+    size_t index    = 0u;
+    size_t size     = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < (sizeof(splice_spellings) / sizeof(splice_spellings[0])); index++)
+    {
+        size = strlen(splice_spellings[index]);
+
+        if ( (length >= size) &&
+             ((memcmp(lexeme, splice_spellings[index], size) == 0) ||
+              (memcmp(lexeme + length - size, splice_spellings[index], size) == 0)) )
+        {
+            return true;
+        }
+    }
+
+    /*< Function Output >*/
+    return false;
+}
+
+/** ============================================================================
+  @fn       Splice_collect
+  @package  Frost_Tests
+
+  @brief    Callback appending the type and spelling of each token.
+ =========================================================================== **/
+static int Splice_collect(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    /*< Variable Declarations >*/
+    splice_stream_t *stream = (splice_stream_t *)ctx;
+    size_t start            = stream->starts[stream->count];
+    size_t written          = 0u;
+
+    /*< Security Checks >*/
+    if ( (stream->count == SPLICE_MAX_TOKENS) || ((start + length) > sizeof(stream->text)) )
+    {
+        return -1;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (offset < stream->last_end)
+    {
+        stream->ordered = false;
+    }
+
+    stream->last_end = offset + length;
+
+    if (stream->physical)
+    {
+        stream->tight = (stream->tight) && (!Splice_edge(stream->source + offset, length));
+        written = Frost_spliceCopy(stream->source + offset, length, stream->text + start);
+    }
+    else
+    {
+        memcpy(stream->text + start, stream->source + offset, length);
+        written = length;
+    }
+
+    stream->types[stream->count]        = type;
+    stream->starts[stream->count + 1u]  = start + written;
+    stream->count++;
+
+    /*< Function Output >*/
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Splice_lex
+  @package  Frost_Tests
+
+  @brief    Lexes a source into a stream, spliced or structural.
+
+  @return   Value returned by the engine.
+ =========================================================================== **/
+static int Splice_lex(const char *source, size_t size, bool physical, splice_stream_t *stream)
+{
+    /*< Variable Declarations >*/
+    lexer_t *lexer  = NULL;
+    int ret         = FUNCTION_SUCESS;
+
+    /*< Start Function Algorithm >*/
+    stream->source      = source;
+    stream->physical    = physical;
+    stream->count       = 0u;
+    stream->starts[0]   = 0u;
+    stream->last_end    = 0u;
+    stream->ordered     = true;
+    stream->tight       = true;
+
+    lexer = Frost_initLexerView(source, size);
+    if (lexer == NULL)
+    {
+        return -1;
+    }
+
+    ret = physical ? Frost_lexSpliced(lexer, Splice_collect, stream)
+                   : Frost_lexStructural(lexer, Splice_collect, stream);
+
+    (void)Frost_freeLexer(lexer);
+
+    /*< Function Output >*/
+    return ret;
+}
+
+/** ============================================================================
+  @fn       Splice_diverges
+  @package  Frost_Tests
+
+  @brief    Finds the first token whose type or spelling differs.
+
+  @return   Index of that token, or the common count if none differs.
+ =========================================================================== **/
+static size_t Splice_diverges(void)
+{
+    /*< Variable Declarations >*/
+    const splice_stream_t *left     = &splice_reference;
+    const splice_stream_t *right    = &splice_spliced;
+    size_t token                    = 0u;
+    size_t left_length              = 0u;
+    size_t right_length             = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (token = 0u; (token < left->count) && (token < right->count); token++)
+    {
+        left_length     = left->starts[token + 1u] - left->starts[token];
+        right_length    = right->starts[token + 1u] - right->starts[token];
+
+        if ( (left->types[token] != right->types[token]) || (left_length != right_length) ||
+             (memcmp(left->text + left->starts[token], right->text + right->starts[token], left_length) != 0) )
+        {
+            break;
+        }
+    }
+
+    /*< Function Output >*/
+    return token;
+}
+
+/** ============================================================================
+  @fn       Splice_print
+  @package  Frost_Tests
+
+  @brief    Prints a source with control bytes escaped.
+ =========================================================================== **/
+static void Splice_print(const char *label, const char *source, size_t size)
+{
+    /*< Variable Declarations >*/
+    size_t byte = 0u;
+
+    /*< Start Function Algorithm >*/
+    fprintf(stderr, "  %s: \"", label);
+    for (byte = 0u; byte < size; byte++)
+    {
+        fprintf(stderr, ((unsigned char)source[byte] < 0x20u) ? "\\x%02x" : "%c", (unsigned char)source[byte]);
+    }
+    fprintf(stderr, "\"\n");
+}
+
+/** ============================================================================
+  @fn       Splice_check
+  @package  Frost_Tests
+
+  @brief    Runs one marked source through both engines and compares them.
+
+  @return   true if the streams match.
+ =========================================================================== **/
+static bool Splice_check(const char *name, size_t index, const char *marked, size_t size)
+{
+    /*< Variable Declarations >*/
+    size_t logical_size     = 0u;
+    size_t physical_size    = 0u;
+    size_t token            = 0u;
+    int reference_ret       = 0;
+    int spliced_ret         = 0;
+
+    /*< Start Function Algorithm >*/
+    logical_size = Splice_expand(marked, size, splice_logical, splice_physical, &physical_size);
+
+    reference_ret   = Splice_lex(splice_logical, logical_size, false, &splice_reference);
+    spliced_ret     = Splice_lex(splice_physical, physical_size, true, &splice_spliced);
+    token           = Splice_diverges();
+
+    if ( (reference_ret == spliced_ret) && (splice_reference.count == splice_spliced.count) &&
+         (token == splice_reference.count) && (splice_spliced.ordered) && (splice_spliced.tight) &&
+         (splice_spliced.last_end == physical_size) )
+    {
+        return true;
+    }
+
+    /*< Function Output >*/
+    fprintf(stderr, "%s %zu: token %zu differs (%zu vs %zu tokens, ordered %d, tight %d)\n",
+            name, index, token, splice_reference.count, splice_spliced.count,
+            (int)splice_spliced.ordered, (int)splice_spliced.tight);
+    Splice_print("logical", splice_logical, logical_size);
+    Splice_print("physical", splice_physical, physical_size);
+    return false;
+}
+
+/** ============================================================================
+  @fn       Splice_longComment
+  @package  Frost_Tests
+
+  @brief    Builds a block comment over many logical lines, each holding
+            splices of every spelling, between two declarations.
+
+  @return   Bytes written to marked.
+ =========================================================================== **/
+static size_t Splice_longComment(char *marked)
+{
+    /*< Variable Declarations >*/
+    size_t size = 0u;
+    size_t line = 0u;
+
+    /*< Start Function Algorithm >*/
+    size += (size_t)sprintf(marked + size, "int before = 1;\n/* opening\x01");
+
+    for (line = 0u; line < 48u; line++)
+    {
+        size += (size_t)sprintf(marked + size, "line %zu of the comment \x02" "continued \x03" "here\n", line);
+    }
+
+    size += (size_t)sprintf(marked + size, "closing *\x01/ int af\x03ter = 2;\n");
+
+    /*< Function Output >*/
+    return size;
+}
+
+/** ============================================================================
+  @fn       Splice_generate
+  @package  Frost_Tests
+
+  @brief    Fills a buffer with a random splice-free source, then drops
+            markers at random offsets.
+
+  @return   Number of bytes written, 0 if the glued text held a splice.
+ =========================================================================== **/
+static size_t Splice_generate(uint64_t *state, char *marked)
+{
+    /*< Variable Declarations >*/
+    splice_map_t map    = { NULL, 0u, 0u };
+    size_t target       = 1u + (size_t)(Splice_random(state) % 600u);
+    size_t size         = 0u;
+    size_t length       = 0u;
+    size_t markers      = 1u + (size_t)(Splice_random(state) % 8u);
+    size_t at           = 0u;
+    const char *piece   = NULL;
+
+    /*< Glued fragments >*/
+    while (size < target)
+    {
+        piece   = splice_fragments[Splice_random(state) % SPLICE_FRAGMENTS];
+        length  = strlen(piece);
+        if ((size + length + markers) > SPLICE_MAX_SOURCE)
+        {
+            break;
+        }
+
+        memcpy(marked + size, piece, length);
+        size += length;
+    }
+
+    /*< A fragment pair may have spelled a splice itself >*/
+    if ( (Frost_spliceScan(marked, size, &map) != FUNCTION_SUCESS) || (map.count != 0u) )
+    {
+        Frost_spliceRelease(&map);
+        return 0u;
+    }
+
+    Frost_spliceRelease(&map);
+
+    /*< Markers, anywhere >*/
+    for (; markers > 0u; markers--)
+    {
+        at = (size_t)(Splice_random(state) % (size + 1u));
+        memmove(marked + at + 1u, marked + at, size - at);
+        marked[at] = (char)(SPLICE_MARKER_LF + (char)(Splice_random(state) % 3u));
+        size++;
+    }
+
+    /*< Function Output >*/
+    return size;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(int argc, char **argv)
+{
+    /*< Variable Declarations >*/
+    uint64_t seed       = (argc > 1) ? (uint64_t)strtoull(argv[1], NULL, 10) : 1u;
+    size_t cases        = (argc > 2) ? (size_t)strtoul(argv[2], NULL, 10) : 5000u;
+    uint64_t state      = (seed * UINT64_C(0x9E3779B97F4A7C15)) | 1u;
+    size_t index        = 0u;
+    size_t size         = 0u;
+    size_t run          = 0u;
+
+    /*< Fixed cases >*/
+    for (index = 0u; index < (sizeof(splice_cases) / sizeof(splice_cases[0])); index++)
+    {
+        TEST_CHECK(Splice_check("case", index, splice_cases[index], strlen(splice_cases[index])));
+    }
+
+    size = Splice_longComment(splice_marked);
+    TEST_CHECK(Splice_check("long comment", 0u, splice_marked, size));
+    TEST_CHECK( (splice_spliced.count == 5u + 1u + 5u + 1u) && (splice_spliced.types[5] == TOKEN_COMMENT) );
+
+    /*< Random cases >*/
+    for (index = 0u; (index < cases) && (test_failures < 5); index++)
+    {
+        size = Splice_generate(&state, splice_marked);
+        if (size == 0u)
+        {
+            continue;
+        }
+
+        TEST_CHECK(Splice_check("seed case", index, splice_marked, size));
+        run++;
+    }
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "splice_differential_test: %d check(s) failed (seed %llu)\n",
+                test_failures, (unsigned long long)seed);
+        return EXIT_FAILURE;
+    }
+
+    printf("splice_differential_test: ok (%zu cases, seed %llu)\n", run, (unsigned long long)seed);
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
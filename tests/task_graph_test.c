@@ -0,0 +1,238 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks that the task graph tells allocation failures apart
+                from dependency cycles.
+
+    @file       task_graph_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Runs a chain of nodes under an allocator that fails a chosen
+                FROST_MEM_GRAPH allocation, so that the topological sort of
+                Frost_taskGraphRun and Frost_taskGraphCriticalPath runs out
+                of memory. Both must report -ENOMEM, while a graph with a real
+                cycle still reports -ELOOP.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include "../src/allocator/allocator.h"
+#include "../src/scheduler/scheduler.h"
+#include "../src/task_graph/task_graph.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TEST_NODES
+    @brief     Nodes of the test chain.
+============================================================================ **/
+#define TEST_NODES                  3u
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Allocator wrapped by the failing one >*/
+static const frost_allocator_t *test_inner = NULL;
+
+/*< Graph allocations left before one fails; 0 never fails >*/
+static size_t test_fail_after = 0u;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_alloc
+  @package  Frost_Tests
+
+  @brief    Fails the armed FROST_MEM_GRAPH allocation, forwards the others.
+ =========================================================================== **/
+static void *Test_alloc(void *ctx, size_t size, size_t alignment, frost_mem_tag_t tag)
+{
+    /*< Start Function Algorithm >*/
+    UNUSED(ctx);
+
+    if ( (tag == FROST_MEM_GRAPH) && (test_fail_after != 0u) && (--test_fail_after == 0u) )
+    {
+        return NULL;
+    }
+
+    /*< Function Output >*/
+    return test_inner->alloc(test_inner->ctx, size, alignment, tag);
+}
+
+/** ============================================================================
+  @fn       Test_realloc
+  @package  Frost_Tests
+
+  @brief    Forwards a reallocation.
+ =========================================================================== **/
+static void *Test_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size, frost_mem_tag_t tag)
+{
+    UNUSED(ctx);
+    return test_inner->realloc(test_inner->ctx, ptr, old_size, new_size, tag);
+}
+
+/** ============================================================================
+  @fn       Test_free
+  @package  Frost_Tests
+
+  @brief    Forwards a release.
+ =========================================================================== **/
+static void Test_free(void *ctx, void *ptr, size_t size, frost_mem_tag_t tag)
+{
+    UNUSED(ctx);
+    test_inner->free(test_inner->ctx, ptr, size, tag);
+}
+
+/** ============================================================================
+  @fn       Test_node
+  @package  Frost_Tests
+
+  @brief    Node body: counts its executions.
+ =========================================================================== **/
+static int Test_node(void *arg)
+{
+    (*(size_t *)arg)++;
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Test_chain
+  @package  Frost_Tests
+
+  @brief    Builds a chain of TEST_NODES nodes, optionally closed in a cycle.
+ =========================================================================== **/
+static task_graph_t *Test_chain(size_t *runs, bool cycle)
+{
+    /*< Variable Declarations >*/
+    task_graph_t *graph         = NULL;
+    size_t ids[TEST_NODES]      = { 0 };
+    size_t index                = 0u;
+
+    /*< Allocate Memory >*/
+    graph = Frost_initTaskGraph();
+    TEST_CHECK(graph != NULL);
+    if (graph == NULL)
+    {
+        return NULL;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < TEST_NODES; index++)
+    {
+        TEST_CHECK(Frost_taskGraphAddNode(graph, "node", BUILD_PHASE_LEX, Test_node, runs,
+                                          &ids[index]) == FUNCTION_SUCESS);
+        if (index > 0u)
+        {
+            TEST_CHECK(Frost_taskGraphAddEdge(graph, ids[index - 1u], ids[index]) == FUNCTION_SUCESS);
+        }
+    }
+
+    if (cycle)
+    {
+        TEST_CHECK(Frost_taskGraphAddEdge(graph, ids[TEST_NODES - 1u], ids[0]) == FUNCTION_SUCESS);
+    }
+
+    /*< Function Output >*/
+    return graph;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    frost_allocator_t allocator         = { Test_alloc, Test_realloc, Test_free, NULL };
+    const frost_allocator_t *previous   = NULL;
+    scheduler_t *scheduler              = NULL;
+    task_graph_t *graph                 = NULL;
+    size_t path[TEST_NODES]             = { 0 };
+    size_t length                       = 0u;
+    uint64_t total_ns                   = 0u;
+    size_t runs                         = 0u;
+
+    /*< Allocate Memory >*/
+    test_inner  = Frost_allocatorDefault();
+    previous    = Frost_allocatorSet(&allocator);
+
+    scheduler = Frost_initScheduler(2u);
+    if (scheduler == NULL)
+    {
+        fprintf(stderr, "task_graph_test: cannot create the scheduler\n");
+        return EXIT_FAILURE;
+    }
+
+    /*< Out of memory in the sort of a run: order, then indegrees >*/
+    graph = Test_chain(&runs, false);
+    if (graph != NULL)
+    {
+        test_fail_after = 2u;
+        TEST_CHECK(Frost_taskGraphRun(graph, scheduler) == -ENOMEM);
+        TEST_CHECK(runs == 0u);
+
+        test_fail_after = 0u;
+        TEST_CHECK(Frost_taskGraphRun(graph, scheduler) == FUNCTION_SUCESS);
+        TEST_CHECK(runs == TEST_NODES);
+
+        /*< Out of memory in the sort of the critical path: order, prev, dist, then indegrees >*/
+        test_fail_after = 4u;
+        TEST_CHECK(Frost_taskGraphCriticalPath(graph, path, TEST_NODES, &length, &total_ns) == -ENOMEM);
+
+        test_fail_after = 0u;
+        TEST_CHECK(Frost_taskGraphCriticalPath(graph, path, TEST_NODES, &length, &total_ns) == FUNCTION_SUCESS);
+        TEST_CHECK(length == TEST_NODES);
+
+        Frost_freeTaskGraph(graph);
+    }
+
+    /*< A real cycle is still a cycle >*/
+    runs    = 0u;
+    graph   = Test_chain(&runs, true);
+    if (graph != NULL)
+    {
+        TEST_CHECK(Frost_taskGraphRun(graph, scheduler) == -ELOOP);
+        TEST_CHECK(runs == 0u);
+        TEST_CHECK(Frost_taskGraphCriticalPath(graph, path, TEST_NODES, &length, &total_ns) == FUNCTION_SUCESS);
+        TEST_CHECK(length == 0u);
+
+        Frost_freeTaskGraph(graph);
+    }
+
+    /*< Free Memory >*/
+    Frost_freeScheduler(scheduler);
+    (void)Frost_allocatorSet(previous);
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "task_graph_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("task_graph_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
@@ -0,0 +1,56 @@
+/** ============================================================================
+    @addtogroup FrostCompiler_Tests
+    @package    Frost_Tests
+
+    @brief      Check macro and failure counter shared by the tests.
+
+    @file       test.h
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Every test is a single translation unit built into its own
+                program, so the counter is a static of that program. A test
+                reports its checks with TEST_CHECK and exits with
+                EXIT_FAILURE when test_failures is not 0.
+ =========================================================================== **/
+
+#ifndef FROST_TEST_H_
+#define FROST_TEST_H_
+
+/* ========================================================================== *\
+ *                               INCLUDED FILES                               *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+
+/* ========================================================================== *\
+ *                              PUBLIC DEFINITIONS                            *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TEST_CHECK
+    @brief     Reports a failed condition and counts it.
+============================================================================ **/
+#define TEST_CHECK(condition)                                                 \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            fprintf(stderr, "%s:%d: check failed: %s\n",                      \
+                    __FILE__, __LINE__, #condition);                          \
+            test_failures++;                                                  \
+        }                                                                     \
+    } while (0)
+
+/* ========================================================================== *\
+ *                              PUBLIC VARIABLES                              *
+\* ========================================================================== */
+
+/*< Number of failed checks of the running test >*/
+static int test_failures = 0;
+
+#endif /* FROST_TEST_H_ */
+
+/*< end of header file >*/
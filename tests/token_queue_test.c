@@ -0,0 +1,194 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks the pipelined token queue: same tokens as the lexer,
+                and no busy waiting on a full ring.
+
+    @file       token_queue_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The consumer compares every popped token with a second lexer
+                run on the caller thread, pausing now and then so that the
+                producer fills the ring. While the consumer sleeps, the
+                process must not burn CPU: the producer has to block rather
+                than spin. Finally, a queue is freed while its producer sleeps
+                on a full ring, which must wake it up.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*< Implements >*/
+#include "../src/token_queue/token_queue.h"
+#include "../src/lexer/lexer.h"
+#include "../src/token/token.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TEST_CAPACITY
+    @brief     Ring capacity, small so that it fills quickly.
+============================================================================ **/
+#define TEST_CAPACITY               128u
+
+/** ============================================================================
+    @def       TEST_PAUSE_NS
+    @brief     How long the consumer stalls with a full ring.
+============================================================================ **/
+#define TEST_PAUSE_NS               200000000L
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const char test_unit[] =
+    "int value = compute(alpha, 0x10) + 2.5; /* note */ name->field[3] <<= 1;\n";
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_cpuSeconds
+  @package  Frost_Tests
+
+  @brief    CPU time used by the whole process, in seconds.
+ =========================================================================== **/
+static double Test_cpuSeconds(void)
+{
+    struct timespec now = { 0, 0 };
+
+    (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/** ============================================================================
+  @fn       Test_pause
+  @package  Frost_Tests
+
+  @brief    Stalls the consumer.
+
+  @return   CPU seconds the process used meanwhile.
+ =========================================================================== **/
+static double Test_pause(void)
+{
+    struct timespec pause   = { 0, TEST_PAUSE_NS };
+    double start            = Test_cpuSeconds();
+
+    (void)nanosleep(&pause, NULL);
+
+    return Test_cpuSeconds() - start;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    size_t size             = (sizeof(test_unit) - 1u) * 2000u;
+    char *source            = NULL;
+    lexer_t *piped          = NULL;
+    lexer_t *direct         = NULL;
+    token_queue_t *queue    = NULL;
+    token_t *popped         = NULL;
+    token_view_t expected   = { 0 };
+    size_t count            = 0u;
+    size_t offset           = 0u;
+    double busy             = 0.0;
+    bool done               = false;
+
+    /*< Allocate Memory >*/
+    source = (char *)malloc(size);
+    if (source == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    for (offset = 0u; offset < size; offset += sizeof(test_unit) - 1u)
+    {
+        memcpy(source + offset, test_unit, sizeof(test_unit) - 1u);
+    }
+
+    piped   = Frost_initLexerView(source, size);
+    direct  = Frost_initLexerView(source, size);
+    queue   = (piped != NULL) ? Frost_initTokenQueue(piped, TEST_CAPACITY) : NULL;
+    if ( (direct == NULL) || (queue == NULL) )
+    {
+        fprintf(stderr, "token_queue_test: setup failed\n");
+        return EXIT_FAILURE;
+    }
+
+    /*< Same Tokens as the Lexer, with Stalls on a Full Ring >*/
+    while (!done)
+    {
+        if ((count % 16000u) == 0u)
+        {
+            busy = MAX(busy, Test_pause());
+        }
+
+        popped = Frost_tokenQueuePop(queue);
+        (void)Frost_nextTokenInto(direct, &expected);
+
+        TEST_CHECK(popped != NULL);
+        if (popped == NULL)
+        {
+            break;
+        }
+
+        TEST_CHECK(popped->type == expected.type);
+        TEST_CHECK(strlen(popped->lexeme) == expected.length);
+
+        done = (popped->type == TOKEN_EOF);
+        (void)Frost_freeToken(popped);
+        count++;
+    }
+
+    TEST_CHECK(Frost_tokenQueuePop(queue) == NULL);
+    TEST_CHECK(Frost_freeTokenQueue(queue) == FUNCTION_SUCESS);
+
+    /*< A sleeping producer costs nothing: allow a tenth of the pause >*/
+    TEST_CHECK(busy < ((double)TEST_PAUSE_NS / 1e9 / 10.0));
+
+    /*< Freeing Wakes a Producer Asleep on a Full Ring >*/
+    TEST_CHECK(Frost_lexerResetView(piped, source, size) == FUNCTION_SUCESS);
+    queue = Frost_initTokenQueue(piped, TEST_CAPACITY);
+    TEST_CHECK(queue != NULL);
+    (void)Test_pause();
+    TEST_CHECK(Frost_freeTokenQueue(queue) == FUNCTION_SUCESS);
+
+    /*< Free Memory >*/
+    (void)Frost_freeLexer(direct);
+    (void)Frost_freeLexer(piped);
+    free(source);
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "token_queue_test: %d check(s) failed (%.3f s busy while stalled)\n",
+                test_failures, busy);
+        return EXIT_FAILURE;
+    }
+
+    printf("token_queue_test: ok (%zu tokens)\n", count);
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
@@ -0,0 +1,178 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks that tokens give their memory back with its real size.
+
+    @file       token_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    The accounting allocator reads sizes from its own headers, so
+                it cannot tell a wrong size passed to Frost_memFree. The test
+                installs an allocator that trusts the caller instead, the way
+                an arena or a size-class pool does, and balances the bytes of
+                FROST_MEM_TOKEN over tokens built both ways.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*< Implements >*/
+#include "../src/allocator/allocator.h"
+#include "../src/token/token.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const frost_allocator_t *test_inner = NULL;
+
+/*< Bytes of FROST_MEM_TOKEN allocated minus the sizes given back >*/
+static long long test_token_bytes = 0;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_alloc
+  @package  Frost_Tests
+
+  @brief    Counts the bytes of token allocations and forwards them.
+ =========================================================================== **/
+static void *Test_alloc(void *ctx, size_t size, size_t alignment, frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    void *ptr_out = NULL;
+
+    /*< Start Function Algorithm >*/
+    UNUSED(ctx);
+
+    ptr_out = test_inner->alloc(test_inner->ctx, size, alignment, tag);
+    if ( (ptr_out != NULL) && (tag == FROST_MEM_TOKEN) )
+    {
+        test_token_bytes += (long long)size;
+    }
+
+    /*< Function Output >*/
+    return ptr_out;
+}
+
+/** ============================================================================
+  @fn       Test_realloc
+  @package  Frost_Tests
+
+  @brief    Forwards a reallocation, counting the change of a token block.
+ =========================================================================== **/
+static void *Test_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size, frost_mem_tag_t tag)
+{
+    /*< Variable Declarations >*/
+    void *ptr_out = NULL;
+
+    /*< Start Function Algorithm >*/
+    UNUSED(ctx);
+
+    ptr_out = test_inner->realloc(test_inner->ctx, ptr, old_size, new_size, tag);
+    if ( (ptr_out != NULL) && (tag == FROST_MEM_TOKEN) )
+    {
+        test_token_bytes += (long long)new_size - (long long)old_size;
+    }
+
+    /*< Function Output >*/
+    return ptr_out;
+}
+
+/** ============================================================================
+  @fn       Test_free
+  @package  Frost_Tests
+
+  @brief    Subtracts the size the caller gives back, then forwards.
+ =========================================================================== **/
+static void Test_free(void *ctx, void *ptr, size_t size, frost_mem_tag_t tag)
+{
+    /*< Start Function Algorithm >*/
+    UNUSED(ctx);
+
+    if ( (ptr != NULL) && (tag == FROST_MEM_TOKEN) )
+    {
+        test_token_bytes -= (long long)size;
+    }
+
+    test_inner->free(test_inner->ctx, ptr, size, tag);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    static const char source[]          = "return count;";
+    frost_allocator_t allocator         = { Test_alloc, Test_realloc, Test_free, NULL };
+    const frost_allocator_t *previous   = NULL;
+    token_t *token                      = NULL;
+
+    /*< Allocate Memory >*/
+    test_inner  = Frost_allocatorDefault();
+    previous    = Frost_allocatorSet(&allocator);
+
+    /*< From a string >*/
+    token = Frost_initToken("identifier", TOKEN_ID);
+    TEST_CHECK(token != NULL);
+    if (token != NULL)
+    {
+        TEST_CHECK( (token->length == 10u) && (strcmp(token->lexeme, "identifier") == 0) );
+        TEST_CHECK(Frost_freeToken(token) == FUNCTION_SUCESS);
+    }
+
+    TEST_CHECK(test_token_bytes == 0);
+
+    /*< From a span of a larger buffer >*/
+    token = Frost_initTokenSpan(source + 7u, 5u, TOKEN_ID);
+    TEST_CHECK(token != NULL);
+    if (token != NULL)
+    {
+        TEST_CHECK( (token->length == 5u) && (strcmp(token->lexeme, "count") == 0) );
+        TEST_CHECK(Frost_freeToken(token) == FUNCTION_SUCESS);
+    }
+
+    TEST_CHECK(test_token_bytes == 0);
+
+    /*< Empty lexeme >*/
+    token = Frost_initTokenSpan(source, 0u, TOKEN_EOF);
+    TEST_CHECK(token != NULL);
+    if (token != NULL)
+    {
+        TEST_CHECK( (token->length == 0u) && (token->lexeme[0] == '\0') );
+        TEST_CHECK(Frost_freeToken(token) == FUNCTION_SUCESS);
+    }
+
+    TEST_CHECK(test_token_bytes == 0);
+
+    /*< Free Memory >*/
+    (void)Frost_allocatorSet(previous);
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "token_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("token_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
@@ -0,0 +1,178 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks that lex spans leave the time of token consumers out.
+
+    @file       trace_suspend_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    Lexes a source through both callback APIs with the time report
+                on, while the callback sleeps for every token. The lex phase
+                of the report must stay well below the time slept, and the
+                sleeping itself must be seen outside TRACE_PHASE_LEX.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*< Implements >*/
+#include "../src/time_trace/time_trace.h"
+#include "../src/lexer/lexer.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TEST_SLEEP_NS
+    @brief     Time the callback sleeps for each token.
+============================================================================ **/
+#define TEST_SLEEP_NS               (1000000L)
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+static const char test_source[] =
+    "static int frost_sum(const int *values, int count)\n"
+    "{\n"
+    "    int total = 0;\n"
+    "    for (int i = 0; i < count; i++) { total += values[i]; }\n"
+    "    return total;\n"
+    "}\n";
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_sleepingCallback
+  @package  Frost_Tests
+
+  @brief    Slow token consumer, checking it runs outside the lex phase.
+ =========================================================================== **/
+static int Test_sleepingCallback(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    /*< Variable Declarations >*/
+    size_t *count               = (size_t *)ctx;
+    struct timespec duration    = { 0, TEST_SLEEP_NS };
+
+    /*< Start Function Algorithm >*/
+    UNUSED(type);
+    UNUSED(offset);
+    UNUSED(length);
+
+    TEST_CHECK(Frost_tracePhaseCurrent() != TRACE_PHASE_LEX);
+    (void)nanosleep(&duration, NULL);
+    (*count)++;
+
+    /*< Function Output >*/
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Test_reportedWall
+  @package  Frost_Tests
+
+  @brief    Reads the wall time and span count of a phase from the report.
+ =========================================================================== **/
+static int Test_reportedWall(trace_phase_t phase, double *wall_ms, unsigned long *spans)
+{
+    /*< Variable Declarations >*/
+    FILE *stream    = NULL;
+    char line[256]  = { 0 };
+    char name[32]   = { 0 };
+    double cpu_ms   = 0.0;
+    int found       = 0;
+
+    /*< Allocate Memory >*/
+    stream = tmpfile();
+    if (stream == NULL)
+    {
+        return 0;
+    }
+
+    /*< Start Function Algorithm >*/
+    if (Frost_timeTraceReport(stream) == FUNCTION_SUCESS)
+    {
+        rewind(stream);
+
+        while ( (found == 0) && (fgets(line, sizeof(line), stream) != NULL) )
+        {
+            if ( (sscanf(line, "%31s %lf %lf %lu", name, wall_ms, &cpu_ms, spans) == 4) &&
+                 (strcmp(name, Frost_tracePhaseName(phase)) == 0) )
+            {
+                found = 1;
+            }
+        }
+    }
+
+    /*< Free Memory >*/
+    fclose(stream);
+
+    /*< Function Output >*/
+    return found;
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Variable Declarations >*/
+    lexer_t *lexer      = NULL;
+    size_t tokens       = 0u;
+    double slept_ms     = 0.0;
+    double lex_ms       = 0.0;
+    unsigned long spans = 0u;
+
+    /*< Allocate Memory >*/
+    lexer = Frost_initLexerView(test_source, sizeof(test_source) - 1u);
+    if ( (lexer == NULL) || (Frost_timeTraceEnable(TIME_TRACE_REPORT, NULL) != FUNCTION_SUCESS) )
+    {
+        fprintf(stderr, "trace_suspend_test: setup failed\n");
+        return EXIT_FAILURE;
+    }
+
+    /*< Start Function Algorithm >*/
+    TEST_CHECK(Frost_lexWithCallback(lexer, Test_sleepingCallback, &tokens) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_lexerResetView(lexer, test_source, sizeof(test_source) - 1u) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_lexStructural(lexer, Test_sleepingCallback, &tokens) == FUNCTION_SUCESS);
+
+    slept_ms = (double)tokens * ((double)TEST_SLEEP_NS / 1e6);
+
+    TEST_CHECK(Test_reportedWall(TRACE_PHASE_LEX, &lex_ms, &spans) == 1);
+    TEST_CHECK(spans == 2u);
+    TEST_CHECK(lex_ms < (slept_ms / 4.0));
+
+    /*< Free Memory >*/
+    Frost_freeLexer(lexer);
+    (void)Frost_timeTraceFinish();
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "trace_suspend_test: %d check(s) failed (lex %.3f ms, slept %.3f ms)\n",
+                test_failures, lex_ms, slept_ms);
+        return EXIT_FAILURE;
+    }
+
+    printf("trace_suspend_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/
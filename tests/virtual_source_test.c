@@ -0,0 +1,394 @@
+/** ===========================================================================
+    @ingroup    FrostCompiler
+    @addtogroup FrostCompiler_Tests Frost_Tests
+
+    @package    Frost_Tests
+    @brief      Checks position mapping and lexing of a virtual source.
+
+    @file       virtual_source_test.c
+
+    @author     Rafael V. Volkmer <rafael.v.volkmer@gmail.com>
+    @date       17.10.2026
+
+    @details    A unit including the same header twice is assembled from
+                pieces of two buffers. Since pieces split between tokens, the
+                virtual source must lex exactly like the concatenation of its
+                pieces: the test lexes a contiguous copy with
+                Frost_lexStructural and compares both virtual entry points
+                against it, positions included.
+ =========================================================================== **/
+
+/* ========================================================================== *\
+ *                              INCLUDED FILES                                *
+\* ========================================================================== */
+
+/*< Dependencies >*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/*< Implements >*/
+#include "../src/virtual_source/virtual_source.h"
+#include "../src/lexer/lexer.h"
+#include "../inc/utils.h"
+#include "test.h"
+
+/* ========================================================================== *\
+ *                              PRIVATE DEFINITIONS                           *
+\* ========================================================================== */
+
+/** ============================================================================
+    @def       TEST_MAX_TOKENS
+    @brief     Room for the tokens of the test unit.
+============================================================================ **/
+#define TEST_MAX_TOKENS             128u
+
+/** ============================================================================
+    @def       TEST_PIECES
+    @brief     Number of pieces of the test unit.
+============================================================================ **/
+#define TEST_PIECES                 (sizeof(test_pieces) / sizeof(test_pieces[0]))
+
+/* ========================================================================== *\
+ *                              PRIVATE STRUCTURES                            *
+\* ========================================================================== */
+
+/** ============================================================================
+  @struct   testPiece
+  @package  Frost_Tests
+
+  @typedef  test_piece_t
+
+  @brief    Range of a test file appended to the virtual source.
+============================================================================ **/
+typedef struct testPiece
+{
+    uint32_t            file;           /*< 0 for the unit, 1 for the header >*/
+    size_t              offset;         /*< First byte in the file >*/
+    size_t              length;         /*< Bytes of the range >*/
+} test_piece_t;
+
+/** ============================================================================
+  @struct   testStream
+  @package  Frost_Tests
+
+  @typedef  test_stream_t
+
+  @brief    Tokens collected from one entry point.
+============================================================================ **/
+typedef struct testStream
+{
+    token_view_t        tokens[TEST_MAX_TOKENS];    /*< Tokens in order, lexeme unset >*/
+    size_t              count;                      /*< Entries used >*/
+} test_stream_t;
+
+/* ========================================================================== *\
+ *                              PRIVATE VARIABLES                             *
+\* ========================================================================== */
+
+/*< Unit, with its #include lines at offsets 11 and 37 >*/
+static const char test_unit[] =
+    "int a = 1;\n"
+    "#include \"b.h\"\n"
+    "int c = 2;\n"
+    "#include \"b.h\"\n"
+    "int d = a + c;\n";
+
+static const char test_header[] =
+    "int b(int x) { return x << 1; }\n";
+
+/*< The unit with both #include lines replaced by the header >*/
+static const test_piece_t test_pieces[] =
+{
+    { 0u, 0u,  11u },
+    { 1u, 0u,  sizeof(test_header) - 1u },
+    { 0u, 26u, 11u },
+    { 1u, 0u,  sizeof(test_header) - 1u },
+    { 0u, 52u, 15u },
+};
+
+static test_stream_t test_expected;
+static test_stream_t test_pulled;
+static test_stream_t test_streamed;
+
+/* ========================================================================== *\
+ *                      PRIVATE FUNCTIONS IMPLEMENTATION                      *
+\* ========================================================================== */
+
+/** ============================================================================
+  @fn       Test_collect
+  @package  Frost_Tests
+
+  @brief    Callback appending each token to a stream.
+ =========================================================================== **/
+static int Test_collect(token_type_t type, size_t offset, size_t length, void *ctx)
+{
+    /*< Variable Declarations >*/
+    test_stream_t *stream = (test_stream_t *)ctx;
+
+    /*< Security Checks >*/
+    if (stream->count == TEST_MAX_TOKENS)
+    {
+        return -1;
+    }
+
+    /*< Start Function Algorithm >*/
+    stream->tokens[stream->count++] = (token_view_t){ NULL, offset, length, type };
+
+    /*< Function Output >*/
+    return FUNCTION_SUCESS;
+}
+
+/** ============================================================================
+  @fn       Test_same
+  @package  Frost_Tests
+
+  @brief    Compares two streams, lexemes aside.
+ =========================================================================== **/
+static bool Test_same(const test_stream_t *left, const test_stream_t *right)
+{
+    /*< Variable Declarations >*/
+    size_t index = 0u;
+
+    /*< Security Checks >*/
+    if (left->count != right->count)
+    {
+        return false;
+    }
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < left->count; index++)
+    {
+        if ( (left->tokens[index].type != right->tokens[index].type) ||
+             (left->tokens[index].offset != right->tokens[index].offset) ||
+             (left->tokens[index].length != right->tokens[index].length) )
+        {
+            return false;
+        }
+    }
+
+    /*< Function Output >*/
+    return true;
+}
+
+/** ============================================================================
+  @fn       Test_eofCount
+  @package  Frost_Tests
+
+  @brief    Counts the TOKEN_EOF tokens of a stream.
+ =========================================================================== **/
+static size_t Test_eofCount(const test_stream_t *stream)
+{
+    /*< Variable Declarations >*/
+    size_t index = 0u;
+    size_t count = 0u;
+
+    /*< Start Function Algorithm >*/
+    for (index = 0u; index < stream->count; index++)
+    {
+        count += (stream->tokens[index].type == TOKEN_EOF) ? 1u : 0u;
+    }
+
+    /*< Function Output >*/
+    return count;
+}
+
+/** ============================================================================
+  @fn       Test_locate
+  @package  Frost_Tests
+
+  @brief    Checks that a position maps to a file and an offset.
+ =========================================================================== **/
+static void Test_locate(const virtual_source_t *source, size_t position, uint32_t file, size_t offset)
+{
+    /*< Variable Declarations >*/
+    source_location_t location = { 0u, 0u };
+
+    /*< Start Function Algorithm >*/
+    TEST_CHECK(Frost_virtualSourceLocate(source, position, &location) == FUNCTION_SUCESS);
+    if ( (location.file != file) || (location.offset != offset) )
+    {
+        fprintf(stderr, "position %zu: file %u offset %zu, expected file %u offset %zu\n",
+                position, (unsigned)location.file, location.offset, (unsigned)file, offset);
+        test_failures++;
+    }
+}
+
+/** ============================================================================
+  @fn       Test_pieces
+  @package  Frost_Tests
+
+  @brief    Checks Locate and both lexing entry points on the test unit.
+ =========================================================================== **/
+static void Test_pieces(void)
+{
+    /*< Variable Declarations >*/
+    static char joined[sizeof(test_unit) + (2u * sizeof(test_header))];
+    const char *const buffers[2]    = { test_unit, test_header };
+    virtual_source_t *source        = NULL;
+    lexer_t *lexer                  = NULL;
+    source_location_t location      = { 0u, 0u };
+    token_view_t token              = { 0 };
+    size_t size                     = 0u;
+    size_t start                    = 0u;
+    size_t index                    = 0u;
+
+    /*< Allocate Memory >*/
+    source = Frost_initVirtualSource();
+    TEST_CHECK(source != NULL);
+    if (source == NULL)
+    {
+        return;
+    }
+
+    TEST_CHECK(Frost_virtualSourceLocate(source, 0u, &location) == -ERANGE);
+
+    TEST_CHECK(Frost_virtualSourceAddFile(source, "unit.c", test_unit, sizeof(test_unit) - 1u) == 0);
+    TEST_CHECK(Frost_virtualSourceAddFile(source, "b.h", test_header, sizeof(test_header) - 1u) == 1);
+
+    for (index = 0u; index < TEST_PIECES; index++)
+    {
+        TEST_CHECK(Frost_virtualSourceAppend(source, test_pieces[index].file, test_pieces[index].offset,
+                                             test_pieces[index].length) == FUNCTION_SUCESS);
+
+        memcpy(joined + size, buffers[test_pieces[index].file] + test_pieces[index].offset,
+               test_pieces[index].length);
+        size += test_pieces[index].length;
+    }
+
+    TEST_CHECK(Frost_virtualSourceSize(source) == size);
+    TEST_CHECK(strcmp(Frost_virtualSourceFileName(source, 1u), "b.h") == 0);
+    TEST_CHECK(Frost_virtualSourceFileName(source, 2u) == NULL);
+
+    /*< Locate: first and last byte of each piece, then the end >*/
+    for (index = 0u; index < TEST_PIECES; index++)
+    {
+        Test_locate(source, start, test_pieces[index].file, test_pieces[index].offset);
+        Test_locate(source, start + test_pieces[index].length - 1u, test_pieces[index].file,
+                    test_pieces[index].offset + test_pieces[index].length - 1u);
+
+        TEST_CHECK(Frost_virtualSourcePointer(source, start) ==
+                   buffers[test_pieces[index].file] + test_pieces[index].offset);
+
+        start += test_pieces[index].length;
+    }
+
+    Test_locate(source, size, test_pieces[TEST_PIECES - 1u].file,
+                test_pieces[TEST_PIECES - 1u].offset + test_pieces[TEST_PIECES - 1u].length);
+    TEST_CHECK(Frost_virtualSourceLocate(source, size + 1u, &location) == -ERANGE);
+    TEST_CHECK(Frost_virtualSourcePointer(source, size) == test_unit + sizeof(test_unit) - 1u);
+    TEST_CHECK(Frost_virtualSourcePointer(source, size + 1u) == NULL);
+
+    /*< Reference: the contiguous copy >*/
+    lexer = Frost_initLexerView(joined, size);
+    TEST_CHECK(lexer != NULL);
+    if (lexer != NULL)
+    {
+        TEST_CHECK(Frost_lexStructural(lexer, Test_collect, &test_expected) == FUNCTION_SUCESS);
+        Frost_freeLexer(lexer);
+    }
+
+    /*< Pull API, lexemes pointing into the file buffers >*/
+    TEST_CHECK(Frost_virtualSourceRewind(source) == FUNCTION_SUCESS);
+    do
+    {
+        TEST_CHECK(Frost_virtualSourceNextToken(source, &token) == FUNCTION_SUCESS);
+        TEST_CHECK( (token.type == TOKEN_EOF) ||
+                    (memcmp(token.lexeme, joined + token.offset, token.length) == 0) );
+        TEST_CHECK( (token.type == TOKEN_EOF) ||
+                    (token.lexeme == Frost_virtualSourcePointer(source, token.offset)) );
+
+        (void)Test_collect(token.type, token.offset, token.length, &test_pulled);
+    } while ( (token.type != TOKEN_EOF) && (test_pulled.count < TEST_MAX_TOKENS) );
+
+    /*< Callback API >*/
+    TEST_CHECK(Frost_virtualSourceLex(source, Test_collect, &test_streamed) == FUNCTION_SUCESS);
+
+    TEST_CHECK(test_expected.count > TEST_PIECES);
+    TEST_CHECK(Test_same(&test_expected, &test_pulled));
+    TEST_CHECK(Test_same(&test_expected, &test_streamed));
+    TEST_CHECK(Test_eofCount(&test_pulled) == 1u);
+    TEST_CHECK(Test_eofCount(&test_streamed) == 1u);
+    TEST_CHECK(test_streamed.tokens[test_streamed.count - 1u].offset == size);
+
+    /*< Free Memory >*/
+    Frost_freeVirtualSource(source);
+}
+
+/** ============================================================================
+  @fn       Test_merge
+  @package  Frost_Tests
+
+  @brief    Checks that contiguous appends of one file form a single piece.
+
+  @details  A token crossing a piece boundary is delivered as two tokens, so
+            an identifier split across two contiguous appends lexes as one
+            only if they were merged. A gap in between keeps them apart.
+ =========================================================================== **/
+static void Test_merge(void)
+{
+    /*< Variable Declarations >*/
+    static const char text[] = "identifier rest";
+    virtual_source_t *source = NULL;
+    token_view_t token       = { 0 };
+
+    /*< Allocate Memory >*/
+    source = Frost_initVirtualSource();
+    TEST_CHECK(source != NULL);
+    if (source == NULL)
+    {
+        return;
+    }
+
+    /*< Contiguous, with an empty range in between >*/
+    TEST_CHECK(Frost_virtualSourceAddFile(source, "merge.c", text, sizeof(text) - 1u) == 0);
+    TEST_CHECK(Frost_virtualSourceAppend(source, 0u, 0u, 5u) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_virtualSourceAppend(source, 0u, 5u, 0u) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_virtualSourceAppend(source, 0u, 5u, 5u) == FUNCTION_SUCESS);
+
+    TEST_CHECK(Frost_virtualSourceNextToken(source, &token) == FUNCTION_SUCESS);
+    TEST_CHECK( (token.type == TOKEN_ID) && (token.offset == 0u) && (token.length == 10u) );
+
+    /*< Not contiguous: the same file from its start again >*/
+    TEST_CHECK(Frost_virtualSourceAppend(source, 0u, 0u, 4u) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_virtualSourceAppend(source, 0u, 11u, 4u) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_virtualSourceSize(source) == 18u);
+
+    TEST_CHECK(Frost_virtualSourceRewind(source) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_virtualSourceNextToken(source, &token) == FUNCTION_SUCESS);
+    TEST_CHECK(Frost_virtualSourceNextToken(source, &token) == FUNCTION_SUCESS);
+    TEST_CHECK( (token.type == TOKEN_ID) && (token.offset == 10u) && (token.length == 4u) );
+    TEST_CHECK(Frost_virtualSourceNextToken(source, &token) == FUNCTION_SUCESS);
+    TEST_CHECK( (token.type == TOKEN_ID) && (token.offset == 14u) && (token.length == 4u) );
+
+    /*< Out of range >*/
+    TEST_CHECK(Frost_virtualSourceAppend(source, 0u, 10u, 6u) == -ERANGE);
+    TEST_CHECK(Frost_virtualSourceAppend(source, 1u, 0u, 1u) == -ERANGE);
+
+    /*< Free Memory >*/
+    Frost_freeVirtualSource(source);
+}
+
+/* ========================================================================== *\
+ *                      PUBLIC FUNCTIONS IMPLEMENTATION                       *
+\* ========================================================================== */
+
+int main(void)
+{
+    /*< Start Function Algorithm >*/
+    Test_pieces();
+    Test_merge();
+
+    /*< Function Output >*/
+    if (test_failures != 0)
+    {
+        fprintf(stderr, "virtual_source_test: %d check(s) failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("virtual_source_test: ok\n");
+    return EXIT_SUCCESS;
+}
+
+/*< end of file >*/ /** @}*/